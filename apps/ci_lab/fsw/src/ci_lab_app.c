@@ -47,8 +47,8 @@ CFE_SB_PipeId_t    CI_CommandPipe;
 CFE_SB_MsgPtr_t    CIMsgPtr;
 int                CI_SocketID;
 struct sockaddr_in CI_SocketAddress;
-uint8              CI_IngestBuffer[CI_MAX_INGEST];
-CFE_SB_Msg_t       *CI_IngestPointer = (CFE_SB_Msg_t *) &CI_IngestBuffer[0];
+uint8              CI_IngestBuffer[CI_MAX_INGEST_PER_WAKEUP][CI_MAX_INGEST];
+CFE_SB_Msg_t       *CI_IngestPointer = (CFE_SB_Msg_t *) &CI_IngestBuffer[0][0];
 CFE_SB_MsgId_t     PDUMessageID = 0;
 boolean            adjustFileSize = FALSE;
 int		   PDUFileSizeAdjustment;
@@ -754,14 +754,19 @@ void CI_ReadUpLink(void)
     socklen_t addr_len;
     int i;
     int status;
+    uint32 NumIngested = 0;
+    CFE_SB_Msg_t *IngestPtrs[CI_MAX_INGEST_PER_WAKEUP];
 
     addr_len = sizeof(CI_SocketAddress);
 
     memset(&CI_SocketAddress, 0, sizeof(CI_SocketAddress));
 
-    for (i = 0; i <= 10; i++)
+    for (i = 0; i < CI_MAX_INGEST_PER_WAKEUP; i++)
     {
-        status = recvfrom(CI_SocketID, (char *)&CI_IngestBuffer[0], sizeof(CI_IngestBuffer), MSG_DONTWAIT,
+        /* Each packet gets its own buffer so they can all be sent at once */
+        CI_IngestPointer = (CFE_SB_Msg_t *) &CI_IngestBuffer[NumIngested][0];
+
+        status = recvfrom(CI_SocketID, (char *)CI_IngestPointer, CI_MAX_INGEST, MSG_DONTWAIT,
                          (struct sockaddr *) &CI_SocketAddress, &addr_len);
 
         if ( (status < 0) && (errno == EWOULDBLOCK) )
@@ -772,14 +777,22 @@ void CI_ReadUpLink(void)
             {
 		if (PDUMessageID != 0)
 		{
+		  /* Send the packets batched so far first, so the PDU does not overtake them */
+		  if (NumIngested > 0)
+		  {
+		    CFE_ES_PerfLogEntry(CI_SOCKET_RCV_PERF_ID);
+		    CFE_SB_SendMsgBatch(IngestPtrs, NumIngested, NULL);
+		    CFE_ES_PerfLogExit(CI_SOCKET_RCV_PERF_ID);
+		    NumIngested = 0;
+		  }
+
 		  CI_ProcessPDU();
 		}
                 else
 		{
-		  CFE_ES_PerfLogEntry(CI_SOCKET_RCV_PERF_ID);
                   CI_HkTelemetryPkt.IngestPackets++;
-                  CFE_SB_SendMsg(CI_IngestPointer);
-                  CFE_ES_PerfLogExit(CI_SOCKET_RCV_PERF_ID);
+                  IngestPtrs[NumIngested] = CI_IngestPointer;
+                  NumIngested++;
 		}
             }
             else
@@ -789,6 +802,13 @@ void CI_ReadUpLink(void)
         }
     }
 
+    if (NumIngested > 0)
+    {
+        CFE_ES_PerfLogEntry(CI_SOCKET_RCV_PERF_ID);
+        CFE_SB_SendMsgBatch(IngestPtrs, NumIngested, NULL);
+        CFE_ES_PerfLogExit(CI_SOCKET_RCV_PERF_ID);
+    }
+
     return;
 
 } /* End of CI_ReadUpLink() */
@@ -44,6 +44,7 @@
 
 #define cfgCI_PORT                      1234
 #define CI_MAX_INGEST                    768
+#define CI_MAX_INGEST_PER_WAKEUP          11
 #define CI_PIPE_DEPTH                     32
 
 /************************************************************************
@@ -44,6 +44,7 @@
 */
 CFE_SB_CmdHdr_t  SCH_CmdHeaderTable[SCH_LAB_MAX_SCHEDULE_ENTRIES];
 CFE_SB_Msg_t    *SCH_CmdPipePktPtr;
+CFE_SB_Msg_t    *SCH_SendPtrs[SCH_LAB_MAX_SCHEDULE_ENTRIES];
 
 /*
 ** AppMain
@@ -51,6 +52,7 @@ CFE_SB_Msg_t    *SCH_CmdPipePktPtr;
 void SCH_Lab_AppMain(void)
 {
     int              i;
+    uint32           NumToSend;
     int32            rtnStat;
     uint32           SCH_OneHzPktsRcvd = 0;
     uint32           RunStatus = CFE_ES_APP_RUN;
@@ -111,7 +113,9 @@ void SCH_Lab_AppMain(void)
             SCH_OneHzPktsRcvd++;
             /*
             ** Process table every second, sending packets that are ready 
+            ** together once the whole table has been checked
             */
+            NumToSend = 0;
             for (i = 0; i < SCH_LAB_MAX_SCHEDULE_ENTRIES; i++) 
             {
                 if ( SCH_LAB_ScheduleTable[i].MessageID != SCH_LAB_END_OF_TABLE )
@@ -120,7 +124,8 @@ void SCH_Lab_AppMain(void)
                       if ( SCH_LAB_ScheduleTable[i].Counter >= SCH_LAB_ScheduleTable[i].PacketRate )
                       {
                           SCH_LAB_ScheduleTable[i].Counter = 0;
-                          CFE_SB_SendMsg((CFE_SB_MsgPtr_t)&SCH_CmdHeaderTable[i]);
+                          SCH_SendPtrs[NumToSend] = (CFE_SB_MsgPtr_t)&SCH_CmdHeaderTable[i];
+                          NumToSend++;
                       }
                 } 
                 else
@@ -128,6 +133,11 @@ void SCH_Lab_AppMain(void)
                    break;
                 }
             }
+
+            if (NumToSend > 0)
+            {
+                CFE_SB_SendMsgBatch(SCH_SendPtrs, NumToSend, NULL);
+            }
         }
 
     }/* end while */
@@ -506,7 +506,9 @@ void TO_forward_telemetry(void)
     int                       status;
     int32                     CFE_SB_status;
     uint16                    size;
-    CFE_SB_Msg_t              *PktPtr;
+    uint32                    NumPkts;
+    uint32                    i;
+    CFE_SB_Msg_t              *PktPtrs[TO_RCV_BATCH_SIZE];
 
     memset(&s_addr, 0, sizeof(s_addr));
     s_addr.sin_family      = AF_INET;
@@ -516,17 +518,18 @@ void TO_forward_telemetry(void)
 
     do
     {
-       CFE_SB_status = CFE_SB_RcvMsg(&PktPtr, TO_Tlm_pipe, CFE_SB_POLL);
+       CFE_SB_status = CFE_SB_RcvMsgBatch(PktPtrs, TO_RCV_BATCH_SIZE, &NumPkts,
+                                          TO_Tlm_pipe, CFE_SB_POLL);
 
-       if ( (CFE_SB_status == CFE_SUCCESS) && (suppress_sendto == FALSE) )
+       for (i = 0; (CFE_SB_status == CFE_SUCCESS) && (i < NumPkts) && (suppress_sendto == FALSE); i++)
        {
-          size = CFE_SB_GetTotalMsgLength(PktPtr);
+          size = CFE_SB_GetTotalMsgLength(PktPtrs[i]);
           
           if(downlink_on == TRUE)
           {
              CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
 
-             status = sendto(TLMsockid, (char *)PktPtr, size, 0,
+             status = sendto(TLMsockid, (char *)PktPtrs[i], size, 0,
                                         (struct sockaddr *) &s_addr,
                                          sizeof(s_addr) );
                                          
@@ -539,7 +542,7 @@ void TO_forward_telemetry(void)
              suppress_sendto = TRUE;
           }
        }
-    /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_RcvMsg() */
+    /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_RcvMsgBatch() */
     }while(CFE_SB_status == CFE_SUCCESS);
 } /* End of TO_forward_telemetry() */
 
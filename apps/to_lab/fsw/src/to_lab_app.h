@@ -41,6 +41,7 @@
 /*****************************************************************************/
 
 #define TO_TASK_MSEC             500          /* run at 2 Hz */
+#define TO_RCV_BATCH_SIZE         32          /* packets taken from the pipe per receive */
 #define TO_UNUSED                  0
 
 #define cfgTLM_ADDR "192.168.1.81"
@@ -206,6 +206,22 @@
 #define CFE_SB_MAX_PIPE_DEPTH           256
 
 
+/**
+**  \cfesbcfg Maximum number of messages returned by one batch receive
+**
+**  \par Description:
+**       The value of this constant dictates the largest number of messages
+**       that #CFE_SB_RcvMsgBatch will return from a pipe in one call.  Each
+**       pipe keeps this many buffer pointers so that the buffers can be
+**       released on the next receive.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and may not exceed
+**       #CFE_SB_MAX_PIPE_DEPTH.
+*/
+#define CFE_SB_MAX_RCV_BATCH            32
+
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -355,6 +371,89 @@
 */
 #define CFE_SB_DEFAULT_REPORT_SENDER      1
 
+/**
+**  \cfesbcfg Enable Lock-Free Message Send
+**
+**  \par Description:
+**       When set to TRUE, #CFE_SB_SendMsg, #CFE_SB_PassMsg and the zero copy send
+**       APIs route messages without taking the SB shared data mutex.  Senders
+**       read the routing table inside a lightweight epoch-protected section, all
+**       send path counters are updated atomically, and subscribe/unsubscribe
+**       (which still hold the mutex) wait for in-progress senders to finish
+**       before a destination descriptor is recycled.  This lets concurrent
+**       publishers on a multi-core processor proceed in parallel.  The SB
+**       memory pool is created with its own mutex in this mode.
+**
+**       When set to FALSE, every send is serialized by the SB shared data mutex.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires a toolchain that provides the GCC
+**       atomic builtins.
+*/
+#define CFE_SB_LOCKLESS_SEND              TRUE
+
+/**
+**  \cfesbcfg Define SB Buffer Cache Depth
+**
+**  \par Description:
+**       Each task keeps a small cache ("magazine") of recently released SB
+**       message buffers for each SB memory pool block size.  Buffers for a
+**       send are taken from the calling task's cache, and released buffers are
+**       put back into the releasing task's cache, so most sends and receives
+**       do not need the SB memory pool at all.  An empty cache is refilled from
+**       the pool, and a full cache is drained to the pool, half a cache at a time.
+**
+**       This parameter is the number of buffers cached per block size per task.
+**       A value of 0 disables the cache.
+**
+**       The memory in use counters in the SB statistics packet include the
+**       buffers taken through the caches as of the last housekeeping request
+**       or statistics command.
+**
+**  \par Limits
+**       This parameter has a lower limit of 0 and an upper limit of 64.  Cached
+**       buffers are not available to other tasks, so #CFE_SB_BUF_MEMORY_BYTES
+**       should allow for up to this many buffers of each cached block size per
+**       task that sends or receives messages.
+*/
+#define CFE_SB_BUF_CACHE_DEPTH            4
+
+/**
+**  \cfesbcfg Define Largest Cached SB Buffer Block
+**
+**  \par Description:
+**       Message buffers whose pool block (message plus buffer descriptor) is
+**       larger than this number of bytes are always taken from and released to
+**       the SB memory pool directly.  Only applies if #CFE_SB_BUF_CACHE_DEPTH
+**       is greater than 0.
+**
+**  \par Limits
+**       This parameter must be greater than 0 and may not exceed
+**       #CFE_SB_MAX_BLOCK_SIZE.
+*/
+#define CFE_SB_BUF_CACHE_MAX_BLOCK        512
+
+/**
+**  \cfesbcfg Use SB Ring Buffers for Pipes
+**
+**  \par Description:
+**       When set to TRUE, each pipe is a lock-free ring of buffer descriptor
+**       pointers kept in SB memory instead of an OS queue.  Any number of
+**       tasks may write to a ring without a system call, and the reading task
+**       only blocks on an OS binary semaphore when the pipe is empty and it
+**       asked to pend or wait.  #CFE_SB_PEND_FOREVER, #CFE_SB_POLL and
+**       timeout receives behave as with OS queues.
+**
+**       When set to FALSE, each pipe is an OS queue.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires a toolchain that provides the GCC
+**       atomic builtins and a #CFE_SB_MAX_PIPE_DEPTH that is a power of two.
+**       Each of the #CFE_SB_MAX_PIPES rings holds #CFE_SB_MAX_PIPE_DEPTH
+**       entries, which are reserved whether the pipe is created or not.
+*/
+#define CFE_SB_RING_PIPES                 FALSE
+
 
 /**
 **  \cfetimecfg Time Server or Time Client Selection
@@ -856,6 +955,29 @@
 */
 #define CFE_ES_MEMPOOL_ALIGNED   1
 
+/**
+**  \cfeescfg Define Lock-Free Memory Pool Mode
+**
+**  \par Description:
+**       When set to TRUE, memory pools created with #CFE_ES_USE_MUTEX do not
+**       take a mutex to allocate or free a block.  Each block size keeps its
+**       free blocks on a stack that is updated with a compare-and-swap of a
+**       tagged offset, and new blocks are carved from the pool with an atomic
+**       add, so tasks sharing a pool no longer wait on each other.  Pools
+**       created with #CFE_ES_PoolCreateBuddy still use their mutex.
+**
+**       When set to FALSE, every operation on such a pool holds its mutex.
+**
+**       This changes every mutex pool in the system, including those of
+**       applications, so it is left FALSE unless the target has been checked
+**       with lock-free pools.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires a toolchain that provides the GCC
+**       atomic builtins, including an 8 byte compare-and-swap.
+*/
+#define CFE_ES_LOCKLESS_POOLS    FALSE
+
 /**
 **  \cfeescfg ES Nonvolatile Startup Filename
 **
@@ -1007,6 +1129,20 @@
 */
 #define CFE_ES_DEFAULT_PERF_DUMP_FILENAME    "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Performance Histogram Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       performance histograms. This filename is used only when no filename is
+**       specified in the command to write the histograms.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_ES_DEFAULT_PERF_HIST_FILENAME    "/ram/cfe_es_perf_hist.dat"
+
 
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
@@ -1068,6 +1204,75 @@
 */
 #define CFE_ES_PERF_DATA_BUFFER_SIZE           10000
 
+/**
+**  \cfeescfg Define Per-Task Performance Data Rings
+**
+**  \par Description:
+**       When set to TRUE, the performance data buffer is split into
+**       #CFE_ES_PERF_RING_COUNT rings and each task adds its markers to the
+**       ring selected by its OS task index, claiming an entry with an atomic
+**       add instead of locking interrupts.  The trigger state is still shared
+**       by all rings.  When the data is written to a file the rings are merged
+**       by time stamp, so the file format does not change.
+**
+**       Each ring keeps only its own most recent entries, so a busy task can
+**       overwrite its older data while other rings still have room.
+**
+**       When set to FALSE, all markers go to the single shared buffer with
+**       interrupts locked.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires a toolchain that provides the GCC
+**       atomic builtins.
+*/
+#define CFE_ES_PERF_TASK_RINGS                 FALSE
+
+/**
+**  \cfeescfg Define Number of Performance Data Rings
+**
+**  \par Description:
+**       Defines the number of rings the performance data buffer is split into
+**       when #CFE_ES_PERF_TASK_RINGS is TRUE.  Tasks whose OS task indexes
+**       differ by a multiple of this number share a ring, so setting it to
+**       OS_MAX_TASKS gives every task its own ring, at the cost of smaller
+**       rings.
+**
+**  \par Limits
+**       Must be at least 1, and #CFE_ES_PERF_DATA_BUFFER_SIZE must be a
+**       multiple of this number.
+*/
+#define CFE_ES_PERF_RING_COUNT                 8
+
+/**
+**  \cfeescfg Define Performance Latency Histograms
+**
+**  \par Description:
+**       When set to TRUE, Executive Services keeps a latency histogram for each
+**       performance ID.  The time between a #CFE_ES_PerfLogEntry and the
+**       matching #CFE_ES_PerfLogExit made by the same task is added to the
+**       histogram whether or not the Performance Analyzer is collecting data,
+**       and the histograms can be written to a file with the
+**       #CFE_ES_WRITE_PERF_HIST_CC command.  Histograms are updated with atomic
+**       operations, so this requires a compiler with 64-bit atomic builtins.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.
+*/
+#define CFE_ES_PERF_HISTOGRAMS                 FALSE
+
+/**
+**  \cfeescfg Define Performance Histogram Nesting Depth
+**
+**  \par Description:
+**       Defines how many performance markers a task may have entered and not
+**       yet exited when #CFE_ES_PERF_HISTOGRAMS is TRUE.  Entries made beyond
+**       this depth are not timed.
+**
+**  \par Limits
+**       There is a lower limit of 1.  Each OS task uses 12 bytes per level.
+*/
+#define CFE_ES_PERF_HIST_NEST_DEPTH            4
+
 
 /**
 **  \cfeescfg Define Filter Mask Setting for Disabling All Performance Entries
@@ -1164,29 +1369,45 @@
 #define CFE_ES_PERF_CHILD_STACK_SIZE              4096
 
 /**
-**  \cfeescfg Define Performance Analyzer Child Task Delay
+**  \cfeescfg Define File Dump Buffer Size
 **
 **  \par Description:
-**       This parameter defines the delay time (in milliseconds) between performance
-**       data file writes performed by the Executive Services Performace Analyzer
-**       Child Task.   
+**       This parameter defines the size (in bytes) of the buffer that collects
+**       the records of a log dump (performance data, system log, exception and
+**       reset log, EVS local event log) so they are written to the file in a
+**       few large writes.  Each dump keeps its own buffer of this size.
 **
 **  \par Limits
-**       It is recommended this parameter be greater than or equal to 20ms. This parameter
-**       is limited by the maximum value allowed by the data type. In this case, the data
-**       type is an unsigned 32-bit integer, so the valid range is 0 to 0xFFFFFFFF.
+**       This parameter must be at least 512 bytes.
+*/
+#define CFE_ES_DUMP_BUFFER_SIZE                   8192
+
+/**
+**  \cfeescfg Define File Dump Run Time
+**
+**  \par Description:
+**       This parameter defines the time (in milliseconds) a log dump may keep
+**       writing before it delays for #CFE_ES_DUMP_YIELD_MSEC to let other tasks
+**       run.  A dump that completes within this time never delays.
+**
+**  \par Limits
+**       This parameter must be greater than zero.
 */
-#define CFE_ES_PERF_CHILD_MS_DELAY                20
+#define CFE_ES_DUMP_RUN_MSEC                      20
 
 /**
-**  \cfeescfg Define Performance Analyzer Child Task Number of Entries Between Delay
+**  \cfeescfg Define File Dump Yield Time
 **
 **  \par Description:
-**       This parameter defines the number of performace analyzer entries the Performace 
-**       Analyzer Child Task will write to the file between delays.  
+**       This parameter defines the delay time (in milliseconds) of a log dump
+**       that has been writing for #CFE_ES_DUMP_RUN_MSEC.
 **
+**  \par Limits
+**       It is recommended this parameter be greater than or equal to 20ms. This parameter
+**       is limited by the maximum value allowed by the data type. In this case, the data
+**       type is an unsigned 32-bit integer, so the valid range is 0 to 0xFFFFFFFF.
 */
-#define CFE_ES_PERF_ENTRIES_BTWN_DLYS             50
+#define CFE_ES_DUMP_YIELD_MSEC                    20
 
 /**
 **  \cfeescfg Define Default Stack Size for an Application
@@ -1430,6 +1651,20 @@
 #define CFE_ES_CDS_MEM_BLOCK_SIZE_16          32768
 #define CFE_ES_CDS_MAX_BLOCK_SIZE             80000
 
+/**
+**  \cfeescfg Define CDS Block CRC Chunk Size
+**
+**  \par Description:
+**       #CFE_ES_CopyToCDSRange reads back the old contents of the range it
+**       copies, this many bytes at a time, to update the CRC of the whole
+**       CDS block.  Larger chunks mean fewer CDS reads for large ranges.
+**
+**  \par Limits
+**       Must be greater than zero and no larger than #CFE_ES_CDS_MAX_BLOCK_SIZE.
+**       ES keeps one buffer of this size for range copies.
+*/
+#define CFE_ES_CDS_CRC_CHUNK_SIZE               512
+
 
 
 /**
@@ -1485,6 +1720,29 @@
 #define CFE_EVS_LOG_MAX               20
 
 
+/**
+**  \cfeevscfg Compact EVS Local Event Log
+**
+**  \par Description:
+**       When TRUE, the local event log keeps each event as a header and the
+**       actual length of its text rather than as a full event packet, and an
+**       event identical to the newest entry (same app, event ID, type and text)
+**       only updates that entry's repeat count and last time.  The log uses the
+**       memory of #CFE_EVS_LOG_MAX full packets, so it holds more events.  The
+**       write log file command expands the entries back into event packets: the
+**       first event of each entry and, if it repeated, the last one with the
+**       repeat count at the front of its text.
+**
+**       The compact log is full once an event does not fit in the free space.
+**       Changing this parameter changes the layout of the log in the reset
+**       area, so it must be followed by a power-on reset.
+**
+**  \par Limits
+**       TRUE or FALSE
+*/
+#define CFE_EVS_COMPACT_LOG           FALSE
+
+
 /**
 **  \cfeevscfg Default EVS Application Data Filename
 **
@@ -1566,6 +1824,62 @@
 #define CFE_EVS_DEFAULT_MSG_FORMAT_MODE CFE_EVS_LONG_FORMAT
 
 
+/**
+**  \cfeevscfg Defer Event Message Formatting to the EVS Task
+**
+**  \par Description:
+**       When set to TRUE, #CFE_EVS_SendEvent, #CFE_EVS_SendEventWithAppID and
+**       #CFE_EVS_SendTimedEvent apply the event filters, then copy the event ID,
+**       type, time, format string and arguments into a lock-free queue and
+**       return.  The EVS task formats the message, writes it to the local
+**       event log, sends it on the software bus and out the enabled ports.  An
+**       event that finds the queue full is discarded and counted, and the EVS
+**       task reports the count in a #CFE_EVS_DEFERRED_DROP_EID event.
+**
+**       When set to FALSE, the calling task does all of this before the send
+**       function returns.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires a toolchain that provides the GCC
+**       atomic builtins.  The format string and the \%s arguments are copied,
+**       up to #CFE_EVS_MAX_MESSAGE_LENGTH bytes for the format string and as
+**       many for all of the \%s arguments.  An event with a longer format
+**       string, more than 8 arguments, more string data, or a \%n, \%*, \%L
+**       or \%j style conversion is formatted by the calling task as if this
+**       were FALSE.
+*/
+#define CFE_EVS_DEFERRED_SEND           FALSE
+
+
+/**
+**  \cfeevscfg Depth of the Deferred Event Queue
+**
+**  \par Description:
+**       Number of events that may wait in the deferred event queue for the
+**       EVS task when #CFE_EVS_DEFERRED_SEND is TRUE.
+**
+**  \par Limits
+**       Must be a power of two, from 2 to 1024.  Each entry takes about 340
+**       bytes.
+*/
+#define CFE_EVS_DEFERRED_QUEUE_DEPTH    32
+
+
+/**
+**  \cfeevscfg Deferred Event Send Period
+**
+**  \par Description:
+**       Longest time, in milliseconds, that the EVS task waits on its command
+**       pipe before it sends the events in the deferred event queue, when
+**       #CFE_EVS_DEFERRED_SEND is TRUE.  This bounds the delay of a deferred
+**       event.
+**
+**  \par Limits
+**       Must be greater than zero.
+*/
+#define CFE_EVS_DEFERRED_SEND_MSEC      100
+
+
 
 /* Platform Configuration Parameters for Table Service (TBL) */
 
@@ -1684,6 +1998,106 @@
 */
 #define CFE_TBL_MAX_NUM_VALIDATIONS     10
 
+/**
+**  \cfetblcfg Table File Load Chunk Size
+**
+**  \par Description:
+**       Table data is read from a table file in pieces of at most this many
+**       bytes, and the CRC of each piece is computed while the piece is still
+**       in the cache.  When a \link #CFE_TBL_LOAD_CC Load Table command \endlink
+**       names a file holding more data than this, the rest of the file is read
+**       one piece at a time between commands, every #CFE_TBL_LOAD_YIELD_MSEC
+**       while the Table Services command pipe is empty, so that other commands
+**       are still processed during a large load.
+**
+**  \par Limits
+**       This number must be greater than zero.  Loads of tables no larger than
+**       this are completed by the Load Table command itself.
+*/
+#define CFE_TBL_LOAD_CHUNK_SIZE          16384
+
+/**
+**  \cfetblcfg Table File Load Yield Time
+**
+**  \par Description:
+**       While a table file is being loaded or dumped a piece at a time, or
+**       tables are waiting to be validated by the Table Services task, the
+**       task waits this many milliseconds for a command before it handles the
+**       next piece or performs the next validation.  This keeps a large load,
+**       a large dump or a run of validations from taking all of the processor
+**       time left by higher priority tasks.
+**
+**  \par Limits
+**       This number must be greater than zero.  A load or dump of N pieces
+**       takes at least N-1 times this long.
+*/
+#define CFE_TBL_LOAD_YIELD_MSEC          10
+
+/**
+**  \cfetblcfg Enable Lock-Free Table Access
+**
+**  \par Description:
+**       When set to TRUE, #CFE_TBL_GetAddress pins the active table buffer with
+**       a per-buffer reader count instead of marking the handle as locked, and
+**       table updates only wait on the readers of the buffer they replace.  A
+**       single buffered table is updated by making its loaded working buffer
+**       active at once.  The table's own buffer is refreshed and made active
+**       again as soon as no reader holds it, either during the update or when
+**       its last reader lets go of it, and the shared buffer is given back
+**       once its own readers have let go of it too.  An update is only
+**       refused while readers hold both the table's buffer and the contents
+**       of the previous update.
+**
+**       When set to FALSE, an update of a single buffered table is refused
+**       while any application holds the table's address.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires a toolchain that provides the GCC
+**       atomic builtins.
+*/
+#define CFE_TBL_LOCKLESS_ACCESS          TRUE
+
+/**
+**  \cfetblcfg Validate Tables in the Table Services Task
+**
+**  \par Description:
+**       When set to TRUE, the validation function of a table registered with the
+**       #CFE_TBL_OPT_TASK_VALIDATE option is called by the Table Services task
+**       between commands, one table every #CFE_TBL_LOAD_YIELD_MSEC while its
+**       command pipe is empty, rather than by the owning application's
+**       #CFE_TBL_Manage call.  The owning application then only
+**       has to activate a table once it has been validated, so a slow
+**       validation function does not hold up the application's main loop.
+**
+**       When set to FALSE, the #CFE_TBL_OPT_TASK_VALIDATE option is ignored.
+**
+**  \par Limits
+**       Must be TRUE or FALSE.  TRUE requires #CFE_TBL_LOCKLESS_ACCESS to be
+**       TRUE, since the Table Services task holds the active buffer it
+**       validates the way a reader does.
+*/
+#define CFE_TBL_TASK_VALIDATION          TRUE
+
+/**
+**  \cfetblcfg Table Dump Chunk Size
+**
+**  \par Description:
+**       When a \link #CFE_TBL_DUMP_CC Dump Table command \endlink names the
+**       active buffer of a table larger than this many bytes, the table data
+**       is written to the dump file in pieces of at most this many bytes, one
+**       piece every #CFE_TBL_LOAD_YIELD_MSEC while the Table Services command
+**       pipe is empty.  The active
+**       buffer is pinned the way #CFE_TBL_GetAddress pins it, so the dump file
+**       holds the contents the table had when the command was received, and
+**       other commands are still processed during a large dump.
+**
+**  \par Limits
+**       This number must be greater than zero.  Dumps are only written in
+**       pieces when #CFE_TBL_LOCKLESS_ACCESS is TRUE.  Other dumps are written
+**       by the Dump Table command itself.
+*/
+#define CFE_TBL_DUMP_CHUNK_SIZE          16384
+
 /**
 **  \cfetblcfg Default Filename for a Table Registry Dump
 **
@@ -162,6 +162,7 @@
 #include "cfe_es_cds_mempool.h"
 #include "cfe_psp.h"
 #include "cfe_es_log.h"
+#include "private/cfe_atomic.h"
 
 
 #include <string.h>
@@ -784,26 +785,52 @@ int32 CFE_ES_GetAppIDByName(uint32 *AppIdPtr, const char *AppName)
 int32 CFE_ES_GetAppID(uint32 *AppIdPtr)
 {
    int32  Result = CFE_ES_ERR_APPID;
+   uint32 OSTaskId;
    uint32 TaskId;
-
-   CFE_ES_LockSharedData(__func__,__LINE__);
+   uint32 Generation;
+   uint32 AppId;
 
    /*
    ** Step 1: Get the OS task ID
    */
-   if (OS_ConvertToArrayIndex(OS_TaskGetId(), &TaskId) == OS_SUCCESS)
+   OSTaskId = OS_TaskGetId();
+   if (OS_ConvertToArrayIndex(OSTaskId, &TaskId) == OS_SUCCESS)
    {
       /*
-      ** Step 2: get the Application ID for the current task
+      ** Step 2: read the caller's own task record without the lock.  The
+      ** record was read whole if its generation was even and did not change.
+      */
+      Generation = CFE_ATOMIC_LOAD(&CFE_ES_Global.TaskTable[TaskId].Generation);
+      CFE_ATOMIC_BARRIER();
+
+      if ( ((Generation & 1) == 0) &&
+           (CFE_ES_Global.TaskTable[TaskId].RecordUsed == TRUE) &&
+           (CFE_ES_Global.TaskTable[TaskId].TaskId == OSTaskId) )
+      {
+         AppId = CFE_ES_Global.TaskTable[TaskId].AppId;
+         CFE_ATOMIC_BARRIER();
+
+         if ( CFE_ATOMIC_LOAD(&CFE_ES_Global.TaskTable[TaskId].Generation) == Generation )
+         {
+            *AppIdPtr = AppId;
+            return(CFE_SUCCESS);
+         }
+      }
+
+      /*
+      ** Step 3: the record is being changed or is not set up yet, get the
+      ** Application ID for the current task under the lock
       */
+      CFE_ES_LockSharedData(__func__,__LINE__);
+
       if ( CFE_ES_Global.TaskTable[TaskId].RecordUsed == TRUE )
       {
          *AppIdPtr = CFE_ES_Global.TaskTable[TaskId].AppId;
          Result = CFE_SUCCESS;
       } /* end if */
-   }
 
-   CFE_ES_UnlockSharedData(__func__,__LINE__);
+      CFE_ES_UnlockSharedData(__func__,__LINE__);
+   }
       
    return(Result);
 
@@ -1052,12 +1079,15 @@ int32 CFE_ES_CreateChildTask(uint32 *TaskIdPtr,
             {
                OS_ConvertToArrayIndex(*TaskIdPtr, &TaskId);
 
+               CFE_ES_BeginTaskRecordUpdate(TaskId);
                CFE_ES_Global.TaskTable[TaskId].RecordUsed = TRUE;
                CFE_ES_Global.TaskTable[TaskId].AppId = AppId;
                CFE_ES_Global.TaskTable[TaskId].TaskId = *TaskIdPtr;
                strncpy((char *)CFE_ES_Global.TaskTable[TaskId].TaskName,TaskName,OS_MAX_API_NAME);
                CFE_ES_Global.TaskTable[TaskId].TaskName[OS_MAX_API_NAME - 1] = '\0';
+               CFE_ES_EndTaskRecordUpdate(TaskId);
                CFE_ES_Global.RegisteredTasks++;
+               CFE_SB_InvalidateSenderCache(*TaskIdPtr);
 
                /*
                ** Increment the "Registered" child task count for the App
@@ -1210,8 +1240,12 @@ int32 CFE_ES_DeleteChildTask(uint32 OSTaskId)
                 /*
                 ** Invalidate the task table entry
                 */
+                CFE_ES_BeginTaskRecordUpdate(TaskId);
                 CFE_ES_Global.TaskTable[TaskId].RecordUsed = FALSE;
+                CFE_ES_EndTaskRecordUpdate(TaskId);
                 CFE_ES_Global.RegisteredTasks--;
+                CFE_SB_InvalidateSenderCache(OSTaskId);
+                CFE_SB_ReleaseTaskBufCache(OSTaskId);
 
                 /*
                 ** Report the task delete
@@ -1293,8 +1327,12 @@ void CFE_ES_ExitChildTask(void)
             /*
             ** Invalidate the task table entry
             */
+            CFE_ES_BeginTaskRecordUpdate(TaskId);
             CFE_ES_Global.TaskTable[TaskId].RecordUsed = FALSE;
+            CFE_ES_EndTaskRecordUpdate(TaskId);
             CFE_ES_Global.RegisteredTasks--;
+            CFE_SB_InvalidateSenderCache(CFE_ES_Global.TaskTable[TaskId].TaskId);
+            CFE_SB_ReleaseTaskBufCache(CFE_ES_Global.TaskTable[TaskId].TaskId);
 
 
             CFE_ES_UnlockSharedData(__func__,__LINE__);
@@ -1432,6 +1470,64 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
 } /* End of CFE_ES_WriteToSysLog() */
 
 
+/*
+** CRC lookup tables.  Table 0 is the usual byte-at-a-time table for each
+** polynomial; table N gives the effect of a byte followed by N zero bytes,
+** so that eight bytes can be folded into the CRC with eight independent
+** lookups.
+*/
+#define CFE_ES_CRC_SLICES      8
+#define CFE_ES_CRC16_POLY      0xA001       /* CRC-16/ARC, reflected */
+#define CFE_ES_CRC32_POLY      0xEDB88320   /* CRC-32 (IEEE 802.3), reflected */
+
+static uint16  CFE_ES_Crc16Table[CFE_ES_CRC_SLICES][256];
+static uint32  CFE_ES_Crc32Table[CFE_ES_CRC_SLICES][256];
+static boolean CFE_ES_CrcTablesReady = FALSE;
+
+
+/*
+** Function: CFE_ES_SetupCRCTables
+**
+** Purpose:  Build the CRC lookup tables.
+**
+*/
+void CFE_ES_SetupCRCTables(void)
+{
+    uint32  i;
+    uint32  Slice;
+    uint32  Bit;
+    uint32  Crc16;
+    uint32  Crc32;
+
+    for ( i = 0 ; i < 256 ; i++ )
+    {
+        Crc16 = i;
+        Crc32 = i;
+        for ( Bit = 0 ; Bit < 8 ; Bit++ )
+        {
+            Crc16 = (Crc16 & 1) ? ((Crc16 >> 1) ^ CFE_ES_CRC16_POLY) : (Crc16 >> 1);
+            Crc32 = (Crc32 & 1) ? ((Crc32 >> 1) ^ CFE_ES_CRC32_POLY) : (Crc32 >> 1);
+        }
+        CFE_ES_Crc16Table[0][i] = (uint16)Crc16;
+        CFE_ES_Crc32Table[0][i] = Crc32;
+    }
+
+    for ( Slice = 1 ; Slice < CFE_ES_CRC_SLICES ; Slice++ )
+    {
+        for ( i = 0 ; i < 256 ; i++ )
+        {
+            Crc16 = CFE_ES_Crc16Table[Slice - 1][i];
+            Crc32 = CFE_ES_Crc32Table[Slice - 1][i];
+            CFE_ES_Crc16Table[Slice][i] = (uint16)((Crc16 >> 8) ^ CFE_ES_Crc16Table[0][Crc16 & 0xFF]);
+            CFE_ES_Crc32Table[Slice][i] = (Crc32 >> 8) ^ CFE_ES_Crc32Table[0][Crc32 & 0xFF];
+        }
+    }
+
+    CFE_ES_CrcTablesReady = TRUE;
+
+} /* End of CFE_ES_SetupCRCTables() */
+
+
 /*
 ** Function: CFE_ES_CalculateCRC
 **
@@ -1441,68 +1537,101 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, uint32 DataLength, uint32 InputCRC, uint32 TypeCRC)
 {
     uint32  i;
-    int16  Index;
-    int16  Crc = 0;
+    uint32  Crc = 0;
     const uint8 *BufPtr;
     uint8  ByteValue;
+    boolean UsePSPRead;
 
-    static const uint16 CrcTable[256]=
+    if ( CFE_ES_CrcTablesReady == FALSE )
     {
+        CFE_ES_SetupCRCTables();
+    }
 
-		    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
-		    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
-		    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
-		    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
-		    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
-		    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
-		    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
-		    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
-		    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
-		    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
-		    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
-		    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
-		    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
-		    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-		    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
-		    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
-		    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
-		    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
-		    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
-		    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
-		    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
-		    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
-		    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
-		    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
-		    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
-		    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
-		    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
-		    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-		    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
-		    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
-		    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
-		    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
-
-    };
+    /*
+    ** Memory the PSP memory table lists as EEPROM is read one byte at a
+    ** time through the PSP; everything else is read directly.
+    */
+    BufPtr = (const uint8 *)DataPtr;
+    UsePSPRead = FALSE;
+    if ( (DataLength > 0) &&
+         (CFE_PSP_MemValidateRange((cpuaddr)BufPtr, DataLength, CFE_PSP_MEM_EEPROM) == CFE_PSP_SUCCESS) )
+    {
+        UsePSPRead = TRUE;
+    }
 
     switch(TypeCRC)
     {
       case CFE_ES_CRC_32:
-           CFE_ES_WriteToSysLog("CFE ES Calculate CRC32 not Implemented\n");
+           Crc = ~InputCRC;
+
+           if ( UsePSPRead == FALSE )
+           {
+              for ( ; DataLength >= CFE_ES_CRC_SLICES ; DataLength -= CFE_ES_CRC_SLICES, BufPtr += CFE_ES_CRC_SLICES)
+              {
+                 Crc = CFE_ES_Crc32Table[7][(BufPtr[0] ^ Crc) & 0xFF] ^
+                       CFE_ES_Crc32Table[6][(BufPtr[1] ^ (Crc >> 8)) & 0xFF] ^
+                       CFE_ES_Crc32Table[5][(BufPtr[2] ^ (Crc >> 16)) & 0xFF] ^
+                       CFE_ES_Crc32Table[4][(BufPtr[3] ^ (Crc >> 24)) & 0xFF] ^
+                       CFE_ES_Crc32Table[3][BufPtr[4]] ^
+                       CFE_ES_Crc32Table[2][BufPtr[5]] ^
+                       CFE_ES_Crc32Table[1][BufPtr[6]] ^
+                       CFE_ES_Crc32Table[0][BufPtr[7]];
+              }
+           }
+
+           for ( i = 0 ; i < DataLength ; i++,  BufPtr++)
+           {
+              if ( UsePSPRead == FALSE )
+              {
+                 ByteValue = *BufPtr;
+              }
+              else if (CFE_PSP_MemRead8((cpuaddr)BufPtr, &ByteValue) != CFE_PSP_SUCCESS)
+              {
+                 ByteValue = 0;
+              }
+              Crc = (Crc >> 8) ^ CFE_ES_Crc32Table[0][(Crc ^ ByteValue) & 0xFF];
+           }
+
+           Crc = ~Crc;
            break;
 
       case CFE_ES_CRC_16:
-           Crc    =  (int16 )( 0xFFFF & InputCRC );
-           BufPtr = (const uint8 *)DataPtr;
+           Crc = 0xFFFF & InputCRC;
+
+           if ( UsePSPRead == FALSE )
+           {
+              for ( ; DataLength >= CFE_ES_CRC_SLICES ; DataLength -= CFE_ES_CRC_SLICES, BufPtr += CFE_ES_CRC_SLICES)
+              {
+                 Crc = CFE_ES_Crc16Table[7][(BufPtr[0] ^ Crc) & 0xFF] ^
+                       CFE_ES_Crc16Table[6][(BufPtr[1] ^ (Crc >> 8)) & 0xFF] ^
+                       CFE_ES_Crc16Table[5][BufPtr[2]] ^
+                       CFE_ES_Crc16Table[4][BufPtr[3]] ^
+                       CFE_ES_Crc16Table[3][BufPtr[4]] ^
+                       CFE_ES_Crc16Table[2][BufPtr[5]] ^
+                       CFE_ES_Crc16Table[1][BufPtr[6]] ^
+                       CFE_ES_Crc16Table[0][BufPtr[7]];
+              }
+           }
 
            for ( i = 0 ; i < DataLength ; i++,  BufPtr++)
            {
-              if (CFE_PSP_MemRead8((cpuaddr)BufPtr, &ByteValue) != CFE_PSP_SUCCESS)
+              if ( UsePSPRead == FALSE )
+              {
+                 ByteValue = *BufPtr;
+              }
+              else if (CFE_PSP_MemRead8((cpuaddr)BufPtr, &ByteValue) != CFE_PSP_SUCCESS)
               {
                  ByteValue = 0;
               }
-              Index = ( ( Crc ^ ByteValue) & 0x00FF);
-              Crc = ( (Crc >> 8 ) & 0x00FF) ^ CrcTable[Index];
+              Crc = (Crc >> 8) ^ CFE_ES_Crc16Table[0][(Crc ^ ByteValue) & 0xFF];
            }
+
+           /*
+           ** The CRC-16 has always been returned sign extended from 16 bits;
+           ** keep doing so, since CRCs already saved in the CDS and reported
+           ** for tables must still match.
+           */
+           Crc = (uint32)(int32)(int16)Crc;
            break;
 
       case CFE_ES_CRC_8:
@@ -1517,6 +1646,141 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, uint32 DataLength, uint32 InputC
 } /* End of CFE_ES_CalculateCRC() */
 
 
+/*
+** Function: CFE_ES_CrcRegister
+**
+** Purpose:  Convert a CRC returned by CFE_ES_CalculateCRC into the contents
+**           of the CRC register, which is linear in the data the CRC covers.
+**
+*/
+static uint32 CFE_ES_CrcRegister(uint32 Crc, uint32 TypeCRC)
+{
+    if (TypeCRC == CFE_ES_CRC_32)
+    {
+        return ~Crc;
+    }
+
+    return (Crc & 0xFFFF);
+
+} /* End of CFE_ES_CrcRegister() */
+
+
+/*
+** Function: CFE_ES_CrcFromRegister
+**
+** Purpose:  Convert the contents of the CRC register back into a CRC as
+**           CFE_ES_CalculateCRC returns it (and accepts it to continue a CRC).
+**
+*/
+static uint32 CFE_ES_CrcFromRegister(uint32 Register, uint32 TypeCRC)
+{
+    if (TypeCRC == CFE_ES_CRC_32)
+    {
+        return ~Register;
+    }
+
+    return (uint32)(int32)(int16)Register;
+
+} /* End of CFE_ES_CrcFromRegister() */
+
+
+/*
+** Function: CFE_ES_Gf2MatrixTimes
+**
+** Purpose:  Multiply a vector by a matrix over GF(2), where the matrix is
+**           held as one word per column.
+**
+*/
+static uint32 CFE_ES_Gf2MatrixTimes(const uint32 *Matrix, uint32 Vector)
+{
+    uint32 Sum = 0;
+
+    while (Vector != 0)
+    {
+        if (Vector & 1)
+        {
+            Sum ^= *Matrix;
+        }
+
+        Vector >>= 1;
+        Matrix++;
+    }
+
+    return Sum;
+
+} /* End of CFE_ES_Gf2MatrixTimes() */
+
+
+/*
+** Function: CFE_ES_UpdateCRC
+**
+** Purpose:  Update the CRC of a block of memory for a change to a range of it.
+**
+*/
+uint32 CFE_ES_UpdateCRC(uint32 BlockCRC, uint32 OldRangeCRC, uint32 NewRangeCRC,
+                        uint32 TailLength, uint32 TypeCRC)
+{
+    uint32  Width;
+    uint32  Op[32];
+    uint32  Square[32];
+    uint32  Register;
+    uint8   ZeroByte = 0;
+    uint32  i;
+
+    if (TypeCRC == CFE_ES_CRC_32)
+    {
+        Width = 32;
+    }
+    else if (TypeCRC == CFE_ES_CRC_16)
+    {
+        Width = 16;
+    }
+    else
+    {
+        /* CFE_ES_CalculateCRC gives zero for any other CRC type */
+        return 0;
+    }
+
+    /* The CRC register is linear in the data, so the block's register changes by */
+    /* the change in the range's register, carried through the rest of the block   */
+    /* as zeros.  Any starting value shared by both range CRCs cancels out.        */
+    Register = CFE_ES_CrcRegister(OldRangeCRC, TypeCRC) ^ CFE_ES_CrcRegister(NewRangeCRC, TypeCRC);
+
+    /* Column i of this operator is the register left by a zero byte shifted into a register holding only bit i */
+    for (i = 0; i < Width; i++)
+    {
+        Op[i] = CFE_ES_CrcRegister(CFE_ES_CalculateCRC(&ZeroByte, 1,
+                                                       CFE_ES_CrcFromRegister((uint32)1 << i, TypeCRC),
+                                                       TypeCRC), TypeCRC);
+    }
+
+    /* Apply the operator for each power of two zero bytes making up TailLength, */
+    /* so the number of steps only grows with the log of TailLength              */
+    while ((TailLength != 0) && (Register != 0))
+    {
+        if (TailLength & 1)
+        {
+            Register = CFE_ES_Gf2MatrixTimes(Op, Register);
+        }
+
+        TailLength >>= 1;
+
+        if (TailLength != 0)
+        {
+            for (i = 0; i < Width; i++)
+            {
+                Square[i] = CFE_ES_Gf2MatrixTimes(Op, Op[i]);
+            }
+
+            memcpy(Op, Square, Width * sizeof(uint32));
+        }
+    }
+
+    return CFE_ES_CrcFromRegister(CFE_ES_CrcRegister(BlockCRC, TypeCRC) ^ Register, TypeCRC);
+
+} /* End of CFE_ES_UpdateCRC() */
+
+
 /*
 ** Function: CFE_ES_RegisterCDS
 **
@@ -1612,6 +1876,21 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return Status;
 } /* End of CFE_ES_CopyToCDS() */
 
+/*
+** Function: CFE_ES_CopyToCDSRange
+**
+** Purpose:  Copies part of a data block to a Critical Data Store.
+**
+*/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, uint32 Offset, uint32 Length, const void *DataToCopy)
+{
+    int32 Status = CFE_SUCCESS;
+    
+    Status = CFE_ES_CDSBlockWriteRange(CFE_ES_Global.CDSVars.Registry[Handle].MemHandle, Offset, Length, DataToCopy);
+    
+    return Status;
+} /* End of CFE_ES_CopyToCDSRange() */
+
 /*
 ** Function: CFE_ES_RestoreFromCDS
 **
@@ -1818,6 +2097,44 @@ int32 CFE_ES_GetAppIDInternal(uint32 *AppIdPtr)
 } /* End of CFE_ES_GetAppIDInternal() */
 
 
+/*
+** Function: CFE_ES_BeginTaskRecordUpdate
+**
+** Purpose:  Mark a task table record as being changed, so that CFE_ES_GetAppID
+**           takes the Shared Data Mutex to read it.  The caller must hold the
+**           Shared Data Mutex, and call CFE_ES_EndTaskRecordUpdate once the
+**           record is changed.
+**
+*/
+void CFE_ES_BeginTaskRecordUpdate(uint32 TaskIndex)
+{
+   if ( TaskIndex < OS_MAX_TASKS )
+   {
+      CFE_ES_Global.TaskTable[TaskIndex].Generation++;
+      CFE_ATOMIC_BARRIER();
+   }
+
+} /* End of CFE_ES_BeginTaskRecordUpdate() */
+
+
+/*
+** Function: CFE_ES_EndTaskRecordUpdate
+**
+** Purpose:  Let CFE_ES_GetAppID read a task table record without the Shared
+**           Data Mutex again, after CFE_ES_BeginTaskRecordUpdate.
+**
+*/
+void CFE_ES_EndTaskRecordUpdate(uint32 TaskIndex)
+{
+   if ( TaskIndex < OS_MAX_TASKS )
+   {
+      CFE_ATOMIC_BARRIER();
+      CFE_ES_Global.TaskTable[TaskIndex].Generation++;
+   }
+
+} /* End of CFE_ES_EndTaskRecordUpdate() */
+
+
 /******************************************************************************
 **  Function:  CFE_ES_LockSharedData()
 **
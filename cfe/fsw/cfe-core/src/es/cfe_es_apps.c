@@ -712,6 +712,7 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
          */
          OS_ConvertToArrayIndex(CFE_ES_Global.AppTable[i].TaskInfo.MainTaskId, &TaskId);
 
+         CFE_ES_BeginTaskRecordUpdate(TaskId);
          if ( CFE_ES_Global.TaskTable[TaskId].RecordUsed == TRUE )
          {
             CFE_ES_WriteToSysLog("ES Startup: Error: ES_TaskTable slot in use at task creation!\n");
@@ -725,6 +726,8 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
          strncpy((char *)CFE_ES_Global.TaskTable[TaskId].TaskName,
              (char *)CFE_ES_Global.AppTable[i].TaskInfo.MainTaskName,OS_MAX_API_NAME );
          CFE_ES_Global.TaskTable[TaskId].TaskName[OS_MAX_API_NAME - 1]='\0';
+         CFE_ES_EndTaskRecordUpdate(TaskId);
+         CFE_SB_InvalidateSenderCache(CFE_ES_Global.TaskTable[TaskId].TaskId);
          CFE_ES_WriteToSysLog("ES Startup: %s loaded and created\n", AppName);
          *ApplicationIdPtr = i;
 
@@ -1525,9 +1528,13 @@ int32 CFE_ES_CleanupTaskResources(uint32 TaskId)
     /*
     ** Invalidate ES Task Table entry
     */
+    CFE_SB_InvalidateSenderCache(TaskId);
+    CFE_SB_ReleaseTaskBufCache(TaskId);
     if (OS_ConvertToArrayIndex(TaskId, &TaskId) == OS_SUCCESS)
     {
+       CFE_ES_BeginTaskRecordUpdate(TaskId);
        CFE_ES_Global.TaskTable[TaskId].RecordUsed = FALSE;
+       CFE_ES_EndTaskRecordUpdate(TaskId);
     }
 
     CFE_ES_Global.RegisteredTasks--;
@@ -1790,8 +1797,12 @@ int32 CFE_ES_CleanupTaskResources(uint32 TaskId)
     /*
     ** Invalidate ES Task Table entry
     */
+    CFE_ES_BeginTaskRecordUpdate(TaskId);
     CFE_ES_Global.TaskTable[TaskId].RecordUsed = FALSE;
+    CFE_ES_EndTaskRecordUpdate(TaskId);
     CFE_ES_Global.RegisteredTasks--;
+    CFE_SB_InvalidateSenderCache(TaskId);
+    CFE_SB_ReleaseTaskBufCache(TaskId);
     
     return(Result);
 
@@ -191,7 +191,7 @@ typedef struct
    uint32    TaskId;                          /* Task ID */
    uint32    ExecutionCounter;                /* The execution counter for the Child task */
    char      TaskName[OS_MAX_API_NAME];       /* Task Name */
-   
+   volatile uint32 Generation;                /* Odd while ES changes the record */
    
 } CFE_ES_TaskRecord_t;
 
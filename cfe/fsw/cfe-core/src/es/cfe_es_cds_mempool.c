@@ -60,6 +60,7 @@
 #include "cfe_es_cds_mempool.h"
 #include "cfe_es_global.h"
 #include <stdio.h>
+#include <string.h>
 
 /*****************************************************************************/
 /*
@@ -69,6 +70,14 @@
 #define CFE_ES_CDS_BLOCK_USED      0xaaaa
 #define CFE_ES_CDS_BLOCK_UNUSED    0xdddd
 
+#if (CFE_ES_DEFAULT_CRC == CFE_ES_CRC_32)
+#define CFE_ES_CDS_CRC_WIDTH       32
+#elif (CFE_ES_DEFAULT_CRC == CFE_ES_CRC_16)
+#define CFE_ES_CDS_CRC_WIDTH       16
+#else
+#define CFE_ES_CDS_CRC_WIDTH       0
+#endif
+
 /*****************************************************************************/
 /*
 ** Type Definitions
@@ -82,6 +91,11 @@
 CFE_ES_CDSPool_t      CFE_ES_CDSMemPool;
 CFE_ES_CDSBlockDesc_t CFE_ES_CDSBlockDesc;
 
+#if (CFE_ES_CDS_CRC_WIDTH > 0)
+/* Old contents of the range being changed by CFE_ES_CDSBlockWriteRange */
+static uint8 CFE_ES_CDSChunkBuffer[CFE_ES_CDS_CRC_CHUNK_SIZE];
+#endif
+
 uint32 CFE_ES_CDSMemPoolDefSize[CFE_ES_CDS_NUM_BLOCK_SIZES] = 
 {
     CFE_ES_CDS_MAX_BLOCK_SIZE,
@@ -563,6 +577,140 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSBlockHandle_t BlockHandle, void *DataToWrit
 }
 
 
+/*
+** Function:
+**   CFE_ES_CDSBlockWriteRange
+**
+** Purpose:
+**   Writes part of a CDS block.  Only the old contents of the range are
+**   read back from the CDS to update the block's CRC, and only the range
+**   itself and the block descriptor are written.  The CRC stays the plain
+**   CRC of the whole block that CFE_ES_CDSBlockWrite computes.
+*/
+int32 CFE_ES_CDSBlockWriteRange(CFE_ES_CDSBlockHandle_t BlockHandle, uint32 Offset,
+                                uint32 Length, const void *DataToWrite)
+{
+    int32  Status = CFE_SUCCESS;
+    int32  BinIndex = 0;
+#if (CFE_ES_CDS_CRC_WIDTH > 0)
+    uint32 OldCrc;
+    uint32 ChunkStart;
+    uint32 ChunkSize;
+#endif
+
+    /* Validate the handle before doing anything */
+    if ((BlockHandle < sizeof(CFE_ES_Global.CDSVars.ValidityField)) || 
+        (BlockHandle > (CFE_ES_CDSMemPool.End - sizeof(CFE_ES_CDSBlockDesc_t) - 
+                        CFE_ES_CDSMemPool.MinBlockSize - sizeof(CFE_ES_Global.CDSVars.ValidityField))))
+    {
+        CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Invalid Memory Handle.\n");
+        return(CFE_ES_ERR_MEM_HANDLE);
+    }
+
+    OS_MutSemTake(CFE_ES_CDSMemPool.MutexId);
+    
+    /* Get a copy of the block descriptor associated with the specified handle */
+    Status = CFE_PSP_ReadFromCDS(&CFE_ES_CDSBlockDesc, BlockHandle, sizeof(CFE_ES_CDSBlockDesc_t));
+    
+    if (Status != CFE_PSP_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Err reading from CDS (Stat=0x%08x)\n", (unsigned int)Status);
+        OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+        return Status;
+    }
+
+    /* Validate the block to make sure it is still active and not corrupted */
+    if ((CFE_ES_CDSBlockDesc.CheckBits != CFE_ES_CDS_CHECK_PATTERN) ||
+        (CFE_ES_CDSBlockDesc.AllocatedFlag != CFE_ES_CDS_BLOCK_USED))
+    {
+        CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Invalid Handle or Block Descriptor.\n");
+        OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+        return(CFE_ES_ERR_MEM_HANDLE);
+    }
+
+    BinIndex = CFE_ES_CDSGetBinIndex(CFE_ES_CDSBlockDesc.ActualSize);
+
+    /* Final sanity check on block descriptor, is the Actual size reasonable */
+    if (BinIndex < 0)
+    {
+        CFE_ES_CDSMemPool.CheckErrCntr++;
+        CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Invalid Block Descriptor\n");
+        OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+        return(CFE_ES_ERR_MEM_HANDLE);
+    }
+
+    /* The range must lie within the size specified when the CDS was created */
+    if ((Offset > CFE_ES_CDSBlockDesc.SizeUsed) ||
+        (Length > (CFE_ES_CDSBlockDesc.SizeUsed - Offset)))
+    {
+        CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Range %u+%u exceeds block size %u\n",
+                             (unsigned int)Offset, (unsigned int)Length,
+                             (unsigned int)CFE_ES_CDSBlockDesc.SizeUsed);
+        OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+        return(CFE_ES_BAD_ARGUMENT);
+    }
+
+#if (CFE_ES_CDS_CRC_WIDTH > 0)
+    /* The CRC of the range's old contents, read back a chunk at a time */
+    OldCrc = 0;
+    for (ChunkStart = 0; ChunkStart < Length; ChunkStart += ChunkSize)
+    {
+        ChunkSize = Length - ChunkStart;
+        if (ChunkSize > CFE_ES_CDS_CRC_CHUNK_SIZE)
+        {
+            ChunkSize = CFE_ES_CDS_CRC_CHUNK_SIZE;
+        }
+
+        Status = CFE_PSP_ReadFromCDS(CFE_ES_CDSChunkBuffer,
+                                     (BlockHandle + sizeof(CFE_ES_CDSBlockDesc_t) + Offset + ChunkStart), ChunkSize);
+        if (Status != CFE_PSP_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Err reading block from CDS (Stat=0x%08x) @Offset=0x%08x\n", 
+                                 (unsigned int)Status, (unsigned int)BlockHandle);
+            OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+            return Status;
+        }
+
+        OldCrc = CFE_ES_CalculateCRC(CFE_ES_CDSChunkBuffer, ChunkSize, OldCrc, CFE_ES_DEFAULT_CRC);
+    }
+
+    /* Only the range changes, so the block CRC is updated from the range's old and new CRCs */
+    CFE_ES_CDSBlockDesc.CRC = CFE_ES_UpdateCRC(CFE_ES_CDSBlockDesc.CRC, OldCrc,
+                                               CFE_ES_CalculateCRC(DataToWrite, Length, 0, CFE_ES_DEFAULT_CRC),
+                                               CFE_ES_CDSBlockDesc.SizeUsed - (Offset + Length),
+                                               CFE_ES_DEFAULT_CRC);
+#else
+    /* CFE_ES_CalculateCRC gives zero for any other CRC type, so the block CRC cannot change */
+#endif
+
+    /* Write the new block descriptor for the data coming from the Application */
+    Status = CFE_PSP_WriteToCDS(&CFE_ES_CDSBlockDesc, BlockHandle, sizeof(CFE_ES_CDSBlockDesc_t));
+    
+    if (Status == CFE_PSP_SUCCESS)
+    {
+        /* Write only the changed range to the CDS */
+        Status = CFE_PSP_WriteToCDS((void *)DataToWrite,
+                                    (BlockHandle + sizeof(CFE_ES_CDSBlockDesc_t) + Offset), Length);
+        
+        if (Status != CFE_PSP_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Err writing data to CDS (Stat=0x%08x) @Offset=0x%08x\n", 
+                                 (unsigned int)Status, (unsigned int)(BlockHandle + sizeof(CFE_ES_CDSBlockDesc_t) + Offset));
+        }
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("CFE_ES:CDSBlkWrRange-Err writing BlockDesc to CDS (Stat=0x%08x) @Offset=0x%08x\n", 
+              (unsigned int)Status, (unsigned int)BlockHandle);
+    }
+
+    OS_MutSemGive(CFE_ES_CDSMemPool.MutexId);
+    
+    return Status;
+}
+
+
+
 /*
 ** Function:
 **   CFE_ES_CDSBlockRead
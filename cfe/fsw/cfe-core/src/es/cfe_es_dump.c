@@ -0,0 +1,241 @@
+/*
+**  File:
+**    cfe_es_dump.c
+**
+**      Copyright (c) 2004-2012, United States government as represented by the
+**      administrator of the National Aeronautics Space Administration.
+**      All rights reserved. This software(cFE) was created at NASA's Goddard
+**      Space Flight Center pursuant to government contracts.
+**
+**      This is governed by the NASA Open Source Agreement and may be used,
+**      distributed and modified only pursuant to the terms of that agreement.
+**
+**  Purpose:
+**    This file implements the buffered writer used by the cFE Executive
+**    Services and Event Services to dump their logs to files.
+**
+**  References:
+**     Flight Software Branch C Coding Standard Version 1.0a
+**     cFE Flight Software Application Developers Guide
+**
+**  Notes:
+**    Records are collected in a buffer and written in
+**    CFE_ES_DUMP_BUFFER_SIZE byte writes instead of one write per record.
+**    Rather than sleeping a fixed time every few records, the writer only
+**    yields the processor once it has been writing for CFE_ES_DUMP_RUN_MSEC.
+**
+*/
+
+/*
+** Required header files.
+*/
+#include "private/cfe_private.h"
+#include "cfe_es.h"
+#include "cfe_psp.h"
+#include "osapi.h"
+
+#include <string.h>
+
+
+/*
+** Function: CFE_ES_ElapsedMsec
+**
+** Purpose:  Compute the milliseconds between two PSP times.
+**
+*/
+uint32 CFE_ES_ElapsedMsec(const OS_time_t *Start, const OS_time_t *Stop)
+{
+   uint32 Seconds;
+   uint32 Microsecs;
+
+   if ( Stop->seconds < Start->seconds )
+   {
+      /* Clock went backwards */
+      return 0;
+   }
+
+   Seconds = Stop->seconds - Start->seconds;
+   if ( Stop->microsecs >= Start->microsecs )
+   {
+      Microsecs = Stop->microsecs - Start->microsecs;
+   }
+   else if ( Seconds > 0 )
+   {
+      Seconds--;
+      Microsecs = (Stop->microsecs + 1000000) - Start->microsecs;
+   }
+   else
+   {
+      /* Clock went backwards */
+      Microsecs = 0;
+   }
+
+   return (Seconds * 1000) + (Microsecs / 1000);
+
+} /* End of CFE_ES_ElapsedMsec() */
+
+
+/*
+** Function: CFE_ES_DumpOutput
+**
+** Purpose:  Write one block of a dump to the file, then yield the processor
+**           if the dump has been writing for its full run time.
+**
+*/
+static int32 CFE_ES_DumpOutput(CFE_ES_DumpWriter_t *Writer, const void *Data, uint32 Size)
+{
+   int32     Status;
+   OS_time_t Now;
+
+   Status = OS_write(Writer->FileDescriptor, (void *)Data, Size);
+   if ( Status != (int32)Size )
+   {
+      Writer->Status      = CFE_ES_FILE_IO_ERR;
+      Writer->WriteSize   = Size;
+      Writer->WriteStatus = Status;
+      return CFE_ES_FILE_IO_ERR;
+   }
+
+   Writer->FileSize += Size;
+
+   CFE_PSP_GetTime(&Now);
+   if ( CFE_ES_ElapsedMsec(&Writer->RunStartTime, &Now) >= CFE_ES_DUMP_RUN_MSEC )
+   {
+      OS_TaskDelay(CFE_ES_DUMP_YIELD_MSEC);
+      CFE_PSP_GetTime(&Writer->RunStartTime);
+   }
+
+   return CFE_SUCCESS;
+
+} /* End of CFE_ES_DumpOutput() */
+
+
+/*
+** Function: CFE_ES_DumpInit
+**
+** Purpose:  Start a buffered dump to an open file.
+**
+*/
+void CFE_ES_DumpInit(CFE_ES_DumpWriter_t *Writer, int32 FileDescriptor)
+{
+   Writer->FileDescriptor = FileDescriptor;
+   Writer->Status         = CFE_SUCCESS;
+   Writer->WriteSize      = 0;
+   Writer->WriteStatus    = 0;
+   Writer->FileSize       = 0;
+   Writer->ElapsedMsec    = 0;
+   Writer->BytesPerSec    = 0;
+   Writer->BufferUsed     = 0;
+
+   CFE_PSP_GetTime(&Writer->StartTime);
+   Writer->RunStartTime = Writer->StartTime;
+
+} /* End of CFE_ES_DumpInit() */
+
+
+/*
+** Function: CFE_ES_DumpWrite
+**
+** Purpose:  Add data to a buffered dump.
+**
+*/
+int32 CFE_ES_DumpWrite(CFE_ES_DumpWriter_t *Writer, const void *Data, uint32 Size)
+{
+   const uint8 *DataPtr = (const uint8 *)Data;
+   uint32       CopySize;
+
+   while ( (Size > 0) && (Writer->Status == CFE_SUCCESS) )
+   {
+      if ( (Writer->BufferUsed == 0) && (Size >= CFE_ES_DUMP_BUFFER_SIZE) )
+      {
+         /*
+         ** Nothing to merge with, so write a full block straight from the
+         ** caller's memory instead of copying it first.
+         */
+         CopySize = CFE_ES_DUMP_BUFFER_SIZE;
+         CFE_ES_DumpOutput(Writer, DataPtr, CopySize);
+      }
+      else
+      {
+         CopySize = CFE_ES_DUMP_BUFFER_SIZE - Writer->BufferUsed;
+         if ( CopySize > Size )
+         {
+            CopySize = Size;
+         }
+
+         memcpy(&Writer->Buffer[Writer->BufferUsed], DataPtr, CopySize);
+         Writer->BufferUsed += CopySize;
+
+         if ( Writer->BufferUsed == CFE_ES_DUMP_BUFFER_SIZE )
+         {
+            Writer->BufferUsed = 0;
+            CFE_ES_DumpOutput(Writer, Writer->Buffer, CFE_ES_DUMP_BUFFER_SIZE);
+         }
+      }
+
+      DataPtr += CopySize;
+      Size    -= CopySize;
+   }
+
+   return Writer->Status;
+
+} /* End of CFE_ES_DumpWrite() */
+
+
+/*
+** Function: CFE_ES_DumpWriteRing
+**
+** Purpose:  Add data from a ring buffer to a buffered dump.
+**
+*/
+int32 CFE_ES_DumpWriteRing(CFE_ES_DumpWriter_t *Writer, const void *Ring, uint32 RingSize,
+                           uint32 Offset, uint32 Size)
+{
+   const uint8 *RingPtr = (const uint8 *)Ring;
+   uint32       FirstSize;
+
+   FirstSize = RingSize - Offset;
+   if ( FirstSize > Size )
+   {
+      FirstSize = Size;
+   }
+
+   CFE_ES_DumpWrite(Writer, &RingPtr[Offset], FirstSize);
+
+   return CFE_ES_DumpWrite(Writer, RingPtr, Size - FirstSize);
+
+} /* End of CFE_ES_DumpWriteRing() */
+
+
+/*
+** Function: CFE_ES_DumpFinish
+**
+** Purpose:  Write what is left of a buffered dump and compute its duration
+**           and throughput.
+**
+*/
+int32 CFE_ES_DumpFinish(CFE_ES_DumpWriter_t *Writer)
+{
+   OS_time_t Now;
+   uint32    Divisor;
+
+   if ( (Writer->Status == CFE_SUCCESS) && (Writer->BufferUsed > 0) )
+   {
+      CFE_ES_DumpOutput(Writer, Writer->Buffer, Writer->BufferUsed);
+   }
+   Writer->BufferUsed = 0;
+
+   CFE_PSP_GetTime(&Now);
+   Writer->ElapsedMsec = CFE_ES_ElapsedMsec(&Writer->StartTime, &Now);
+
+   /* A dump shorter than the clock resolution is reported as taking 1 ms */
+   Divisor = Writer->ElapsedMsec;
+   if ( Divisor == 0 )
+   {
+      Divisor = 1;
+   }
+   Writer->BytesPerSec = (uint32)(((uint64)Writer->FileSize * 1000) / Divisor);
+
+   return Writer->Status;
+
+} /* End of CFE_ES_DumpFinish() */
@@ -181,5 +181,16 @@ extern int32 CFE_ES_GetAppIDInternal(uint32 *AppIdPtr);
 extern void  CFE_ES_LockSharedData(const char *FunctionName, int32 LineNumber);
 extern void  CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber);
 
+/*
+** Functions used to change a task record that CFE_ES_GetAppID reads without the lock
+*/
+extern void  CFE_ES_BeginTaskRecordUpdate(uint32 TaskIndex);
+extern void  CFE_ES_EndTaskRecordUpdate(uint32 TaskIndex);
+
+/*
+** Function used to build the CRC lookup tables before any task calculates a CRC
+*/
+extern void  CFE_ES_SetupCRCTables(void);
+
 
 #endif
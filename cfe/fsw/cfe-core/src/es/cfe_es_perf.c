@@ -80,6 +80,7 @@
 #include "cfe_es_task.h"
 #include "cfe_fs.h"
 #include "cfe_psp.h"
+#include "private/cfe_atomic.h"
 #include <string.h>
 
 
@@ -89,6 +90,27 @@
 CFE_ES_PerfData_t      *Perf;
 CFE_ES_PerfLogDump_t    CFE_ES_PerfLogDumpStatus;
 
+/*
+** Writer used by the performance log dump child task
+*/
+static CFE_ES_DumpWriter_t CFE_ES_PerfDumpWriter;
+
+/*
+** Number of data entries handed to the writer at a time, so that
+** DataToWrite follows the progress of the dump
+*/
+#define CFE_ES_PERF_ENTRIES_PER_WRITE  (CFE_ES_DUMP_BUFFER_SIZE / sizeof(CFE_ES_PerfDataEntry_t))
+
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+/*
+** Latency histograms, the markers each task has open and the writer
+** used by the write histograms command
+*/
+static CFE_ES_PerfHist_t       CFE_ES_PerfHist[CFE_ES_PERF_MAX_IDS];
+static CFE_ES_PerfHistStack_t  CFE_ES_PerfHistStack[OS_MAX_TASKS];
+static CFE_ES_DumpWriter_t     CFE_ES_PerfHistWriter;
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /* Name: CFE_ES_SetupPerfVariables                                               */
 /*                                                                               */
@@ -151,11 +173,20 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
           Perf->MetaData.TriggerMask[i] = CFE_ES_PERF_TRIGMASK_INIT;
        }
 
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+       CFE_PSP_MemSet(Perf->Ring, 0, sizeof(Perf->Ring));
+#endif
+
     }
 
     CFE_ES_PerfLogDumpStatus.DataToWrite = 0;
     CFE_ES_PerfLogDumpStatus.ChildID = 0;
     CFE_ES_PerfLogDumpStatus.DataFileName[0] = '\0';
+
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+    CFE_PSP_MemSet(CFE_ES_PerfHist, 0, sizeof(CFE_ES_PerfHist));
+    CFE_PSP_MemSet(CFE_ES_PerfHistStack, 0, sizeof(CFE_ES_PerfHistStack));
+#endif
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -189,6 +220,10 @@ void CFE_ES_PerfStartDataCmd(CFE_SB_MsgPtr_t msg){
              Perf->MetaData.DataEnd = 0;
              Perf->MetaData.DataCount = 0;
              Perf->MetaData.InvalidMarkerReported = FALSE;
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+             CFE_PSP_MemSet(Perf->Ring, 0, sizeof(Perf->Ring));
+             CFE_ATOMIC_BARRIER();
+#endif
              Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
 
              CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_DEBUG,
@@ -236,6 +271,11 @@ void CFE_ES_PerfStopDataCmd(CFE_SB_MsgPtr_t Msg){
       {
           Perf->MetaData.State = CFE_ES_PERF_IDLE;
 
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+          /* fix the number of entries the file will hold */
+          CFE_ES_PerfRingSummary();
+#endif
+
           /* Copy out the string, using default if unspecified */
           CFE_SB_MessageStringGet(CFE_ES_PerfLogDumpStatus.DataFileName, CmdPtr->DataFileName,
                   CFE_ES_DEFAULT_PERF_DUMP_FILENAME, OS_MAX_PATH_LEN, sizeof(CmdPtr->DataFileName));
@@ -268,9 +308,9 @@ void CFE_ES_PerfStopDataCmd(CFE_SB_MsgPtr_t Msg){
                   /* Note: the file gets closed in the child task */
                   CFE_ES_TaskData.CmdCounter++;
                   CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID,CFE_EVS_DEBUG,
-                                    "Perf Stop Cmd Rcvd,%s will write %d entries.%dmS dly every %d entries",
+                                    "Perf Stop Cmd Rcvd,%s will write %d entries.%dmS dly every %dmS",
                                  CFE_ES_PERF_CHILD_NAME,(int)Perf->MetaData.DataCount,
-                                 (int)CFE_ES_PERF_CHILD_MS_DELAY,(int)CFE_ES_PERF_ENTRIES_BTWN_DLYS);
+                                 (int)CFE_ES_DUMP_YIELD_MSEC,(int)CFE_ES_DUMP_RUN_MSEC);
               }
               else
               {
@@ -297,6 +337,118 @@ void CFE_ES_PerfStopDataCmd(CFE_SB_MsgPtr_t Msg){
 } /* End of CFE_ES_PerfStopDataCmd() */
 
 
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfRingSummary()                                          */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Set the data count of the metadata to the number of entries held by the   */
+/*    per-task rings.  The file written from the rings starts with the oldest    */
+/*    entry, so the data start is always zero.                                   */
+/*                                                                               */
+/*  Arguments:                                                                   */
+/*    None                                                                       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfRingSummary(void){
+
+    uint32              i;
+    uint32              Next;
+    uint32              Count = 0;
+
+    for(i=0; i < CFE_ES_PERF_RING_COUNT; i++){
+      Next = CFE_ATOMIC_LOAD(&Perf->Ring[i].Next);
+      Count += (Next < CFE_ES_PERF_RING_SIZE) ? Next : CFE_ES_PERF_RING_SIZE;
+    }/* end for */
+
+    Perf->MetaData.DataCount = Count;
+    Perf->MetaData.DataStart = 0;
+    Perf->MetaData.DataEnd = Count % CFE_ES_PERF_DATA_BUFFER_SIZE;
+
+}/* end CFE_ES_PerfRingSummary */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfWriteRings()                                           */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Write the entries of the per-task rings to the performance data file,      */
+/*    oldest time stamp first, by repeatedly taking the oldest unwritten entry   */
+/*    at the head of any ring.                                                   */
+/*                                                                               */
+/*  Arguments:                                                                   */
+/*    DataCount - the number of entries to write                                 */
+/*                                                                               */
+/*  Assumptions and Notes:                                                       */
+/*    Entries are in time order within a ring unless tasks sharing the ring      */
+/*    preempt each other between claiming an entry and reading the timebase.    */
+/*    Markers added after the stop command are not written.                      */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfWriteRings(uint32 DataCount){
+
+    uint32                  Pos[CFE_ES_PERF_RING_COUNT];
+    uint32                  Left[CFE_ES_PERF_RING_COUNT];
+    uint32                  Next;
+    uint32                  i;
+    uint32                  Oldest;
+    CFE_ES_PerfDataEntry_t *EntryPtr;
+    CFE_ES_PerfDataEntry_t *OldestPtr;
+
+    for(i=0; i < CFE_ES_PERF_RING_COUNT; i++){
+      Next = CFE_ATOMIC_LOAD(&Perf->Ring[i].Next);
+      if(Next <= CFE_ES_PERF_RING_SIZE){
+        Pos[i]  = 0;
+        Left[i] = Next;
+      }else{
+        Pos[i]  = Next % CFE_ES_PERF_RING_SIZE;
+        Left[i] = CFE_ES_PERF_RING_SIZE;
+      }/* end if */
+    }/* end for */
+
+    while(DataCount > 0){
+
+      Oldest = CFE_ES_PERF_RING_COUNT;
+      OldestPtr = NULL;
+
+      for(i=0; i < CFE_ES_PERF_RING_COUNT; i++){
+        if(Left[i] > 0){
+          EntryPtr = &Perf->DataBuffer[(i * CFE_ES_PERF_RING_SIZE) + Pos[i]];
+          if((OldestPtr == NULL) ||
+             (EntryPtr->TimerUpper32 < OldestPtr->TimerUpper32) ||
+             ((EntryPtr->TimerUpper32 == OldestPtr->TimerUpper32) &&
+              (EntryPtr->TimerLower32 < OldestPtr->TimerLower32))){
+            Oldest = i;
+            OldestPtr = EntryPtr;
+          }/* end if */
+        }/* end if */
+      }/* end for */
+
+      if(Oldest == CFE_ES_PERF_RING_COUNT){
+        break;
+      }/* end if */
+
+      if(CFE_ES_DumpWrite(&CFE_ES_PerfDumpWriter, OldestPtr, sizeof(CFE_ES_PerfDataEntry_t)) != CFE_SUCCESS){
+        break;
+      }/* end if */
+
+      Pos[Oldest]++;
+      if(Pos[Oldest] >= CFE_ES_PERF_RING_SIZE){
+        Pos[Oldest] = 0;
+      }/* end if */
+      Left[Oldest]--;
+
+      DataCount--;
+      CFE_ES_PerfLogDumpStatus.DataToWrite--;
+
+    }/* end while */
+
+}/* end CFE_ES_PerfWriteRings */
+
+#endif
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*  Function:  CFE_ES_PerfLogDump()                                              */
 /*                                                                               */
@@ -310,8 +462,10 @@ void CFE_ES_PerfStopDataCmd(CFE_SB_MsgPtr_t Msg){
 void CFE_ES_PerfLogDump(void){
 
     int32               WriteStat;
+#if (CFE_ES_PERF_TASK_RINGS != TRUE)
     uint32              i;
-    uint32              FileSize;
+    uint32              Count;
+#endif
     CFE_FS_Header_t     FileHdr;
 
     CFE_ES_RegisterChildTask();
@@ -332,51 +486,59 @@ void CFE_ES_PerfLogDump(void){
         /* normally ExitChildTask() does not return, but it DOES under UT */
         return;
     }/* end if */
-    FileSize = WriteStat;
+
+    CFE_ES_DumpInit(&CFE_ES_PerfDumpWriter, CFE_ES_PerfLogDumpStatus.DataFileDescriptor);
 
     /* write the performance metadata to the file */
-    WriteStat = OS_write(CFE_ES_PerfLogDumpStatus.DataFileDescriptor,&Perf->MetaData,sizeof(CFE_ES_PerfMetaData_t));
-    if(WriteStat != sizeof(CFE_ES_PerfMetaData_t))
-    {
-        CFE_ES_FileWriteByteCntErr(&CFE_ES_PerfLogDumpStatus.DataFileName[0],
-                                   sizeof(CFE_ES_PerfMetaData_t),WriteStat);
-        OS_close(CFE_ES_PerfLogDumpStatus.DataFileDescriptor);
-        CFE_ES_ExitChildTask();
-        /* normally ExitChildTask() does not return, but it DOES under UT */
-        return;
-    }/* end if */
-    FileSize += WriteStat;
+    CFE_ES_DumpWrite(&CFE_ES_PerfDumpWriter, &Perf->MetaData, sizeof(CFE_ES_PerfMetaData_t));
 
     CFE_ES_PerfLogDumpStatus.DataToWrite = Perf->MetaData.DataCount;
 
-    /* write the collected data to the file */
-    for(i=0; i < Perf->MetaData.DataCount; i++){
-      WriteStat = OS_write (CFE_ES_PerfLogDumpStatus.DataFileDescriptor, &Perf->DataBuffer[i], sizeof(CFE_ES_PerfDataEntry_t));
-      if(WriteStat != sizeof(CFE_ES_PerfDataEntry_t))
-      {
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+
+    /* merge the rings into one buffer's worth of entries in time order */
+    CFE_ES_PerfWriteRings(Perf->MetaData.DataCount);
+
+#else
+
+    /* write the collected data to the file, a buffer full at a time */
+    for(i=0; i < Perf->MetaData.DataCount; i += Count){
+      Count = Perf->MetaData.DataCount - i;
+      if(Count > CFE_ES_PERF_ENTRIES_PER_WRITE){
+        Count = CFE_ES_PERF_ENTRIES_PER_WRITE;
+      }/* end if */
+      if(CFE_ES_DumpWrite(&CFE_ES_PerfDumpWriter, &Perf->DataBuffer[i],
+                          Count * sizeof(CFE_ES_PerfDataEntry_t)) != CFE_SUCCESS){
+        break;
+      }/* end if */
+      CFE_ES_PerfLogDumpStatus.DataToWrite -= Count;
+    }/* end for */
+
+#endif
+
+    if(CFE_ES_DumpFinish(&CFE_ES_PerfDumpWriter) != CFE_SUCCESS)
+    {
         CFE_ES_FileWriteByteCntErr(&CFE_ES_PerfLogDumpStatus.DataFileName[0],
-                                   sizeof(CFE_ES_PerfDataEntry_t),WriteStat);
+                                   CFE_ES_PerfDumpWriter.WriteSize,CFE_ES_PerfDumpWriter.WriteStatus);
         OS_close(CFE_ES_PerfLogDumpStatus.DataFileDescriptor);
         /* Reset the DataToWrite variable, so a new file can be written */
         CFE_ES_PerfLogDumpStatus.DataToWrite = 0;
         CFE_ES_ExitChildTask();
         /* normally ExitChildTask() does not return, but it DOES under UT */
         return;
-      }/* end if */
-      FileSize += WriteStat;
-      CFE_ES_PerfLogDumpStatus.DataToWrite--;
-      if((i % CFE_ES_PERF_ENTRIES_BTWN_DLYS) == 0){
-        OS_TaskDelay(CFE_ES_PERF_CHILD_MS_DELAY);
-      }/* end if */
+    }/* end if */
 
-    }/* end for */
+    /* the last entries may still have been in the buffer */
+    CFE_ES_PerfLogDumpStatus.DataToWrite = 0;
 
     OS_close(CFE_ES_PerfLogDumpStatus.DataFileDescriptor);
 
     CFE_EVS_SendEvent(CFE_ES_PERF_DATAWRITTEN_EID,CFE_EVS_DEBUG,
-                      "%s written:Size=%d,EntryCount=%d",
-                       &CFE_ES_PerfLogDumpStatus.DataFileName[0],(int)FileSize,
-                       (int)Perf->MetaData.DataCount);
+                      "%s written:Size=%d,EntryCount=%d,%dmS,%d B/s",
+                       &CFE_ES_PerfLogDumpStatus.DataFileName[0],
+                       (int)(sizeof(CFE_FS_Header_t) + CFE_ES_PerfDumpWriter.FileSize),
+                       (int)Perf->MetaData.DataCount,
+                       (int)CFE_ES_PerfDumpWriter.ElapsedMsec,(int)CFE_ES_PerfDumpWriter.BytesPerSec);
 
     CFE_ES_ExitChildTask();
 
@@ -456,6 +618,330 @@ void CFE_ES_PerfSetTriggerMaskCmd(CFE_SB_MsgPtr_t msg){
 } /* End of CFE_ES_PerfSetTriggerMaskCmd() */
 
 
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfHistPercentile                                               */
+/*                                                                               */
+/* Purpose: This function returns the first bucket at which the given percent    */
+/*          of the durations in a histogram have been counted.                   */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfHistPercentile(const CFE_ES_PerfHistRecord_t *Record, uint32 Percent)
+{
+    uint32      i;
+    uint64      Counted = 0;
+    uint64      Needed;
+
+    Needed = ((uint64)Record->Count * Percent) + 99;
+    Needed = Needed / 100;
+
+    for (i = 0; i < (CFE_ES_PERF_HIST_BUCKETS - 1); i++) {
+        Counted += Record->Bucket[i];
+        if (Counted >= Needed) {
+            break;
+        }
+    }
+
+    return i;
+
+}/* end CFE_ES_PerfHistPercentile */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                               */
+/* CFE_ES_WritePerfHistCmd() -- Write the performance histograms to a file       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_WritePerfHistCmd(CFE_SB_MsgPtr_t Msg){
+
+    uint16                     ExpectedLength = sizeof(CFE_ES_WritePerfHistCmd_t);
+    CFE_ES_WritePerfHistCmd_Payload_t *CmdPtr = (CFE_ES_WritePerfHistCmd_Payload_t *)&Msg->Byte[CFE_SB_CMD_HDR_SIZE];
+    CFE_FS_Header_t            FileHeader;
+    CFE_ES_PerfHistRecord_t    Record;
+    CFE_ES_PerfHist_t         *HistPtr;
+    char                       HistFilename[OS_MAX_PATH_LEN];
+    int32                      FileDescriptor;
+    int32                      Result;
+    uint32                     EntryCount = 0;
+    uint32                     Marker;
+    uint32                     i;
+
+    /*
+    ** Verify command packet length.
+    */
+    if (CFE_ES_VerifyCmdLength(Msg, ExpectedLength))
+    {
+       /*
+       ** Copy the commanded filename into local buffer to ensure size limitation and to allow for modification
+       */
+       CFE_SB_MessageStringGet(HistFilename, (char *)CmdPtr->HistFileName,
+               CFE_ES_DEFAULT_PERF_HIST_FILENAME, OS_MAX_PATH_LEN, sizeof(CmdPtr->HistFileName));
+
+       FileDescriptor = OS_creat(HistFilename, OS_WRITE_ONLY);
+       if (FileDescriptor < 0)
+       {
+           CFE_ES_TaskData.ErrCounter++;
+           CFE_EVS_SendEvent(CFE_ES_PERF_HIST_ERR_EID, CFE_EVS_ERROR,
+                 "Error creating file %s, RC = 0x%08X",
+                 HistFilename, (unsigned int)FileDescriptor);
+           return;
+       }/* end if */
+
+       CFE_FS_InitHeader(&FileHeader, CFE_ES_PERF_HIST_DESC, CFE_FS_ES_PERFHIST_SUBTYPE);
+
+       Result = CFE_FS_WriteHeader(FileDescriptor, &FileHeader);
+       if (Result != sizeof(CFE_FS_Header_t))
+       {
+           OS_close(FileDescriptor);
+           CFE_ES_TaskData.ErrCounter++;
+           CFE_ES_FileWriteByteCntErr(HistFilename, sizeof(CFE_FS_Header_t), Result);
+           return;
+       }/* end if */
+
+       CFE_ES_DumpInit(&CFE_ES_PerfHistWriter, FileDescriptor);
+
+       /*
+       ** Tasks keep updating the histograms while they are copied, so a
+       ** record may count a duration that is not yet in its sum or buckets.
+       */
+       for (Marker = 0; Marker < CFE_ES_PERF_MAX_IDS; Marker++)
+       {
+          HistPtr = &CFE_ES_PerfHist[Marker];
+
+          if (CFE_ATOMIC_LOAD(&HistPtr->Count) == 0)
+          {
+             continue;
+          }
+
+          Record.PerfId              = Marker;
+          Record.TimerTicksPerSecond = Perf->MetaData.TimerTicksPerSecond;
+          Record.Count               = CFE_ATOMIC_LOAD(&HistPtr->Count);
+          Record.MinTicks            = ~CFE_ATOMIC_LOAD(&HistPtr->MinTicksInverted);
+          Record.MaxTicks            = CFE_ATOMIC_LOAD(&HistPtr->MaxTicks);
+          Record.SumTicksUpper32     = (uint32)(HistPtr->SumTicks >> 32);
+          Record.SumTicksLower32     = (uint32)HistPtr->SumTicks;
+
+          for (i = 0; i < CFE_ES_PERF_HIST_BUCKETS; i++)
+          {
+             Record.Bucket[i] = CFE_ATOMIC_LOAD(&HistPtr->Bucket[i]);
+          }
+
+          Record.P50Bucket = CFE_ES_PerfHistPercentile(&Record, 50);
+          Record.P99Bucket = CFE_ES_PerfHistPercentile(&Record, 99);
+
+          if (CFE_ES_DumpWrite(&CFE_ES_PerfHistWriter, &Record, sizeof(Record)) != CFE_SUCCESS)
+          {
+             break;
+          }
+
+          EntryCount++;
+
+       }/* end for */
+
+       Result = CFE_ES_DumpFinish(&CFE_ES_PerfHistWriter);
+       OS_close(FileDescriptor);
+
+       if (Result != CFE_SUCCESS)
+       {
+           CFE_ES_TaskData.ErrCounter++;
+           CFE_ES_FileWriteByteCntErr(HistFilename, CFE_ES_PerfHistWriter.WriteSize,
+                                      CFE_ES_PerfHistWriter.WriteStatus);
+           return;
+       }/* end if */
+
+       /*
+       ** Clearing is not synchronized with the tasks, so a duration being
+       ** added at the same time may be partly kept.
+       */
+       if (CmdPtr->ClearHistograms != FALSE)
+       {
+           CFE_PSP_MemSet(CFE_ES_PerfHist, 0, sizeof(CFE_ES_PerfHist));
+       }/* end if */
+
+       CFE_ES_TaskData.CmdCounter++;
+       CFE_EVS_SendEvent(CFE_ES_PERF_HIST_EID, CFE_EVS_DEBUG,
+                         "%s written:Perf IDs=%d,Size=%d,%dmS,%d B/s",
+                         HistFilename, (int)EntryCount,
+                         (int)(sizeof(CFE_FS_Header_t) + CFE_ES_PerfHistWriter.FileSize),
+                         (int)CFE_ES_PerfHistWriter.ElapsedMsec, (int)CFE_ES_PerfHistWriter.BytesPerSec);
+
+    } /* end if verify command length */
+
+} /* End of CFE_ES_WritePerfHistCmd() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfHistAdd                                                      */
+/*                                                                               */
+/* Purpose: This function times the calling task's entry/exit marker pairs and   */
+/*          adds each duration to the histogram of its performance ID.           */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Each OS task has its own stack of open markers, which only that task         */
+/*  touches.  An exit pops its marker and any markers entered after it that      */
+/*  were never exited.  Exits with no matching entry, and entries beyond         */
+/*  CFE_ES_PERF_HIST_NEST_DEPTH, are not timed.  Callers that are not OS tasks   */
+/*  are not timed either.                                                        */
+/*                                                                               */
+/*  Bucket 0 holds durations under 2 ticks and bucket N holds durations from     */
+/*  2^N up to 2^(N+1) ticks.  The histogram itself is shared by every task       */
+/*  using the marker and is only updated with atomic operations.                 */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfHistAdd(uint32 Marker, uint32 EntryExit)
+{
+    uint32                  TaskId;
+    uint32                  TaskIdx;
+    uint32                  TimerUpper32;
+    uint32                  TimerLower32;
+    uint32                  Depth;
+    uint32                  Rollover;
+    uint32                  Ticks;
+    uint32                  TicksInverted;
+    uint32                  BucketIdx;
+    uint32                  Shift;
+    uint64                  Elapsed;
+    CFE_ES_PerfHistStack_t *StackPtr;
+    CFE_ES_PerfHistOpen_t  *OpenPtr;
+    CFE_ES_PerfHist_t      *HistPtr;
+
+    CFE_PSP_Get_Timebase(&TimerUpper32, &TimerLower32);
+
+    TaskId = OS_TaskGetId();
+    if ((OS_ConvertToArrayIndex(TaskId, &TaskIdx) != OS_SUCCESS) || (TaskIdx >= OS_MAX_TASKS)) {
+        return;
+    }
+
+    StackPtr = &CFE_ES_PerfHistStack[TaskIdx];
+
+    /* a new task in this slot starts with nothing open */
+    if (StackPtr->TaskId != TaskId) {
+        StackPtr->TaskId = TaskId;
+        StackPtr->Depth = 0;
+    }
+
+    /* CFE_ES_PerfLogEntry */
+    if (EntryExit == 0) {
+
+        if (StackPtr->Depth < CFE_ES_PERF_HIST_NEST_DEPTH) {
+            OpenPtr = &StackPtr->Open[StackPtr->Depth];
+            OpenPtr->Marker = Marker;
+            OpenPtr->TimerUpper32 = TimerUpper32;
+            OpenPtr->TimerLower32 = TimerLower32;
+            StackPtr->Depth++;
+        }
+        return;
+    }
+
+    /* find the most recent entry for this marker */
+    Depth = StackPtr->Depth;
+    while ((Depth > 0) && (StackPtr->Open[Depth - 1].Marker != Marker)) {
+        Depth--;
+    }
+
+    if (Depth == 0) {
+        return;
+    }
+
+    OpenPtr = &StackPtr->Open[Depth - 1];
+    StackPtr->Depth = Depth - 1;
+
+    /* a rollover of 0 means the lower 32 bits use their full range */
+    Rollover = Perf->MetaData.TimerLow32Rollover;
+    if (Rollover == 0) {
+        Elapsed = (uint64)(TimerUpper32 - OpenPtr->TimerUpper32) << 32;
+    } else {
+        Elapsed = (uint64)(TimerUpper32 - OpenPtr->TimerUpper32) * Rollover;
+    }
+    Elapsed = Elapsed + TimerLower32 - OpenPtr->TimerLower32;
+
+    if (Elapsed > 0xFFFFFFFF) {
+        Ticks = 0xFFFFFFFF;
+    } else {
+        Ticks = (uint32)Elapsed;
+    }
+
+    /* floor(log2(Ticks)), with 0 and 1 both in bucket 0 */
+    BucketIdx = 0;
+    for (Shift = 16; Shift > 0; Shift = Shift / 2) {
+        if ((Ticks >> (BucketIdx + Shift)) != 0) {
+            BucketIdx += Shift;
+        }
+    }
+
+    HistPtr = &CFE_ES_PerfHist[Marker];
+    TicksInverted = ~Ticks;
+
+    CFE_ATOMIC_ADD(&HistPtr->SumTicks, Elapsed);
+    CFE_ATOMIC_INC(&HistPtr->Bucket[BucketIdx]);
+    CFE_ATOMIC_RAISE_PEAK(&HistPtr->MaxTicks, Ticks);
+    CFE_ATOMIC_RAISE_PEAK(&HistPtr->MinTicksInverted, TicksInverted);
+    CFE_ATOMIC_INC(&HistPtr->Count);
+
+}/* end CFE_ES_PerfHistAdd */
+
+#endif
+
+
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfRingAdd                                                      */
+/*                                                                               */
+/* Purpose: This function adds a new entry to the ring of the calling task.      */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  The ring is chosen by the OS task index of the caller; callers that are not  */
+/*  OS tasks use ring 0.  An entry is claimed by atomically incrementing the     */
+/*  ring's Next count, so tasks sharing a ring never lock each other out, and    */
+/*  tasks on different rings share nothing until the trigger fires.  Once it     */
+/*  has, every entry also increments the shared TriggerCount.                    */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfRingAdd(uint32 Marker, uint32 EntryExit)
+{
+    uint32                  TaskIdx;
+    uint32                  RingIdx;
+    uint32                  Pos;
+    uint32                  TriggerCount;
+    CFE_ES_PerfDataEntry_t *EntryPtr;
+
+    if (OS_ConvertToArrayIndex(OS_TaskGetId(), &TaskIdx) != OS_SUCCESS) {
+        TaskIdx = 0;
+    }
+    RingIdx = TaskIdx % CFE_ES_PERF_RING_COUNT;
+
+    Pos = CFE_ATOMIC_INC(&Perf->Ring[RingIdx].Next) - 1;
+    EntryPtr = &Perf->DataBuffer[(RingIdx * CFE_ES_PERF_RING_SIZE) + (Pos % CFE_ES_PERF_RING_SIZE)];
+
+    EntryPtr->Data = (Marker | (EntryExit << CFE_ES_PERF_EXIT_BIT));
+    CFE_PSP_Get_Timebase((uint32*)&EntryPtr->TimerUpper32,(uint32*)&EntryPtr->TimerLower32);
+
+    /* waiting for trigger, only one task moves the state on */
+    if ((CFE_ATOMIC_LOAD(&Perf->MetaData.State) == CFE_ES_PERF_WAITING_FOR_TRIGGER) &&
+        (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))) {
+        CFE_ATOMIC_CAS(&Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER, CFE_ES_PERF_TRIGGERED);
+    }
+
+    /* triggered */
+    if (CFE_ATOMIC_LOAD(&Perf->MetaData.State) == CFE_ES_PERF_TRIGGERED) {
+
+        TriggerCount = CFE_ATOMIC_INC(&Perf->MetaData.TriggerCount);
+
+        if (((Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START) &&
+             (TriggerCount >= CFE_ES_PERF_DATA_BUFFER_SIZE)) ||
+            ((Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER) &&
+             (TriggerCount >= CFE_ES_PERF_DATA_BUFFER_SIZE / 2)) ||
+            (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)) {
+
+            Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        }
+    }
+}/* end CFE_ES_PerfRingAdd */
+
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /* Name: CFE_ES_PerfLogAdd                                                       */
 /*                                                                               */
@@ -481,7 +967,16 @@ void CFE_ES_PerfSetTriggerMaskCmd(CFE_SB_MsgPtr_t msg){
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
+#if (CFE_ES_PERF_TASK_RINGS != TRUE)
     int32         IntFlags;
+#endif
+
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+    /* histograms are kept whether or not data is being collected */
+    if (Marker < CFE_ES_PERF_MAX_IDS) {
+        CFE_ES_PerfHistAdd(Marker, EntryExit);
+    }
+#endif
 
     if (Perf->MetaData.State != CFE_ES_PERF_IDLE) {
 
@@ -503,6 +998,12 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
         /* is this id filtered */
         if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker)) {
 
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+
+            CFE_ES_PerfRingAdd(Marker, EntryExit);
+
+#else
+
            /* disable interrupts to guarentee exclusive access to the data structures */
             IntFlags = OS_IntLock();
 
@@ -556,6 +1057,8 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
             /* enable interrupts */
             OS_IntUnlock(IntFlags);
+
+#endif
         }
     }
 }/* end CFE_ES_PerfLogAdd */
@@ -102,5 +102,41 @@ typedef struct {
 
 extern CFE_ES_PerfLogDump_t    CFE_ES_PerfLogDumpStatus;
 
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+extern void CFE_ES_PerfRingSummary(void);
+#endif
+
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+
+/*
+** Latency histogram kept for each performance ID.  The minimum is stored
+** inverted so that, like the maximum, it only ever has to be raised and
+** a zeroed histogram needs no other initialization.
+*/
+typedef struct {
+    uint32                         Count;
+    uint32                         MinTicksInverted;
+    uint32                         MaxTicks;
+    uint64                         SumTicks;
+    uint32                         Bucket[CFE_ES_PERF_HIST_BUCKETS];
+} CFE_ES_PerfHist_t;
+
+/*
+** Markers a task has entered and not yet exited, with their entry times
+*/
+typedef struct {
+    uint32                         Marker;
+    uint32                         TimerUpper32;
+    uint32                         TimerLower32;
+} CFE_ES_PerfHistOpen_t;
+
+typedef struct {
+    uint32                         TaskId;
+    uint32                         Depth;
+    CFE_ES_PerfHistOpen_t          Open[CFE_ES_PERF_HIST_NEST_DEPTH];
+} CFE_ES_PerfHistStack_t;
+
+#endif
+
 #endif /* _cfe_es_perf_ */
 
@@ -185,6 +185,11 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    */
    CFE_ES_SetupPerfVariables(StartType);
 
+   /*
+   ** Build the CRC tables while ES is the only task running
+   */
+   CFE_ES_SetupCRCTables();
+
    /*
    ** Announce the startup
    */
@@ -889,6 +894,7 @@ void  CFE_ES_CreateObjects(void)
                   /*
                   ** Allocate and populate the CFE_ES_Global.TaskTable entry
                   */
+                  CFE_ES_BeginTaskRecordUpdate(TaskIndex);
                   if ( CFE_ES_Global.TaskTable[TaskIndex].RecordUsed == TRUE )
                   {
                      CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Global.TaskTable record used error for App: %s, continuing.\n",
@@ -902,6 +908,8 @@ void  CFE_ES_CreateObjects(void)
                   CFE_ES_Global.TaskTable[TaskIndex].TaskId = CFE_ES_Global.AppTable[j].TaskInfo.MainTaskId;
                   strncpy((char *)CFE_ES_Global.TaskTable[TaskIndex].TaskName, (char *)CFE_ES_Global.AppTable[j].TaskInfo.MainTaskName, OS_MAX_API_NAME);
                   CFE_ES_Global.TaskTable[TaskIndex].TaskName[OS_MAX_API_NAME - 1] = '\0';
+                  CFE_ES_EndTaskRecordUpdate(TaskIndex);
+                  CFE_SB_InvalidateSenderCache(CFE_ES_Global.TaskTable[TaskIndex].TaskId);
 
                   CFE_ES_WriteToSysLog("ES Startup: Core App: %s created. App ID: %d\n",
                                        CFE_ES_ObjectTable[i].ObjectName,j);
@@ -166,6 +166,11 @@
 */
 CFE_ES_TaskData_t CFE_ES_TaskData;
 
+/*
+** Writer used by the ES task to dump the System Log and the ER Log.
+*/
+static CFE_ES_DumpWriter_t CFE_ES_LogDumpWriter;
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_ES_TaskMain() -- Task entry point and main process loop     */
@@ -588,6 +593,12 @@ void CFE_ES_TaskPipe(CFE_SB_MsgPtr_t Msg)
                     CFE_ES_PerfSetTriggerMaskCmd(Msg);
                     break;
 
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+                case CFE_ES_WRITE_PERF_HIST_CC:
+                    CFE_ES_WritePerfHistCmd(Msg);
+                    break;
+#endif
+
                 case CFE_ES_RESET_PR_COUNT_CC:
                     CFE_ES_ResetPRCountCmd(Msg);
                     break;
@@ -669,6 +680,13 @@ void CFE_ES_HousekeepingCmd(CFE_SB_MsgPtr_t Msg)
     CFE_ES_TaskData.HkPacket.Payload.PerfState = CFE_ES_ResetDataPtr->Perf.MetaData.State;
     CFE_ES_TaskData.HkPacket.Payload.PerfMode = CFE_ES_ResetDataPtr->Perf.MetaData.Mode;
     CFE_ES_TaskData.HkPacket.Payload.PerfTriggerCount = CFE_ES_ResetDataPtr->Perf.MetaData.TriggerCount;
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+    /* once collection stops the count is fixed for the data file */
+    if (CFE_ES_ResetDataPtr->Perf.MetaData.State != CFE_ES_PERF_IDLE)
+    {
+        CFE_ES_PerfRingSummary();
+    }
+#endif
     CFE_ES_TaskData.HkPacket.Payload.PerfDataStart = CFE_ES_ResetDataPtr->Perf.MetaData.DataStart;
     CFE_ES_TaskData.HkPacket.Payload.PerfDataEnd = CFE_ES_ResetDataPtr->Perf.MetaData.DataEnd;
     CFE_ES_TaskData.HkPacket.Payload.PerfDataCount = CFE_ES_ResetDataPtr->Perf.MetaData.DataCount;
@@ -1671,23 +1689,25 @@ int32 CFE_ES_SysLogDump(const char *Filename)
 
     /* need to take semaphore here */
 
-    WriteStat = OS_write(fd,CFE_ES_ResetDataPtr->SystemLog,CFE_ES_SYSTEM_LOG_SIZE);
-    if(WriteStat != CFE_ES_SYSTEM_LOG_SIZE)
+    CFE_ES_DumpInit(&CFE_ES_LogDumpWriter, fd);
+    CFE_ES_DumpWrite(&CFE_ES_LogDumpWriter, CFE_ES_ResetDataPtr->SystemLog, CFE_ES_SYSTEM_LOG_SIZE);
+    if(CFE_ES_DumpFinish(&CFE_ES_LogDumpWriter) != CFE_SUCCESS)
     {
-        CFE_ES_FileWriteByteCntErr(Filename,CFE_ES_SYSTEM_LOG_SIZE,WriteStat);
+        CFE_ES_FileWriteByteCntErr(Filename,CFE_ES_LogDumpWriter.WriteSize,CFE_ES_LogDumpWriter.WriteStatus);
         OS_close(fd);
         return CFE_ES_FILE_IO_ERR;
     }/* end if */
 
     /* need to release the semaphore here */
 
-    FileSize += WriteStat;    
+    FileSize += CFE_ES_LogDumpWriter.FileSize;
     
     OS_close(fd);
 
     CFE_EVS_SendEvent(CFE_ES_SYSLOG2_EID, CFE_EVS_DEBUG,
-                      "%s written:Size=%d,Entries=%d",Filename,(int)FileSize,
-                      (int)CFE_ES_TaskData.HkPacket.Payload.SysLogEntries);
+                      "%s written:Size=%d,Entries=%d,%dmS,%d B/s",Filename,(int)FileSize,
+                      (int)CFE_ES_TaskData.HkPacket.Payload.SysLogEntries,
+                      (int)CFE_ES_LogDumpWriter.ElapsedMsec,(int)CFE_ES_LogDumpWriter.BytesPerSec);
 
     return CFE_SUCCESS;
 
@@ -1805,7 +1825,7 @@ int32 CFE_ES_ERLogDump(const char *Filename)
 
     int32   fd;
     int32   WriteStat,BspStat;
-    uint32  FileSize,i,ResetAreaSize;
+    uint32  FileSize,ResetAreaSize;
     CFE_FS_Header_t FileHdr;
     cpuaddr ResetDataAddr;
     
@@ -1840,24 +1860,23 @@ int32 CFE_ES_ERLogDump(const char *Filename)
         return CFE_ES_RST_ACCESS_ERR;        
     }/* end if */
 
-    /* write a single ER log entry on each pass */
-    for(i=0;i<CFE_ES_ER_LOG_ENTRIES;i++)
+    /* the ER log entries are contiguous, so they are written as one block */
+    CFE_ES_DumpInit(&CFE_ES_LogDumpWriter, fd);
+    CFE_ES_DumpWrite(&CFE_ES_LogDumpWriter, (uint8 *)ResetDataAddr,
+                     CFE_ES_ER_LOG_ENTRIES * sizeof(CFE_ES_ERLog_t));
+    if(CFE_ES_DumpFinish(&CFE_ES_LogDumpWriter) != CFE_SUCCESS)
     {
-        WriteStat = OS_write(fd,(uint8 *)ResetDataAddr,sizeof(CFE_ES_ERLog_t));
-        if(WriteStat != sizeof(CFE_ES_ERLog_t))
-        {
-            CFE_ES_FileWriteByteCntErr(Filename,sizeof(CFE_ES_ERLog_t),WriteStat);
-            OS_close(fd);
-            return CFE_ES_FILE_IO_ERR;        
-        }/* end if */        
-        FileSize += WriteStat;
-        ResetDataAddr+=sizeof(CFE_ES_ERLog_t);
-    }/* end for */   
+        CFE_ES_FileWriteByteCntErr(Filename,CFE_ES_LogDumpWriter.WriteSize,CFE_ES_LogDumpWriter.WriteStatus);
+        OS_close(fd);
+        return CFE_ES_FILE_IO_ERR;        
+    }/* end if */        
+    FileSize += CFE_ES_LogDumpWriter.FileSize;
     
     OS_close(fd);
 
     CFE_EVS_SendEvent(CFE_ES_ERLOG2_EID, CFE_EVS_DEBUG,
-                      "%s written:Size=%d",Filename,(int)FileSize);
+                      "%s written:Size=%d,%dmS,%d B/s",Filename,(int)FileSize,
+                      (int)CFE_ES_LogDumpWriter.ElapsedMsec,(int)CFE_ES_LogDumpWriter.BytesPerSec);
 
     return CFE_SUCCESS;
 
@@ -93,6 +93,7 @@
 #define CFE_ES_APP_LOG_DESC    "ES Application Info file"
 #define CFE_ES_ER_LOG_DESC     "ES ERlog data file"
 #define CFE_ES_PERF_LOG_DESC   "ES Performance data file"
+#define CFE_ES_PERF_HIST_DESC  "ES Performance histogram file"
 
 /*************************************************************************/
 /*
@@ -189,6 +190,7 @@ void CFE_ES_PerfStartDataCmd(CFE_SB_MsgPtr_t Msg);
 void CFE_ES_PerfStopDataCmd(CFE_SB_MsgPtr_t Msg);
 void CFE_ES_PerfSetFilterMaskCmd(CFE_SB_MsgPtr_t Msg);
 void CFE_ES_PerfSetTriggerMaskCmd(CFE_SB_MsgPtr_t Msg);
+void CFE_ES_WritePerfHistCmd(CFE_SB_MsgPtr_t Msg);
 void CFE_ES_TlmPoolStatsCmd(CFE_SB_MsgPtr_t Msg);
 void CFE_ES_DumpCDSRegCmd( const CFE_SB_Msg_t *MessagePtr );
 boolean CFE_ES_ValidateHandle(CFE_ES_MemHandle_t  Handle);
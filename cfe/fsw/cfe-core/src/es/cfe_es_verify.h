@@ -376,5 +376,63 @@
     #error CFE_ES_CDS_MEM_BLOCK_SIZE_16 must be less than CFE_ES_CDS_MAX_BLOCK_SIZE
 #endif
 
+#if CFE_ES_CDS_CRC_CHUNK_SIZE < 1
+    #error CFE_ES_CDS_CRC_CHUNK_SIZE must be greater than zero!
+#endif
+
+#if CFE_ES_CDS_CRC_CHUNK_SIZE > CFE_ES_CDS_MAX_BLOCK_SIZE
+    #error CFE_ES_CDS_CRC_CHUNK_SIZE must not be larger than CFE_ES_CDS_MAX_BLOCK_SIZE!
+#endif
+
+#if CFE_ES_DUMP_BUFFER_SIZE < 512
+    #error CFE_ES_DUMP_BUFFER_SIZE must be at least 512 bytes!
+#endif
+
+#if CFE_ES_DUMP_RUN_MSEC < 1
+    #error CFE_ES_DUMP_RUN_MSEC must be greater than zero!
+#endif
+
+/*
+** Validate lock-free memory pool configuration
+*/
+#if (CFE_ES_LOCKLESS_POOLS != TRUE) && (CFE_ES_LOCKLESS_POOLS != FALSE)
+    #error CFE_ES_LOCKLESS_POOLS must be either TRUE or FALSE!
+#endif
+
+#if (CFE_ES_LOCKLESS_POOLS == TRUE) && !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+    #error CFE_ES_LOCKLESS_POOLS requires a toolchain with an 8 byte GCC compare-and-swap builtin!
+#endif
+
+/*
+** Validate per-task performance data ring configuration
+*/
+#if (CFE_ES_PERF_TASK_RINGS != TRUE) && (CFE_ES_PERF_TASK_RINGS != FALSE)
+    #error CFE_ES_PERF_TASK_RINGS must be either TRUE or FALSE!
+#endif
+
+#if (CFE_ES_PERF_TASK_RINGS == TRUE) && !defined(__GNUC__)
+    #error CFE_ES_PERF_TASK_RINGS requires a toolchain with the GCC atomic builtins!
+#endif
+
+#if CFE_ES_PERF_RING_COUNT < 1
+    #error CFE_ES_PERF_RING_COUNT must be at least 1!
+#endif
+
+#if (CFE_ES_PERF_DATA_BUFFER_SIZE % CFE_ES_PERF_RING_COUNT) != 0
+    #error CFE_ES_PERF_DATA_BUFFER_SIZE must be a multiple of CFE_ES_PERF_RING_COUNT!
+#endif
+
+#if (CFE_ES_PERF_HISTOGRAMS != TRUE) && (CFE_ES_PERF_HISTOGRAMS != FALSE)
+    #error CFE_ES_PERF_HISTOGRAMS must be either TRUE or FALSE!
+#endif
+
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE) && !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+    #error CFE_ES_PERF_HISTOGRAMS requires a toolchain with an 8 byte GCC atomic add builtin!
+#endif
+
+#if CFE_ES_PERF_HIST_NEST_DEPTH < 1
+    #error CFE_ES_PERF_HIST_NEST_DEPTH must be at least 1!
+#endif
+
 #endif /* _cfe_es_verify_ */
 /*****************************************************************************/
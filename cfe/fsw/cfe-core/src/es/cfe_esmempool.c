@@ -74,6 +74,7 @@
 #include "cfe_esmempool.h"
 #include "cfe_es.h"
 #include "cfe_es_task.h"
+#include "private/cfe_atomic.h"
 #include <stdio.h>
 
 /*****************************************************************************/
@@ -83,6 +84,26 @@
 #define CFE_ES_CHECK_PATTERN           0x5a5a
 #define CFE_ES_MEMORY_ALLOCATED        0xaaaa
 #define CFE_ES_MEMORY_DEALLOCATED      0xdddd
+
+#define CFE_ES_POOL_MODE_FIXED         0
+#define CFE_ES_POOL_MODE_BUDDY         1
+#define CFE_ES_POOL_MODE_LOCKLESS      2
+
+/*
+** Buddy mode: a free block keeps the pointer to the previous free block of
+** its size just after its descriptor, so it can be unlinked from the middle
+** of its list when its buddy is freed.
+*/
+#define CFE_ES_BUDDY_PREV(BdPtr)       (*(BD_t **)((BdPtr) + 1))
+
+/*
+** Lock-free mode: the top of a free list holds the offset of the first block
+** from the pool start in its low word and a count of the changes made to the
+** list in its high word, so a pop cannot succeed on a list that was popped
+** and pushed back to the same block in the meantime.
+*/
+#define CFE_ES_LIST_OFFSET(Top)        ((uint32)((Top) & 0xFFFFFFFF))
+#define CFE_ES_LIST_NEXT_TAG(Top)      (((Top) & ~((uint64)0xFFFFFFFF)) + ((uint64)1 << 32))
 /*****************************************************************************/
 /*
 ** Type Definitions
@@ -115,6 +136,15 @@ uint32 CFE_ES_MemPoolDefSize[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES] =
 ** Local Function Prototypes
 */
 uint32 CFE_ES_GetBlockSize(Pool_t  *PoolPtr, uint32 Size);
+uint32 CFE_ES_GetBlockIndex(Pool_t  *PoolPtr, uint32 Size);
+uint32 CFE_ES_HighBit(uint32 Value);
+uint32 CFE_ES_GetBuddyIndex(Pool_t *PoolPtr, uint32 Size);
+void   CFE_ES_PushBuddy(Pool_t *PoolPtr, uint32 Idx, BD_t *BdPtr);
+void   CFE_ES_UnlinkBuddy(Pool_t *PoolPtr, uint32 Idx, BD_t *BdPtr);
+int32  CFE_ES_GetBuddyBuf(Pool_t *PoolPtr, uint32 **BufPtr, uint32 Size);
+int32  CFE_ES_PutBuddyBuf(Pool_t *PoolPtr, BD_t *BdPtr);
+int32  CFE_ES_GetLocklessBuf(Pool_t *PoolPtr, uint32 **BufPtr, uint32 Size);
+int32  CFE_ES_PutLocklessBuf(Pool_t *PoolPtr, BD_t *BdPtr);
 
 /*****************************************************************************/
 /*
@@ -159,6 +189,8 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
     uint32  *BlockSizeArrayPtr;
     uint32   BlockSizeArraySize;
     uint32   MinBlockSize;
+    uint32   Mode;
+    cpuaddr  HeaderEnd;
 
    /*
    ** Local Variables
@@ -193,6 +225,19 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
                            UseMutex, CFE_ES_NO_MUTEX, CFE_ES_USE_MUTEX);
       return(CFE_ES_BAD_ARGUMENT);
    }
+
+   Mode      = CFE_ES_POOL_MODE_FIXED;
+   HeaderEnd = MemAddr + sizeof(Pool_t);
+
+#if (CFE_ES_LOCKLESS_POOLS == TRUE)
+   /* A pool shared between tasks uses lock-free free lists instead of a mutex */
+   if (UseMutex == CFE_ES_USE_MUTEX)
+   {
+      Mode      = CFE_ES_POOL_MODE_LOCKLESS;
+      UseMutex  = CFE_ES_NO_MUTEX;
+      HeaderEnd = ((HeaderEnd + 7) & ~((cpuaddr)7)) + sizeof(CFE_ES_PoolFreeLists_t);
+   }
+#endif
    
    if (UseMutex == CFE_ES_USE_MUTEX)
    {
@@ -213,7 +258,7 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
    PoolPtr->Start        = (cpuaddr *)*HandlePtr;
    PoolPtr->End          = MemAddr + Size;
    PoolPtr->Size         = Size;
-   PoolPtr->Current      = (uint32 *)(MemAddr + sizeof(Pool_t));
+   PoolPtr->Current      = (uint32 *)HeaderEnd;
    PoolPtr->SizeDescPtr  = NULL;
 
    PoolPtr->CheckErrCntr = 0;
@@ -221,6 +266,13 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
    
    PoolPtr->UseMutex     = UseMutex;
 
+   PoolPtr->Mode         = CFE_ES_POOL_MODE_FIXED;
+   PoolPtr->FreeMap      = 0;
+   PoolPtr->MinOrder     = 0;
+   PoolPtr->FreeBytes    = 0;
+   PoolPtr->Arena        = 0;
+   PoolPtr->FreeLists    = NULL;
+
    for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
    {
       PoolPtr->SizeDesc[i].NumCreated = 0;
@@ -272,11 +324,11 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
         }
    }
 
-   if (Size <= (sizeof(Pool_t) + MinBlockSize + sizeof(BD_t) ) )
+   if ((MemAddr + Size) <= (HeaderEnd + MinBlockSize + sizeof(BD_t) ) )
    {  /* must be able make Pool management structure and at least one of the smallest blocks  */
       CFE_ES_WriteToSysLog("CFE_ES:poolCreate Pool size(%d) too small for management structure, need >=(%d)\n",
                             (int)Size,
-                            (int)(sizeof(Pool_t) + MinBlockSize + sizeof(BD_t)) );
+                            (int)((HeaderEnd - MemAddr) + MinBlockSize + sizeof(BD_t)) );
                             
       if (UseMutex == CFE_ES_USE_MUTEX)
       {
@@ -287,6 +339,168 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
       return(CFE_ES_BAD_ARGUMENT);
    }
 
+   /* The pool becomes lock-free only once its free lists are in place */
+   if (Mode == CFE_ES_POOL_MODE_LOCKLESS)
+   {
+      PoolPtr->FreeLists = (CFE_ES_PoolFreeLists_t *)(HeaderEnd - sizeof(CFE_ES_PoolFreeLists_t));
+      for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
+      {
+         PoolPtr->FreeLists->Top[i] = 0;
+      }
+      PoolPtr->FreeLists->Current = HeaderEnd;
+      PoolPtr->Mode = CFE_ES_POOL_MODE_LOCKLESS;
+   }
+
+   if (UseMutex == CFE_ES_USE_MUTEX)
+   {
+       OS_MutSemGive(PoolPtr->MutexId);
+   }
+
+   return(CFE_SUCCESS);
+}
+
+/*
+** CFE_ES_PoolCreateBuddy will initialize a pre-allocated memory pool that is managed as a
+** buddy allocator.  Free blocks are split to serve smaller requests and are merged with
+** their buddy again when both are free, so memory is not tied to one block size.
+*/
+int32 CFE_ES_PoolCreateBuddy(CFE_ES_MemHandle_t  *HandlePtr,
+                             uint8               *MemPtr,
+                             uint32               Size,
+                             uint32               MinBlockSize,
+                             uint16               UseMutex )
+{
+    char     MutexName[OS_MAX_API_NAME];
+    cpuaddr  MemAddr;
+    cpuaddr  Arena;
+    uint32   ArenaSize;
+    uint32   Offset;
+    uint32   MinOrder;
+    uint32   MaxOrder;
+    uint32   Order;
+    uint32   i;
+    uint32   MutexId = 0;
+
+   Pool_t *PoolPtr = (Pool_t *)MemPtr;
+   MemAddr         = (cpuaddr)MemPtr;
+   *HandlePtr      = MemAddr;
+
+   /* Force the size given to be 32 bit aligned */
+   Size &= 0xFFFFFFFC;
+
+#ifdef CFE_ES_MEMPOOL_ALIGNED
+   /* Determine if the memory pool address is 32-bit aligned */
+   if ((MemAddr & 0x00000003) != 0)
+   {
+      CFE_ES_WriteToSysLog("CFE_ES:poolCreate Pool Address(0x%08lX) is not 32-bit aligned.\n", (unsigned long)MemAddr);
+      return(CFE_ES_BAD_ARGUMENT);
+   }
+#endif
+
+   if ((UseMutex != CFE_ES_USE_MUTEX) && (UseMutex != CFE_ES_NO_MUTEX))
+   {
+      CFE_ES_WriteToSysLog("CFE_ES:poolCreate Invalid Mutex Usage Option (%d), must be %d or %d\n",
+                           UseMutex, CFE_ES_NO_MUTEX, CFE_ES_USE_MUTEX);
+      return(CFE_ES_BAD_ARGUMENT);
+   }
+
+   if (MinBlockSize == 0)
+   {
+      MinBlockSize = CFE_ES_MEM_BLOCK_SIZE_01;
+   }
+
+   /* A free block keeps a link to the previous free block after its descriptor */
+   if (MinBlockSize < sizeof(BD_t *))
+   {
+      MinBlockSize = sizeof(BD_t *);
+   }
+
+   /* Every block size, descriptor included, must be a power of two that fits in 32 bits */
+   if (MinBlockSize > (((uint32)1 << (32 - CFE_ES_MAX_MEMPOOL_BLOCK_SIZES)) - sizeof(BD_t)))
+   {
+      CFE_ES_WriteToSysLog("CFE_ES:poolCreate Min Block Size (%d) greater than max (%d)\n",
+                           (int)MinBlockSize,
+                           (int)(((uint32)1 << (32 - CFE_ES_MAX_MEMPOOL_BLOCK_SIZES)) - sizeof(BD_t)));
+      return(CFE_ES_BAD_ARGUMENT);
+   }
+
+   MinOrder = CFE_ES_HighBit(MinBlockSize + sizeof(BD_t) - 1) + 1;
+   MaxOrder = MinOrder + CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 1;
+
+   /* Blocks are placed from an 8 byte boundary after the pool management structure */
+   Arena = (MemAddr + sizeof(Pool_t) + 7) & ~((cpuaddr)7);
+
+   if ((MemAddr + Size) < (Arena + ((cpuaddr)1 << MinOrder)))
+   {  /* must be able make Pool management structure and at least one of the smallest blocks  */
+      CFE_ES_WriteToSysLog("CFE_ES:poolCreate Pool size(%d) too small for management structure, need >=(%d)\n",
+                            (int)Size,
+                            (int)((Arena - MemAddr) + ((cpuaddr)1 << MinOrder)) );
+      return(CFE_ES_BAD_ARGUMENT);
+   }
+
+   if (UseMutex == CFE_ES_USE_MUTEX)
+   {
+      /*
+      ** Construct a name for the Mutex from the address
+      ** This is needed only because OS_MutSemCreate requires
+      ** a unique name for each semaphore created.
+      */
+      snprintf(MutexName, OS_MAX_API_NAME, "%08lX", (unsigned long)MemPtr);
+
+      /* create a semphore to protect this memory pool */
+      OS_MutSemCreate(&MutexId, MutexName, 0);
+      PoolPtr->MutexId = MutexId;
+
+      /* Take the semaphore to ensure the mem pool is not being used during its creation */
+      OS_MutSemTake(PoolPtr->MutexId);
+   }
+
+   PoolPtr->Start        = (cpuaddr *)*HandlePtr;
+   PoolPtr->End          = MemAddr + Size;
+   PoolPtr->Size         = Size;
+   PoolPtr->Current      = (uint32 *)PoolPtr->End; /* Nothing is carved in this mode */
+   PoolPtr->SizeDescPtr  = NULL;
+
+   PoolPtr->CheckErrCntr = 0;
+   PoolPtr->RequestCntr  = 0;
+
+   PoolPtr->UseMutex     = UseMutex;
+
+   PoolPtr->Mode         = CFE_ES_POOL_MODE_BUDDY;
+   PoolPtr->FreeMap      = 0;
+   PoolPtr->MinOrder     = MinOrder;
+   PoolPtr->FreeBytes    = 0;
+   PoolPtr->Arena        = Arena;
+   PoolPtr->FreeLists    = NULL;
+
+   /* Sizes are ordered largest to smallest, each half of the one before */
+   for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
+   {
+      PoolPtr->SizeDesc[i].NumCreated = 0;
+      PoolPtr->SizeDesc[i].NumFree = 0;
+      PoolPtr->SizeDesc[i].MaxSize = ((uint32)1 << (MaxOrder - i)) - sizeof(BD_t);
+      PoolPtr->SizeDesc[i].Top = NULL;
+   }
+
+   /*
+   ** Cover the memory with the largest blocks that fit.  Taking them largest first
+   ** keeps each block on a boundary of its own size, which the buddy arithmetic needs.
+   */
+   ArenaSize = (uint32)(PoolPtr->End - Arena);
+   Offset = 0;
+   while ((ArenaSize - Offset) >= ((uint32)1 << MinOrder))
+   {
+      Order = CFE_ES_HighBit(ArenaSize - Offset);
+      if (Order > MaxOrder)
+      {
+         Order = MaxOrder;
+      }
+
+      PoolPtr->SizeDesc[MaxOrder - Order].NumCreated++;
+      CFE_ES_PushBuddy(PoolPtr, MaxOrder - Order, (BD_t *)(Arena + Offset));
+      Offset += (uint32)1 << Order;
+   }
+
    if (UseMutex == CFE_ES_USE_MUTEX)
    {
        OS_MutSemGive(PoolPtr->MutexId);
@@ -310,6 +524,7 @@ int32 CFE_ES_GetPoolBuf(uint32             **BufPtr,
    uint32    Block;
    BD_t    * BdPtr;
    uint32    AppId= 0xFFFFFFFF;
+   int32     Status;
 
    if (PoolPtr != NULL)
    {
@@ -335,6 +550,23 @@ int32 CFE_ES_GetPoolBuf(uint32             **BufPtr,
 
    *BufPtr = NULL;
 
+   if (PoolPtr->Mode != CFE_ES_POOL_MODE_FIXED)
+   {
+      if (PoolPtr->Mode == CFE_ES_POOL_MODE_BUDDY)
+      {
+         Status = CFE_ES_GetBuddyBuf(PoolPtr, BufPtr, Size);
+      }
+      else
+      {
+         Status = CFE_ES_GetLocklessBuf(PoolPtr, BufPtr, Size);
+      }
+      if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+      {
+         OS_MutSemGive(PoolPtr->MutexId);
+      }
+      return(Status);
+   }
+
    Block = CFE_ES_GetBlockSize(PoolPtr, Size);
    if (Block == 0xFFFFFFFF)
    {
@@ -472,6 +704,7 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
   BD_t     *BdPtr    = (BD_t *) ((uint8 *)BufPtr - sizeof(BD_t));
   uint32    Block;
   cpuaddr   BdAddr;
+  int32     Status;
 
   BdAddr = (cpuaddr)BdPtr;
 
@@ -505,7 +738,7 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
   /* Don't allow a block that has already been deallocated to be deallocated again */
   if (BdPtr->Allocated != CFE_ES_MEMORY_ALLOCATED)
   {
-      PoolPtr->CheckErrCntr++;
+      CFE_ATOMIC_INC(&PoolPtr->CheckErrCntr);
       CFE_ES_WriteToSysLog("CFE_ES:putPoolBuf err:Deallocating unallocated memory block @ 0x%08lX\n", (unsigned long)BdAddr);
       if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
       {
@@ -516,7 +749,7 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
   
   if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN)
   {
-      PoolPtr->CheckErrCntr++;
+      CFE_ATOMIC_INC(&PoolPtr->CheckErrCntr);
       CFE_ES_WriteToSysLog("CFE_ES:putPoolBuf err:Invalid/Corrupted Memory descriptor @ 0x%08lX\n", (unsigned long)BdAddr);
       if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
       {
@@ -525,6 +758,23 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
       return(CFE_ES_ERR_MEM_HANDLE);
   }
 
+  if (PoolPtr->Mode != CFE_ES_POOL_MODE_FIXED)
+  {
+      if (PoolPtr->Mode == CFE_ES_POOL_MODE_BUDDY)
+      {
+          Status = CFE_ES_PutBuddyBuf(PoolPtr, BdPtr);
+      }
+      else
+      {
+          Status = CFE_ES_PutLocklessBuf(PoolPtr, BdPtr);
+      }
+      if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+      {
+         OS_MutSemGive(PoolPtr->MutexId);
+      }
+      return(Status);
+  }
+
   Block = CFE_ES_GetBlockSize(PoolPtr, BdPtr->Size);
   
   if (Block == 0xFFFFFFFF)
@@ -550,6 +800,397 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
   return (int32)Block;
 }
 
+/*
+** Function:
+**   CFE_ES_HighBit
+**
+** Purpose:
+**   Returns the index of the most significant bit set in a non-zero value,
+**   i.e. the base 2 logarithm rounded down.
+*/
+uint32 CFE_ES_HighBit(uint32 Value)
+{
+#if defined(__GNUC__)
+  return(31 - (uint32)__builtin_clz(Value));
+#else
+  uint32 Bit = 0;
+
+  if (Value >= 0x00010000) { Value >>= 16; Bit += 16; }
+  if (Value >= 0x00000100) { Value >>= 8;  Bit += 8;  }
+  if (Value >= 0x00000010) { Value >>= 4;  Bit += 4;  }
+  if (Value >= 0x00000004) { Value >>= 2;  Bit += 2;  }
+  if (Value >= 0x00000002) { Bit += 1; }
+
+  return(Bit);
+#endif
+}
+
+/*
+** Function:
+**   CFE_ES_GetBuddyIndex
+**
+** Purpose:
+**   Returns the index of the smallest block size of a buddy pool that holds
+**   the given number of bytes, or 0xFFFFFFFF if none does.  The index is
+**   computed directly from the highest bit of the size.
+*/
+uint32 CFE_ES_GetBuddyIndex(Pool_t *PoolPtr, uint32 Size)
+{
+  uint32 Need;
+  uint32 Order;
+
+  if (Size > PoolPtr->SizeDesc[0].MaxSize)
+  {
+      return(0xFFFFFFFF);
+  }
+
+  Need = Size + sizeof(BD_t);
+  if (Need <= ((uint32)1 << PoolPtr->MinOrder))
+  {
+      Order = PoolPtr->MinOrder;
+  }
+  else
+  {
+      Order = CFE_ES_HighBit(Need - 1) + 1;
+  }
+
+  return(PoolPtr->MinOrder + CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 1 - Order);
+}
+
+/*
+** Function:
+**   CFE_ES_PushBuddy
+**
+** Purpose:
+**   Marks a block of a buddy pool free and puts it on the free list of its size.
+*/
+void CFE_ES_PushBuddy(Pool_t *PoolPtr, uint32 Idx, BD_t *BdPtr)
+{
+  BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+  BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED;
+  BdPtr->Size      = PoolPtr->SizeDesc[Idx].MaxSize;
+  BdPtr->Next      = (uint32 *)PoolPtr->SizeDesc[Idx].Top;
+  CFE_ES_BUDDY_PREV(BdPtr) = NULL;
+
+  if (PoolPtr->SizeDesc[Idx].Top != NULL)
+  {
+      CFE_ES_BUDDY_PREV(PoolPtr->SizeDesc[Idx].Top) = BdPtr;
+  }
+
+  PoolPtr->SizeDesc[Idx].Top = BdPtr;
+  PoolPtr->SizeDesc[Idx].NumFree++;
+  PoolPtr->FreeMap |= ((uint32)1 << Idx);
+  PoolPtr->FreeBytes += PoolPtr->SizeDesc[Idx].MaxSize + sizeof(BD_t);
+}
+
+/*
+** Function:
+**   CFE_ES_UnlinkBuddy
+**
+** Purpose:
+**   Takes a free block of a buddy pool off the free list of its size.
+*/
+void CFE_ES_UnlinkBuddy(Pool_t *PoolPtr, uint32 Idx, BD_t *BdPtr)
+{
+  BD_t     *PrevPtr  = CFE_ES_BUDDY_PREV(BdPtr);
+  uint32   *NextLink = BdPtr->Next;
+  BD_t     *NextPtr  = (BD_t *)NextLink;
+
+  if (PrevPtr == NULL)
+  {
+      PoolPtr->SizeDesc[Idx].Top = NextPtr;
+  }
+  else
+  {
+      PrevPtr->Next = NextLink;
+  }
+
+  if (NextPtr != NULL)
+  {
+      CFE_ES_BUDDY_PREV(NextPtr) = PrevPtr;
+  }
+
+  BdPtr->Next = NULL;
+  PoolPtr->SizeDesc[Idx].NumFree--;
+  if (PoolPtr->SizeDesc[Idx].Top == NULL)
+  {
+      PoolPtr->FreeMap &= ~((uint32)1 << Idx);
+  }
+  PoolPtr->FreeBytes -= PoolPtr->SizeDesc[Idx].MaxSize + sizeof(BD_t);
+}
+
+/*
+** Function:
+**   CFE_ES_GetBuddyBuf
+**
+** Purpose:
+**   Allocates a block from a buddy pool.  The smallest free block that is
+**   large enough is found from the free map and split in halves until it is
+**   the requested size; the upper halves are left free.
+**
+**   The caller must hold the pool mutex.
+*/
+int32 CFE_ES_GetBuddyBuf(Pool_t *PoolPtr, uint32 **BufPtr, uint32 Size)
+{
+  uint32    Idx;
+  uint32    Src;
+  uint32    Avail;
+  BD_t     *BdPtr;
+
+  Idx = CFE_ES_GetBuddyIndex(PoolPtr, Size);
+  if (Idx == 0xFFFFFFFF)
+  {
+      CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:size(%d) > max(%d).\n",(int)Size,(int)PoolPtr->SizeDesc[0].MaxSize);
+      return(CFE_ES_ERR_MEM_BLOCK_SIZE);
+  }
+
+  /* Free blocks of the requested size or larger */
+  Avail = PoolPtr->FreeMap & (((uint32)2 << Idx) - 1);
+  if (Avail == 0)
+  {
+      CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:Request won't fit in remaining memory\n");
+      return(CFE_ES_ERR_MEM_BLOCK_SIZE);
+  }
+
+  Src = CFE_ES_HighBit(Avail);
+  BdPtr = PoolPtr->SizeDesc[Src].Top;
+  CFE_ES_UnlinkBuddy(PoolPtr, Src, BdPtr);
+
+  while (Src < Idx)
+  {
+      PoolPtr->SizeDesc[Src].NumCreated--;
+      Src++;
+      PoolPtr->SizeDesc[Src].NumCreated += 2;
+      CFE_ES_PushBuddy(PoolPtr, Src, (BD_t *)((uint8 *)BdPtr + PoolPtr->SizeDesc[Src].MaxSize + sizeof(BD_t)));
+  }
+
+  PoolPtr->RequestCntr++;
+
+  BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+  BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED; /* Flag memory block as allocated */
+  BdPtr->Size      = PoolPtr->SizeDesc[Idx].MaxSize;
+  BdPtr->Next      = NULL;
+  *BufPtr          = (uint32 *)(BdPtr + 1);
+
+  return (int32)BdPtr->Size;
+}
+
+/*
+** Function:
+**   CFE_ES_PutBuddyBuf
+**
+** Purpose:
+**   Returns an allocated block to a buddy pool.  While the buddy of the block
+**   is free and of the same size, the two are merged into a block twice the size.
+**
+**   The caller must hold the pool mutex and have checked the descriptor.
+*/
+int32 CFE_ES_PutBuddyBuf(Pool_t *PoolPtr, BD_t *BdPtr)
+{
+  uint32    Idx;
+  uint32    Block;
+  uint32    BlockSize;
+  uint32    Offset;
+  uint32    BuddyOffset;
+  uint32    ArenaSize;
+  BD_t     *BuddyPtr;
+
+  Idx = CFE_ES_GetBuddyIndex(PoolPtr, BdPtr->Size);
+  if ((Idx == 0xFFFFFFFF) || (PoolPtr->SizeDesc[Idx].MaxSize != BdPtr->Size) ||
+      ((cpuaddr)BdPtr < PoolPtr->Arena))
+  {
+      PoolPtr->CheckErrCntr++;
+      CFE_ES_WriteToSysLog("CFE_ES:putPoolBuf err:Invalid/Corrupted Memory descriptor @ 0x%08lX\n", (unsigned long)BdPtr);
+      return(CFE_ES_ERR_MEM_HANDLE);
+  }
+
+  Block     = BdPtr->Size;
+  BlockSize = Block + sizeof(BD_t);
+  Offset    = (uint32)((cpuaddr)BdPtr - PoolPtr->Arena);
+
+  /* A block always starts on a boundary of its own size */
+  if ((Offset & (BlockSize - 1)) != 0)
+  {
+      PoolPtr->CheckErrCntr++;
+      CFE_ES_WriteToSysLog("CFE_ES:putPoolBuf err:Invalid/Corrupted Memory descriptor @ 0x%08lX\n", (unsigned long)BdPtr);
+      return(CFE_ES_ERR_MEM_HANDLE);
+  }
+
+  /* The descriptor stays in the merged block, it must not pass as allocated */
+  BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED;
+
+  ArenaSize = (uint32)(PoolPtr->End - PoolPtr->Arena);
+
+  while (Idx > 0)
+  {
+      BlockSize   = PoolPtr->SizeDesc[Idx].MaxSize + sizeof(BD_t);
+      BuddyOffset = Offset ^ BlockSize;
+
+      /* The last blocks of the pool may have no buddy */
+      if ((BuddyOffset + BlockSize) > ArenaSize)
+      {
+          break;
+      }
+
+      /*
+      ** The buddy is whole and free only if its descriptor says so.  If it has
+      ** been split, its descriptor belongs to a smaller block.
+      */
+      BuddyPtr = (BD_t *)(PoolPtr->Arena + BuddyOffset);
+      if ((BuddyPtr->CheckBits != CFE_ES_CHECK_PATTERN) ||
+          (BuddyPtr->Allocated != CFE_ES_MEMORY_DEALLOCATED) ||
+          (BuddyPtr->Size != PoolPtr->SizeDesc[Idx].MaxSize))
+      {
+          break;
+      }
+
+      CFE_ES_UnlinkBuddy(PoolPtr, Idx, BuddyPtr);
+      PoolPtr->SizeDesc[Idx].NumCreated -= 2;
+      Idx--;
+      PoolPtr->SizeDesc[Idx].NumCreated++;
+      Offset &= ~BlockSize;
+  }
+
+  CFE_ES_PushBuddy(PoolPtr, Idx, (BD_t *)(PoolPtr->Arena + Offset));
+
+  return (int32)Block;
+}
+
+/*
+** Function:
+**   CFE_ES_GetLocklessBuf
+**
+** Purpose:
+**   Allocates a block from a lock-free pool.  The block is popped from the
+**   free list of its size or, if that list is empty, carved from the unused
+**   end of the pool.  Any number of tasks may call this at the same time.
+*/
+int32 CFE_ES_GetLocklessBuf(Pool_t *PoolPtr, uint32 **BufPtr, uint32 Size)
+{
+  CFE_ES_PoolFreeLists_t *ListsPtr = PoolPtr->FreeLists;
+  uint32    i;
+  uint32    Block;
+  uint64    OldTop;
+  uint64    NewTop;
+  cpuaddr   NextAddr;
+  cpuaddr   Current;
+  BD_t     *BdPtr = NULL;
+
+  i = CFE_ES_GetBlockIndex(PoolPtr, Size);
+  if (i == 0xFFFFFFFF)
+  {
+      CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:size(%d) > max(%d).\n",(int)Size,(int)PoolPtr->SizeDesc[0].MaxSize);
+      return(CFE_ES_ERR_MEM_BLOCK_SIZE);
+  }
+
+  Block = PoolPtr->SizeDesc[i].MaxSize;
+
+  /*
+  ** Pop the first free block.  Its link may be stale if another task takes
+  ** the block first, but then the change count makes the swap fail.
+  */
+  do
+  {
+      OldTop = CFE_ATOMIC_LOAD(&ListsPtr->Top[i]);
+      if (CFE_ES_LIST_OFFSET(OldTop) == 0)
+      {
+          BdPtr = NULL;
+          break;
+      }
+
+      BdPtr    = (BD_t *)((cpuaddr)PoolPtr + CFE_ES_LIST_OFFSET(OldTop));
+      NextAddr = (cpuaddr)CFE_ATOMIC_LOAD(&BdPtr->Next);
+      NewTop   = CFE_ES_LIST_NEXT_TAG(OldTop);
+      if (NextAddr != 0)
+      {
+          NewTop |= (uint32)(NextAddr - (cpuaddr)PoolPtr);
+      }
+  } while (!CFE_ATOMIC_CAS(&ListsPtr->Top[i], OldTop, NewTop));
+
+  if (BdPtr != NULL)
+  {
+      CFE_ATOMIC_DEC(&PoolPtr->SizeDesc[i].NumFree);
+  }
+  else /* go make one */
+  {
+      do
+      {
+          Current = CFE_ATOMIC_LOAD(&ListsPtr->Current);
+          if ((Current + sizeof(BD_t) + Block) >= PoolPtr->End) /* can't fit in remaing mem */
+          {
+              CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:Request won't fit in remaining memory\n");
+              return(CFE_ES_ERR_MEM_BLOCK_SIZE);
+          }
+      } while (!CFE_ATOMIC_CAS(&ListsPtr->Current, Current, Current + sizeof(BD_t) + Block));
+
+      BdPtr = (BD_t *)Current;
+      CFE_ATOMIC_INC(&PoolPtr->SizeDesc[i].NumCreated);
+      CFE_ATOMIC_INC(&PoolPtr->RequestCntr);
+  }
+
+  BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+  BdPtr->Size      = Block;
+  BdPtr->Next      = NULL;
+  CFE_ATOMIC_BARRIER();
+  BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED; /* Flag memory block as allocated */
+  *BufPtr          = (uint32 *)(BdPtr + 1);
+
+  return (int32)Block;
+}
+
+/*
+** Function:
+**   CFE_ES_PutLocklessBuf
+**
+** Purpose:
+**   Returns an allocated block to a lock-free pool.  The allocated flag is
+**   cleared with a compare-and-swap, so when two tasks free the same block
+**   only one of them puts it on the free list.
+**
+**   The caller must have checked the descriptor.
+*/
+int32 CFE_ES_PutLocklessBuf(Pool_t *PoolPtr, BD_t *BdPtr)
+{
+  CFE_ES_PoolFreeLists_t *ListsPtr = PoolPtr->FreeLists;
+  uint32    i;
+  uint32    Offset;
+  uint64    OldTop;
+
+  i = CFE_ES_GetBlockIndex(PoolPtr, BdPtr->Size);
+  if (i == 0xFFFFFFFF)
+  {
+      CFE_ATOMIC_INC(&PoolPtr->CheckErrCntr);
+      CFE_ES_WriteToSysLog("CFE_ES:putPoolBuf err:size(%d) > max(%d).\n",(int)BdPtr->Size,(int)PoolPtr->SizeDesc[0].MaxSize);
+      return(CFE_ES_ERR_MEM_HANDLE);
+  }
+
+  if (!CFE_ATOMIC_CAS(&BdPtr->Allocated, CFE_ES_MEMORY_ALLOCATED, CFE_ES_MEMORY_DEALLOCATED))
+  {
+      CFE_ATOMIC_INC(&PoolPtr->CheckErrCntr);
+      CFE_ES_WriteToSysLog("CFE_ES:putPoolBuf err:Deallocating unallocated memory block @ 0x%08lX\n", (unsigned long)BdPtr);
+      return(CFE_ES_ERR_MEM_HANDLE);
+  }
+
+  Offset = (uint32)((cpuaddr)BdPtr - (cpuaddr)PoolPtr);
+
+  do
+  {
+      OldTop = CFE_ATOMIC_LOAD(&ListsPtr->Top[i]);
+      if (CFE_ES_LIST_OFFSET(OldTop) == 0)
+      {
+          BdPtr->Next = NULL;
+      }
+      else
+      {
+          BdPtr->Next = (uint32 *)((cpuaddr)PoolPtr + CFE_ES_LIST_OFFSET(OldTop));
+      }
+  } while (!CFE_ATOMIC_CAS(&ListsPtr->Top[i], OldTop, CFE_ES_LIST_NEXT_TAG(OldTop) | Offset));
+
+  CFE_ATOMIC_INC(&PoolPtr->SizeDesc[i].NumFree);
+
+  return (int32)PoolPtr->SizeDesc[i].MaxSize;
+}
+
 /*
 ** Function:
 **   ES_GetBlockSize
@@ -559,10 +1200,33 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
 */
 uint32 CFE_ES_GetBlockSize(Pool_t  *PoolPtr, uint32 Size)
 {
-  uint32 i=0;
+  uint32 i;
 
   PoolPtr->SizeDescPtr = NULL;
 
+  i = CFE_ES_GetBlockIndex(PoolPtr, Size);
+  if (i == 0xFFFFFFFF)
+  {
+        return(0xFFFFFFFF);
+  }
+  
+  PoolPtr->SizeDescPtr = &PoolPtr->SizeDesc[i];
+  return(PoolPtr->SizeDesc[i].MaxSize);
+}
+
+/*
+** Function:
+**   CFE_ES_GetBlockIndex
+**
+** Purpose:
+**   Returns the index of the smallest block size that holds the given number
+**   of bytes, or 0xFFFFFFFF if none does.  Unlike CFE_ES_GetBlockSize it does
+**   not change the pool, so tasks may call it at the same time.
+*/
+uint32 CFE_ES_GetBlockIndex(Pool_t  *PoolPtr, uint32 Size)
+{
+  uint32 i=0;
+
   /* If caller is requesting a size larger than the largest allowed */
   /* then return an error code */  
   if (Size > PoolPtr->SizeDesc[0].MaxSize)
@@ -577,8 +1241,7 @@ uint32 CFE_ES_GetBlockSize(Pool_t  *PoolPtr, uint32 Size)
         i++;
   }
   
-  PoolPtr->SizeDescPtr = &PoolPtr->SizeDesc[i];
-  return(PoolPtr->SizeDesc[i].MaxSize);
+  return(i);
 }
 
 
@@ -608,7 +1271,42 @@ int32 CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr,
     BufPtr->PoolSize = PoolPtr->Size;
     BufPtr->NumBlocksRequested = PoolPtr->RequestCntr;
     BufPtr->CheckErrCtr = PoolPtr->CheckErrCntr;
-    BufPtr->NumFreeBytes = PoolPtr->End - ((cpuaddr)PoolPtr->Current);
+    BufPtr->MaxFreeBlockSize = 0;
+
+    if (PoolPtr->Mode == CFE_ES_POOL_MODE_BUDDY)
+    {
+        BufPtr->NumFreeBytes = PoolPtr->FreeBytes;
+
+        /* The largest free block is the lowest bit set in the free map */
+        if (PoolPtr->FreeMap != 0)
+        {
+            i = CFE_ES_HighBit(PoolPtr->FreeMap & (~PoolPtr->FreeMap + 1));
+            BufPtr->MaxFreeBlockSize = PoolPtr->SizeDesc[i].MaxSize;
+        }
+    }
+    else
+    {
+        if (PoolPtr->Mode == CFE_ES_POOL_MODE_LOCKLESS)
+        {
+            BufPtr->NumFreeBytes = PoolPtr->End - CFE_ATOMIC_LOAD(&PoolPtr->FreeLists->Current);
+        }
+        else
+        {
+            BufPtr->NumFreeBytes = PoolPtr->End - ((cpuaddr)PoolPtr->Current);
+        }
+
+        /* The largest size that is on a free list or can still be carved */
+        for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
+        {
+            if ((PoolPtr->SizeDesc[i].MaxSize != 0) &&
+                ((PoolPtr->SizeDesc[i].NumFree != 0) ||
+                 (BufPtr->NumFreeBytes > (PoolPtr->SizeDesc[i].MaxSize + sizeof(BD_t)))))
+            {
+                BufPtr->MaxFreeBlockSize = PoolPtr->SizeDesc[i].MaxSize;
+                break;
+            }
+        }
+    }
     
     for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
     {
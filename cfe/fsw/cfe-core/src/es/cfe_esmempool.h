@@ -42,6 +42,15 @@ typedef struct
   uint32   NumFree;
   uint32   MaxSize;
 } BlockSizeDesc_t;
+/*
+** Lock-free state of a pool, kept on an 8 byte boundary after the Pool_t
+*/
+typedef struct
+{
+  uint64   Top[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES]; /* Change count << 32 | offset of the first free block */
+  cpuaddr  Current;                             /* Address of the next block to carve */
+} CFE_ES_PoolFreeLists_t;
+
 /*
 ** Memory Pool Type
 */
@@ -56,6 +65,12 @@ typedef struct {
    uint32           MutexId;
    uint32           UseMutex;
    BlockSizeDesc_t  SizeDesc[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
+   uint32           Mode;      /* Fixed block sizes or buddy allocator */
+   uint32           FreeMap;   /* Buddy mode: bit i is set when SizeDesc[i] has a free block */
+   uint32           MinOrder;  /* Buddy mode: log2 of the smallest block, descriptor included */
+   uint32           FreeBytes; /* Buddy mode: bytes held in free blocks */
+   cpuaddr          Arena;     /* Buddy mode: address that block offsets are relative to */
+   CFE_ES_PoolFreeLists_t *FreeLists; /* Lock-free mode: free lists and carve address */
 } OS_PACK Pool_t;
 
 
@@ -159,6 +159,8 @@ int32 CFE_EVS_Register (void *Filters, uint16 NumEventFilters, uint16 FilterSche
             AppDataPtr->BinFilters[i].Mask    = 0;
             AppDataPtr->BinFilters[i].Count   = 0;
          }
+
+         EVS_IndexFilters(AppDataPtr);
       }
    }
 
@@ -211,8 +213,6 @@ int32 CFE_EVS_Unregister(void)
 */
 int32 CFE_EVS_SendEvent (uint16 EventID, uint16 EventType, const char *Spec, ... )
 {
-   CFE_EVS_Packet_t   EVS_Packet;
-   int32              ExpandedLength;
    int32              Status = CFE_SUCCESS;
    uint32             AppID = CFE_EVS_UNDEF_APPID;
    CFE_TIME_SysTime_t Time;
@@ -230,30 +230,13 @@ int32 CFE_EVS_SendEvent (uint16 EventID, uint16 EventType, const char *Spec, ...
       }
       else if (EVS_IsFiltered(AppID, EventID, EventType) == FALSE)
       {
-         /* Initialize EVS event packet */
-         CFE_SB_InitMsg(&EVS_Packet, CFE_EVS_EVENT_MSG_MID, sizeof(CFE_EVS_Packet_t), TRUE);
-         EVS_Packet.Payload.PacketID.EventID   = EventID;
-         EVS_Packet.Payload.PacketID.EventType = EventType;
-
-         /* vsnprintf() returns the total expanded length of the formatted string */
-         /* vsnprintf() copies and zero terminates portion that fits in the buffer */
-         va_start(Ptr, Spec);
-         ExpandedLength = vsnprintf((char *)EVS_Packet.Payload.Message, sizeof(EVS_Packet.Payload.Message), Spec, Ptr);
-         va_end(Ptr);
-
-         /* Were any characters truncated in the buffer? */
-         if (ExpandedLength >= sizeof(EVS_Packet.Payload.Message))
-         {
-            /* Mark character before zero terminator to indicate truncation */
-            EVS_Packet.Payload.Message[sizeof(EVS_Packet.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
-            CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter++;
-         }
-
          /* Get current spacecraft time */
          Time = CFE_TIME_GetTime();
 
-         /* Send the event packet */
-         EVS_SendPacket(AppID, Time, &EVS_Packet);
+         /* Format and send the event, or queue it for the EVS task */
+         va_start(Ptr, Spec);
+         EVS_GenerateEvent(AppID, Time, EventID, EventType, Spec, Ptr);
+         va_end(Ptr);
       }
    }
 
@@ -275,8 +258,6 @@ int32 CFE_EVS_SendEvent (uint16 EventID, uint16 EventType, const char *Spec, ...
 */
 int32 CFE_EVS_SendEventWithAppID (uint16 EventID, uint16 EventType, uint32 AppID, const char *Spec, ... )
 {
-   CFE_EVS_Packet_t   EVS_Packet;
-   int32              ExpandedLength;
    int32              Status = CFE_SUCCESS;
    CFE_TIME_SysTime_t Time;
    va_list            Ptr;
@@ -292,30 +273,13 @@ int32 CFE_EVS_SendEventWithAppID (uint16 EventID, uint16 EventType, uint32 AppID
    }
    else if (EVS_IsFiltered(AppID, EventID, EventType) == FALSE)
    {
-      /* Initialize EVS event packet */
-      CFE_SB_InitMsg(&EVS_Packet, CFE_EVS_EVENT_MSG_MID, sizeof(CFE_EVS_Packet_t), TRUE);
-      EVS_Packet.Payload.PacketID.EventID   = EventID;
-      EVS_Packet.Payload.PacketID.EventType = EventType;
-
-      /* vsnprintf() returns the total expanded length of the formatted string */
-      /* vsnprintf() copies and zero terminates portion that fits in the buffer */
-      va_start(Ptr, Spec);
-      ExpandedLength = vsnprintf((char *)EVS_Packet.Payload.Message, sizeof(EVS_Packet.Payload.Message), Spec, Ptr);
-      va_end(Ptr);
-
-      /* Were any characters truncated in the buffer? */
-      if (ExpandedLength >= sizeof(EVS_Packet.Payload.Message))
-      {
-         /* Mark character before zero terminator to indicate truncation */
-         EVS_Packet.Payload.Message[sizeof(EVS_Packet.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
-         CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter++;
-      }
-
       /* Get current spacecraft time */
       Time = CFE_TIME_GetTime();
 
-      /* Send the event packet */
-      EVS_SendPacket(AppID, Time, &EVS_Packet);
+      /* Format and send the event, or queue it for the EVS task */
+      va_start(Ptr, Spec);
+      EVS_GenerateEvent(AppID, Time, EventID, EventType, Spec, Ptr);
+      va_end(Ptr);
    }
 
    return Status;
@@ -335,8 +299,6 @@ int32 CFE_EVS_SendEventWithAppID (uint16 EventID, uint16 EventType, uint32 AppID
 */
 int32 CFE_EVS_SendTimedEvent (CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType, const char *Spec, ... )
 {
-   CFE_EVS_Packet_t   EVS_Packet;
-   int32              ExpandedLength;
    int32              Status = CFE_SUCCESS;
    uint32             AppID = CFE_EVS_UNDEF_APPID;
    va_list            Ptr;
@@ -353,27 +315,10 @@ int32 CFE_EVS_SendTimedEvent (CFE_TIME_SysTime_t Time, uint16 EventID, uint16 Ev
       }
       else if (EVS_IsFiltered(AppID, EventID, EventType) == FALSE)
       {
-         /* Initialize EVS event packet */
-         CFE_SB_InitMsg(&EVS_Packet, CFE_EVS_EVENT_MSG_MID, sizeof(CFE_EVS_Packet_t), TRUE);
-         EVS_Packet.Payload.PacketID.EventID   = EventID;
-         EVS_Packet.Payload.PacketID.EventType = EventType;
-
-         /* vsnprintf() returns the total expanded length of the formatted string */
-         /* vsnprintf() copies and zero terminates portion that fits in the buffer */
+         /* Format and send the event, or queue it for the EVS task */
          va_start(Ptr, Spec);
-         ExpandedLength = vsnprintf((char *)EVS_Packet.Payload.Message, sizeof(EVS_Packet.Payload.Message), Spec, Ptr);
+         EVS_GenerateEvent(AppID, Time, EventID, EventType, Spec, Ptr);
          va_end(Ptr);
-
-         /* Were any characters truncated in the buffer? */
-         if (ExpandedLength >= sizeof(EVS_Packet.Payload.Message))
-         {
-            /* Mark character before zero terminator to indicate truncation */
-            EVS_Packet.Payload.Message[sizeof(EVS_Packet.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
-            CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter++;
-         }
-
-         /* Send the event packet */
-         EVS_SendPacket(AppID, Time, &EVS_Packet);
       }
    }
 
@@ -409,7 +354,7 @@ int32 CFE_EVS_ResetFilter (int16 EventID)
       }
       else
       {
-         FilterPtr = EVS_FindEventID(EventID, CFE_EVS_GlobalData.AppData[AppID].BinFilters);
+         FilterPtr = EVS_FindEventID(EventID, &CFE_EVS_GlobalData.AppData[AppID]);
 
          if (FilterPtr != NULL)
          {
@@ -85,9 +85,345 @@
 #include "cfe_psp.h"          /* Get reset area function prototype */
 
 
+#include <stdio.h>
 #include <string.h>
 
 
+/* Writer used to dump the event log to a file */
+static CFE_ES_DumpWriter_t EVS_LogDumpWriter;
+
+
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_ReadLogData
+**
+** Purpose:  This routine copies bytes out of the compact event log, starting at the
+**           given offset and wrapping at the end of the log data.
+**
+** Assumptions and Notes:
+**
+*/
+static void EVS_ReadLogData (uint32 Offset, void *Dest, uint32 Size)
+{
+   uint32 Part = CFE_EVS_LOG_DATA_SIZE - Offset;
+
+   if (Part >= Size)
+   {
+      CFE_PSP_MemCpy(Dest, &CFE_EVS_GlobalData.EVS_LogPtr->LogData[Offset], Size);
+   }
+   else
+   {
+      CFE_PSP_MemCpy(Dest, &CFE_EVS_GlobalData.EVS_LogPtr->LogData[Offset], Part);
+      CFE_PSP_MemCpy((uint8 *) Dest + Part, CFE_EVS_GlobalData.EVS_LogPtr->LogData, Size - Part);
+   }
+
+   return;
+
+} /* End EVS_ReadLogData */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_WriteLogData
+**
+** Purpose:  This routine copies bytes into the compact event log, starting at the
+**           given offset and wrapping at the end of the log data.
+**
+** Assumptions and Notes:
+**
+*/
+static void EVS_WriteLogData (uint32 Offset, const void *Src, uint32 Size)
+{
+   uint32 Part = CFE_EVS_LOG_DATA_SIZE - Offset;
+
+   if (Part >= Size)
+   {
+      CFE_PSP_MemCpy(&CFE_EVS_GlobalData.EVS_LogPtr->LogData[Offset], (void *) Src, Size);
+   }
+   else
+   {
+      CFE_PSP_MemCpy(&CFE_EVS_GlobalData.EVS_LogPtr->LogData[Offset], (void *) Src, Part);
+      CFE_PSP_MemCpy(CFE_EVS_GlobalData.EVS_LogPtr->LogData, (uint8 *) Src + Part, Size - Part);
+   }
+
+   return;
+
+} /* End EVS_WriteLogData */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_AddLog
+**
+** Purpose:  This routine adds an event packet to the internal event log.  An event
+**           identical to the newest log entry is counted in that entry.
+**
+** Assumptions and Notes:
+**   In overwrite mode the oldest entries are dropped until the new entry fits.
+**
+*/
+void EVS_AddLog (CFE_EVS_Packet_t *EVS_PktPtr)
+{
+   CFE_EVS_Log_t         *LogPtr = CFE_EVS_GlobalData.EVS_LogPtr;
+   CFE_EVS_LogEntryHdr_t  EntryHdr;
+   CFE_TIME_SysTime_t     Time;
+   char                   Text[CFE_EVS_MAX_MESSAGE_LENGTH];
+   const char            *EndPtr;
+   uint32                 TextLength;
+   uint32                 EntrySize;
+   uint32                 Offset;
+
+   if (CFE_EVS_GlobalData.EVS_TlmPkt.Payload.LogEnabled == TRUE)
+   {
+      EndPtr = memchr(EVS_PktPtr->Payload.Message, '\0', CFE_EVS_MAX_MESSAGE_LENGTH);
+      if (EndPtr != NULL)
+      {
+         TextLength = EndPtr - EVS_PktPtr->Payload.Message;
+      }
+      else
+      {
+         TextLength = CFE_EVS_MAX_MESSAGE_LENGTH;
+      }
+
+      EntrySize = (sizeof(CFE_EVS_LogEntryHdr_t) + TextLength + 3) & ~3;
+      Time = CFE_SB_GetMsgTime((CFE_SB_Msg_t *) EVS_PktPtr);
+
+      /* Serialize access to event log control variables */
+      OS_MutSemTake(CFE_EVS_GlobalData.EVS_SharedDataMutexID);
+
+      /* Is this event the same as the newest one in the log? */
+      if (LogPtr->LogCount > 0)
+      {
+         EVS_ReadLogData(LogPtr->Last, &EntryHdr, sizeof(CFE_EVS_LogEntryHdr_t));
+
+         if ((EntryHdr.TextLength == TextLength) &&
+             (EntryHdr.RepeatCount < 0xFFFFFFFF) &&
+             (memcmp(&EntryHdr.PacketID, &EVS_PktPtr->Payload.PacketID, sizeof(CFE_EVS_PacketID_t)) == 0))
+         {
+            Offset = (LogPtr->Last + sizeof(CFE_EVS_LogEntryHdr_t)) % CFE_EVS_LOG_DATA_SIZE;
+            EVS_ReadLogData(Offset, Text, TextLength);
+
+            if (memcmp(Text, EVS_PktPtr->Payload.Message, TextLength) == 0)
+            {
+               /* Count the event in the newest entry, even if the log is full */
+               EntryHdr.RepeatCount++;
+               EntryHdr.LastTime = Time;
+               EVS_WriteLogData(LogPtr->Last, &EntryHdr, sizeof(CFE_EVS_LogEntryHdr_t));
+
+               EntrySize = 0;
+            }
+         }
+      }
+
+      if (EntrySize != 0)
+      {
+         if ((LogPtr->LogFullFlag == FALSE) && (EntrySize > (CFE_EVS_LOG_DATA_SIZE - LogPtr->Used)))
+         {
+            LogPtr->LogFullFlag = TRUE;
+         }
+
+         if (LogPtr->LogFullFlag == TRUE)
+         {
+            /* If log is full, count the event whether it is discarded or stored */
+            LogPtr->LogOverflowCounter++;
+
+            if (LogPtr->LogMode == CFE_EVS_LOG_DISCARD)
+            {
+               EntrySize = 0;
+            }
+            else
+            {
+               /* Drop the oldest entries until the new one fits */
+               while ((LogPtr->LogCount > 0) && (EntrySize > (CFE_EVS_LOG_DATA_SIZE - LogPtr->Used)))
+               {
+                  EVS_ReadLogData(LogPtr->First, &EntryHdr, sizeof(CFE_EVS_LogEntryHdr_t));
+
+                  LogPtr->First = (LogPtr->First + EntryHdr.EntrySize) % CFE_EVS_LOG_DATA_SIZE;
+                  LogPtr->Used -= EntryHdr.EntrySize;
+                  LogPtr->LogCount--;
+               }
+
+               /* An event too big for the whole log is not stored */
+               if (EntrySize > (CFE_EVS_LOG_DATA_SIZE - LogPtr->Used))
+               {
+                  EntrySize = 0;
+               }
+            }
+         }
+      }
+
+      if (EntrySize != 0)
+      {
+         EntryHdr.EntrySize   = EntrySize;
+         EntryHdr.TextLength  = TextLength;
+         EntryHdr.RepeatCount = 1;
+         EntryHdr.LastTime    = Time;
+         CFE_PSP_MemCpy(EntryHdr.TlmHeader, EVS_PktPtr->TlmHeader, sizeof(EntryHdr.TlmHeader));
+         CFE_PSP_MemCpy(&EntryHdr.PacketID, &EVS_PktPtr->Payload.PacketID, sizeof(CFE_EVS_PacketID_t));
+
+         /* Copy the event header and text to the next available space in the log */
+         EVS_WriteLogData(LogPtr->Next, &EntryHdr, sizeof(CFE_EVS_LogEntryHdr_t));
+         Offset = (LogPtr->Next + sizeof(CFE_EVS_LogEntryHdr_t)) % CFE_EVS_LOG_DATA_SIZE;
+         EVS_WriteLogData(Offset, EVS_PktPtr->Payload.Message, TextLength);
+
+         if (LogPtr->LogCount == 0)
+         {
+            LogPtr->First = LogPtr->Next;
+         }
+
+         LogPtr->Last = LogPtr->Next;
+         LogPtr->Next = (LogPtr->Next + EntrySize) % CFE_EVS_LOG_DATA_SIZE;
+         LogPtr->Used += EntrySize;
+         LogPtr->LogCount++;
+      }
+
+      OS_MutSemGive(CFE_EVS_GlobalData.EVS_SharedDataMutexID);
+   }
+
+   return;
+
+} /* End EVS_AddLog */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_ClearLog
+**
+** Purpose:  This routine clears the contents of the internal event log.
+**
+** Assumptions and Notes:
+**
+*/
+void EVS_ClearLog ( void )
+{
+
+   /* Serialize access to event log control variables */
+   OS_MutSemTake(CFE_EVS_GlobalData.EVS_SharedDataMutexID);
+
+   /* Clears everything but LogMode (overwrite vs discard) */
+   CFE_EVS_GlobalData.EVS_LogPtr->Next = 0;
+   CFE_EVS_GlobalData.EVS_LogPtr->LogCount = 0;
+   CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag = FALSE;
+   CFE_EVS_GlobalData.EVS_LogPtr->LogOverflowCounter = 0;
+   CFE_EVS_GlobalData.EVS_LogPtr->First = 0;
+   CFE_EVS_GlobalData.EVS_LogPtr->Last = 0;
+   CFE_EVS_GlobalData.EVS_LogPtr->Used = 0;
+
+   CFE_PSP_MemSet(CFE_EVS_GlobalData.EVS_LogPtr->LogData, 0, CFE_EVS_LOG_DATA_SIZE);
+
+   OS_MutSemGive(CFE_EVS_GlobalData.EVS_SharedDataMutexID);
+
+   return;
+
+} /* End EVS_ClearLog */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_IsLogValid
+**
+** Purpose:  This routine returns TRUE if the entries of the compact event log
+**           (as found after a processor reset) are consistent with its offsets
+**           and counters, otherwise FALSE.
+**
+** Assumptions and Notes:
+**
+*/
+boolean EVS_IsLogValid ( void )
+{
+   CFE_EVS_Log_t         *LogPtr = CFE_EVS_GlobalData.EVS_LogPtr;
+   CFE_EVS_LogEntryHdr_t  EntryHdr;
+   uint32                 Offset;
+   uint32                 Size = 0;
+   uint32                 i;
+
+   if ((LogPtr->First >= CFE_EVS_LOG_DATA_SIZE) || (LogPtr->Last >= CFE_EVS_LOG_DATA_SIZE) ||
+       (LogPtr->Next >= CFE_EVS_LOG_DATA_SIZE) || (LogPtr->Used > CFE_EVS_LOG_DATA_SIZE))
+   {
+      return(FALSE);
+   }
+
+   /* Walk the entries from oldest to newest */
+   Offset = LogPtr->First;
+
+   for (i = 0; i < LogPtr->LogCount; i++)
+   {
+      EVS_ReadLogData(Offset, &EntryHdr, sizeof(CFE_EVS_LogEntryHdr_t));
+
+      if ((EntryHdr.TextLength > CFE_EVS_MAX_MESSAGE_LENGTH) ||
+          (EntryHdr.EntrySize != ((sizeof(CFE_EVS_LogEntryHdr_t) + EntryHdr.TextLength + 3) & ~3)) ||
+          (EntryHdr.EntrySize > (LogPtr->Used - Size)) ||
+          ((i == (LogPtr->LogCount - 1)) && (Offset != LogPtr->Last)))
+      {
+         return(FALSE);
+      }
+
+      Size += EntryHdr.EntrySize;
+      Offset = (Offset + EntryHdr.EntrySize) % CFE_EVS_LOG_DATA_SIZE;
+   }
+
+   return((Size == LogPtr->Used) && ((LogPtr->LogCount == 0) || (Offset == LogPtr->Next)));
+
+} /* End EVS_IsLogValid */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_WriteLogEntry
+**
+** Purpose:  This routine writes the compact event log entry at the given offset to
+**           the log file dump as full event packets: the first event of the entry and,
+**           if the event repeated, the last one with the repeat count ahead of its text.
+**           The offset is advanced to the next entry.  The number of packets written
+**           is returned.
+**
+** Assumptions and Notes:
+**           Write errors are kept in the dump writer and reported by the caller.
+**
+*/
+static uint32 EVS_WriteLogEntry (CFE_ES_DumpWriter_t *Writer, uint32 *OffsetPtr)
+{
+   CFE_EVS_LogEntryHdr_t EntryHdr;
+   CFE_EVS_Packet_t      LogPacket;
+   char                  Text[CFE_EVS_MAX_MESSAGE_LENGTH];
+
+   EVS_ReadLogData(*OffsetPtr, &EntryHdr, sizeof(CFE_EVS_LogEntryHdr_t));
+   EVS_ReadLogData((*OffsetPtr + sizeof(CFE_EVS_LogEntryHdr_t)) % CFE_EVS_LOG_DATA_SIZE,
+                   Text, EntryHdr.TextLength);
+   *OffsetPtr = (*OffsetPtr + EntryHdr.EntrySize) % CFE_EVS_LOG_DATA_SIZE;
+
+   CFE_PSP_MemSet(&LogPacket, 0, sizeof(CFE_EVS_Packet_t));
+   CFE_PSP_MemCpy(LogPacket.TlmHeader, EntryHdr.TlmHeader, sizeof(LogPacket.TlmHeader));
+   CFE_PSP_MemCpy(&LogPacket.Payload.PacketID, &EntryHdr.PacketID, sizeof(CFE_EVS_PacketID_t));
+   CFE_PSP_MemCpy(LogPacket.Payload.Message, Text, EntryHdr.TextLength);
+
+   CFE_ES_DumpWrite(Writer, &LogPacket, sizeof(CFE_EVS_Packet_t));
+
+   if (EntryHdr.RepeatCount <= 1)
+   {
+      return(1);
+   }
+
+   CFE_SB_SetMsgTime((CFE_SB_Msg_t *) &LogPacket, EntryHdr.LastTime);
+   snprintf(LogPacket.Payload.Message, CFE_EVS_MAX_MESSAGE_LENGTH, "Repeated %lu times: %.*s",
+            (unsigned long) EntryHdr.RepeatCount, (int) EntryHdr.TextLength, Text);
+
+   CFE_ES_DumpWrite(Writer, &LogPacket, sizeof(CFE_EVS_Packet_t));
+
+   return(2);
+
+} /* End EVS_WriteLogEntry */
+
+#else
+
 /*
 **             Function Prologue
 **
@@ -184,6 +520,8 @@ void EVS_ClearLog ( void )
 
 } /* End EVS_ClearLog */
 
+#endif
+
 
 /*
 **             Function Prologue
@@ -199,10 +537,15 @@ boolean CFE_EVS_WriteLogFileCmd (CFE_SB_MsgPayloadPtr_t Payload)
 {
    const CFE_EVS_LogFileCmd_Payload_t *CmdPtr = (const CFE_EVS_LogFileCmd_Payload_t *)Payload;
    boolean         Result = FALSE;
-   int32           LogIndex;
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+   uint32          LogOffset;
+   uint32          i;
+#else
+   uint32          LogIndex;
+#endif
+   uint32          PacketCount = 0;
    int32           BytesWritten;
    int32           LogFileHandle;
-   uint32          i;
    CFE_FS_Header_t LogFileHdr;
    char            LogFilename[OS_MAX_PATH_LEN];
 
@@ -233,8 +576,24 @@ boolean CFE_EVS_WriteLogFileCmd (CFE_SB_MsgPayloadPtr_t Payload)
 
       if (BytesWritten == sizeof(CFE_FS_Header_t))
       {
+         CFE_ES_DumpInit(&EVS_LogDumpWriter, LogFileHandle);
+
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+
+         /* Write all the "in-use" event log entries to the file, oldest first */
+         LogOffset = CFE_EVS_GlobalData.EVS_LogPtr->First;
+
+         for (i = 0; i < CFE_EVS_GlobalData.EVS_LogPtr->LogCount; i++)
+         {
+            PacketCount += EVS_WriteLogEntry(&EVS_LogDumpWriter, &LogOffset);
+         }
+
+#else
+
+         PacketCount = CFE_EVS_GlobalData.EVS_LogPtr->LogCount;
+
          /* Is the log full? -- Doesn't matter if wrap mode is enabled */
-         if (CFE_EVS_GlobalData.EVS_LogPtr->LogCount == CFE_EVS_LOG_MAX)
+         if (PacketCount == CFE_EVS_LOG_MAX)
          {
             /* Start with log entry that will be overwritten next (oldest) */
             LogIndex = CFE_EVS_GlobalData.EVS_LogPtr->Next;
@@ -245,39 +604,29 @@ boolean CFE_EVS_WriteLogFileCmd (CFE_SB_MsgPayloadPtr_t Payload)
             LogIndex = 0;
          }
 
-         /* Write all the "in-use" event log entries to the file */
-         for (i = 0; i < CFE_EVS_GlobalData.EVS_LogPtr->LogCount; i++)
-         {
-            BytesWritten = OS_write(LogFileHandle,
-                                    &CFE_EVS_GlobalData.EVS_LogPtr->LogEntry[LogIndex],
-                                    sizeof(CFE_EVS_Packet_t));
-
-            if (BytesWritten == sizeof(CFE_EVS_Packet_t))
-            {
-               LogIndex++;
+         /* Write all the "in-use" event log entries to the file, across the end of the log */
+         CFE_ES_DumpWriteRing(&EVS_LogDumpWriter, CFE_EVS_GlobalData.EVS_LogPtr->LogEntry,
+                              CFE_EVS_LOG_MAX * sizeof(CFE_EVS_Packet_t),
+                              LogIndex * sizeof(CFE_EVS_Packet_t),
+                              PacketCount * sizeof(CFE_EVS_Packet_t));
 
-               if (LogIndex >= CFE_EVS_LOG_MAX)
-               {
-                  LogIndex = 0;
-               }
-            }
-            else
-            {
-               EVS_SendEvent(CFE_EVS_ERR_WRLOGFILE_EID, CFE_EVS_ERROR,
-                            "Write Log File Command Error: OS_write = 0x%08X, filename = %s",
-                            (unsigned int)BytesWritten, LogFilename);
-               break;
-            }
-         }
+#endif
 
          /* Process command handler success result */
-         if (i == CFE_EVS_GlobalData.EVS_LogPtr->LogCount)
+         if (CFE_ES_DumpFinish(&EVS_LogDumpWriter) == CFE_SUCCESS)
          {
             EVS_SendEvent(CFE_EVS_WRLOG_EID, CFE_EVS_DEBUG,
-                         "Write Log File Command: %d event log entries written to %s",
-                          (int)CFE_EVS_GlobalData.EVS_LogPtr->LogCount, LogFilename);
+                         "Write Log File Command: %d entries written to %s,%dmS,%d B/s",
+                          (int)PacketCount, LogFilename,
+                          (int)EVS_LogDumpWriter.ElapsedMsec, (int)EVS_LogDumpWriter.BytesPerSec);
             Result = TRUE;
          }
+         else
+         {
+            EVS_SendEvent(CFE_EVS_ERR_WRLOGFILE_EID, CFE_EVS_ERROR,
+                         "Write Log File Command Error: OS_write = 0x%08X, filename = %s",
+                         (unsigned int)EVS_LogDumpWriter.WriteStatus, LogFilename);
+         }
       }
 
       OS_close(LogFileHandle);
@@ -117,6 +117,9 @@
 
 void    EVS_AddLog ( CFE_EVS_Packet_t *EVS_PktPtr );
 void    EVS_ClearLog ( void );
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+boolean EVS_IsLogValid ( void );
+#endif
 boolean CFE_EVS_WriteLogFileCmd (CFE_SB_MsgPayloadPtr_t Payload);
 boolean CFE_EVS_SetLoggingModeCmd (CFE_SB_MsgPayloadPtr_t Payload);                          
 
@@ -159,6 +159,12 @@ boolean CFE_EVS_VerifyCmdLength(CFE_SB_MsgPtr_t Msg, uint16 ExpectedLength);
 int32 CFE_EVS_EarlyInit ( void )
 {
 
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+
+   uint32               i;
+
+#endif
+
 #ifdef CFE_EVS_LOG_ON
 
    int32                Status;
@@ -172,6 +178,14 @@ int32 CFE_EVS_EarlyInit ( void )
 
    CFE_EVS_GlobalData.EVS_AppID = CFE_EVS_UNDEF_APPID;
 
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+   /* Give each deferred event slot to the writer of the first lap */
+   for (i = 0; i < CFE_EVS_DEFERRED_QUEUE_DEPTH; i++)
+   {
+      CFE_EVS_GlobalData.DeferredQueue.Event[i].Seq = i;
+   }
+#endif
+
    /* Initialize housekeeping packet */
    CFE_SB_InitMsg(&CFE_EVS_GlobalData.EVS_TlmPkt, CFE_EVS_HK_TLM_MID,
                    CFE_EVS_HK_TLM_LNGTH, FALSE);
@@ -227,7 +241,11 @@ int32 CFE_EVS_EarlyInit ( void )
                    (CFE_EVS_GlobalData.EVS_LogPtr->LogMode != CFE_EVS_LOG_DISCARD))  ||
                   ((CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag != FALSE)   &&
                    (CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag != TRUE))   ||
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+                   (EVS_IsLogValid() == FALSE))
+#else
                    (CFE_EVS_GlobalData.EVS_LogPtr->Next >= CFE_EVS_LOG_MAX))
+#endif
          {
             CFE_ES_WriteToSysLog("Event Log cleared, n=%d, c=%d, f=%d, m=%d, o=%d\n",
                                   (int)CFE_EVS_GlobalData.EVS_LogPtr->Next,
@@ -327,17 +345,34 @@ void CFE_EVS_TaskMain(void)
     
         CFE_ES_PerfLogExit(CFE_EVS_MAIN_PERF_ID);
 
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+        /* Pend on receipt of packet, waking up to send deferred events */
+        Status = CFE_SB_RcvMsg(&EVS_MsgPtr, 
+                               CFE_EVS_GlobalData.EVS_CommandPipe, 
+                               CFE_EVS_DEFERRED_SEND_MSEC);
+#else
         /* Pend on receipt of packet */
         Status = CFE_SB_RcvMsg(&EVS_MsgPtr, 
                                CFE_EVS_GlobalData.EVS_CommandPipe, 
                                CFE_SB_PEND_FOREVER);
+#endif
 
         CFE_ES_PerfLogEntry(CFE_EVS_MAIN_PERF_ID);
 
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+        /* Send the events other tasks have queued, before any command changes the settings */
+        EVS_SendDeferredEvents();
+#endif
+
         if (Status == CFE_SUCCESS)
         {
             /* Process cmd pipe msg */
             CFE_EVS_ProcessCommandPacket(EVS_MsgPtr);
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+        }else if (Status == CFE_SB_TIME_OUT){
+            /* No command arrived, only the deferred events needed sending */
+            Status = CFE_SUCCESS;
+#endif
         }else{            
             CFE_ES_WriteToSysLog("EVS:Error reading cmd pipe,RC=0x%08X\n",(unsigned int)Status);
         }/* end if */
@@ -847,7 +882,7 @@ boolean CFE_EVS_SetFilterMaskCmd (const CFE_SB_MsgPayloadPtr_t Payload)
    {
       AppDataPtr = &CFE_EVS_GlobalData.AppData[AppID];
 
-      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
       if(FilterPtr != NULL)
       {
@@ -1528,7 +1563,7 @@ boolean CFE_EVS_ResetFilterCmd (const CFE_SB_MsgPayloadPtr_t Payload)
    {
       AppDataPtr = &CFE_EVS_GlobalData.AppData[AppID];
 
-      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
       if(FilterPtr != NULL)
       {
@@ -1675,7 +1710,7 @@ boolean CFE_EVS_AddEventFilterCmd (const CFE_SB_MsgPayloadPtr_t Payload)
       AppDataPtr = &CFE_EVS_GlobalData.AppData[AppID];
 
       /* Check to see if this event is already registered for filtering */
-      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
       /* FilterPtr != NULL means that this Event ID was found as already being registered */
       if (FilterPtr != NULL)
@@ -1688,7 +1723,7 @@ boolean CFE_EVS_AddEventFilterCmd (const CFE_SB_MsgPayloadPtr_t Payload)
       else
       {
           /* now check to see if there is a free slot */
-           FilterPtr = EVS_FindEventID(CFE_EVS_FREE_SLOT, AppDataPtr->BinFilters);
+           FilterPtr = EVS_FindFreeFilter(AppDataPtr);
 
             if (FilterPtr != NULL)
             {
@@ -1696,6 +1731,7 @@ boolean CFE_EVS_AddEventFilterCmd (const CFE_SB_MsgPayloadPtr_t Payload)
                FilterPtr->EventID = CmdPtr->EventID;
                FilterPtr->Mask = CmdPtr->Mask;
                FilterPtr->Count = 0;
+               EVS_IndexFilters(AppDataPtr);
 
                EVS_SendEvent(CFE_EVS_ADDFILTER_EID, CFE_EVS_DEBUG,
                                  "Add Filter Command Received with AppName = %s, EventID = 0x%08x, Mask = 0x%04x",
@@ -1773,7 +1809,7 @@ boolean CFE_EVS_DeleteEventFilterCmd (const CFE_SB_MsgPayloadPtr_t Payload)
    {
       AppDataPtr = &CFE_EVS_GlobalData.AppData[AppID];
 
-      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+      FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
       if(FilterPtr != NULL)
       {
@@ -1781,6 +1817,7 @@ boolean CFE_EVS_DeleteEventFilterCmd (const CFE_SB_MsgPayloadPtr_t Payload)
          FilterPtr->EventID = CFE_EVS_FREE_SLOT;
          FilterPtr->Mask = CFE_EVS_NO_MASK;
          FilterPtr->Count = 0;
+         EVS_IndexFilters(AppDataPtr);
 
          EVS_SendEvent(CFE_EVS_DELFILTER_EID, CFE_EVS_DEBUG,
                            "Delete Filter Command Received with AppName = %s, EventID = 0x%08x",
@@ -96,6 +96,7 @@
 
 #define CFE_EVS_MSG_TRUNCATED           '$'
 #define CFE_EVS_FREE_SLOT               (-1)
+#define CFE_EVS_FILTER_HASH_SIZE        (2 * CFE_EVS_MAX_EVENT_FILTERS)
 #define CFE_EVS_NO_MASK                 0
 #define CFE_EVS_PIPE_DEPTH              32
 #define CFE_EVS_MSG_LIMIT               4
@@ -104,6 +105,8 @@
 #define CFE_EVS_PIPE_NAME               "EVS_CMD_PIPE"
 #define CFE_EVS_UNDEF_APPID             0xFFFFFFFF
 #define CFE_EVS_MAX_PORT_MSG_LENGTH     (CFE_EVS_MAX_MESSAGE_LENGTH+OS_MAX_API_NAME+30)
+#define CFE_EVS_DEFERRED_MAX_ARGS       8
+#define CFE_EVS_DEFERRED_SPEC_LENGTH    32
 
 /* Since CFE_EVS_MAX_PORT_MSG_LENGTH is the size of the buffer that is sent to 
  * print out (using OS_printf), we need to check to make sure that the buffer 
@@ -129,6 +132,8 @@ typedef struct
 typedef struct
 {
     EVS_BinFilter_t    BinFilters[CFE_EVS_MAX_EVENT_FILTERS];  /* Array of binary filters */
+    uint16             FilterHash[2][CFE_EVS_FILTER_HASH_SIZE]; /* Binary filter index + 1 by event ID, 0 if unused */
+    uint32             FilterHashIdx;          /* FilterHash used for lookups, the other one is rebuilt */
 
     uint8              ActiveFlag;             /* Application event service active flag */
     uint8              EventTypesActiveFlag;   /* Application event types active flag */
@@ -148,6 +153,45 @@ typedef struct {
 } CFE_EVS_AppDataFile_t;
 
 
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+
+/* One argument of a deferred event, a %s argument holds the offset of its copy in Strings */
+typedef union
+{
+   long long           Integer;
+   double              Float;
+   const void         *Pointer;
+
+} EVS_DeferredArg_t;
+
+
+typedef struct
+{
+   volatile uint32     Seq;                                    /* Tells writers and the EVS task whose turn it is */
+   uint32              AppID;                                  /* Application that sent the event */
+   uint16              EventID;                                /* Numerical event identifier */
+   uint16              EventType;                              /* Event type */
+   CFE_TIME_SysTime_t  Time;                                   /* Time the event was sent */
+   char                Spec[CFE_EVS_MAX_MESSAGE_LENGTH];       /* Copy of the caller's format string */
+   EVS_DeferredArg_t   Args[CFE_EVS_DEFERRED_MAX_ARGS];        /* Arguments in format string order */
+   char                Strings[CFE_EVS_MAX_MESSAGE_LENGTH];    /* Copies of the %s arguments */
+
+} EVS_DeferredEvent_t;
+
+
+/* Writers claim events at Tail, only the EVS task moves Head */
+typedef struct
+{
+   volatile uint32     Tail;
+   uint32              Head;
+   volatile uint32     DropCounter;                            /* Events discarded because the queue was full */
+   EVS_DeferredEvent_t Event[CFE_EVS_DEFERRED_QUEUE_DEPTH];
+
+} EVS_DeferredQueue_t;
+
+#endif
+
+
 /* Global data structure */
 typedef struct
 {
@@ -164,6 +208,10 @@ typedef struct
    uint32              EVS_SharedDataMutexID;
    uint32              EVS_AppID;
 
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+   EVS_DeferredQueue_t DeferredQueue;   /* Events waiting to be formatted by the EVS task */
+#endif
+
 } CFE_EVS_GlobalData_t;
 
 /*
@@ -93,6 +93,7 @@
 #include "cfe_psp.h"          /* cFE PSP glue functions */
 #include "cfe_sb.h"          /* Software Bus library function definitions */
 #include "cfe_es.h"
+#include "private/cfe_atomic.h"
 
 /* Local Function Prototypes */
 void EVS_SendViaPorts (CFE_EVS_Packet_t *EVS_PktPtr);
@@ -100,6 +101,9 @@ void EVS_OutputPort1 (char *Message);
 void EVS_OutputPort2 (char *Message);
 void EVS_OutputPort3 (char *Message);
 void EVS_OutputPort4 (char *Message);
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+uint32 EVS_CopyText (const char *Text, const char *End, char *Message, uint32 Size, uint32 Used);
+#endif
 
 /* Function Definitions */
 
@@ -291,7 +295,7 @@ boolean EVS_IsFiltered (uint32 AppID, uint16 EventID, uint16 EventType)
    /* Is this type of event enabled for this application? */
    if (Filtered == FALSE)
    {
-      FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+      FilterPtr = EVS_FindEventID(EventID, AppDataPtr);
 
       /* Does this event ID have an event filter table entry? */
       if (FilterPtr != NULL)
@@ -330,27 +334,128 @@ boolean EVS_IsFiltered (uint32 AppID, uint16 EventID, uint16 EventType)
 **
 ** Function Name:      EVS_FindEventID
 **
-** Purpose:  This routine searches and returns an index to the given Event ID with the
-**           given application filter array.
+** Purpose:  This routine returns a pointer to the filter of the given Event ID in the
+**           given application's filter array, or NULL if the Event ID has no filter.
 **
 ** Assumptions and Notes:
+**   The filter hash must be current, see EVS_IndexFilters.  The hash is never more
+**   than half full, so the search ends at an unused entry after a few probes.
+**   Lookups take no lock, they use whichever hash was complete when they started.
 **
 */
-EVS_BinFilter_t *EVS_FindEventID (int16 EventID, EVS_BinFilter_t *FilterArray)
+EVS_BinFilter_t *EVS_FindEventID (int16 EventID, EVS_AppData_t *AppDataPtr)
+{
+   EVS_BinFilter_t *FilterPtr;
+   const uint16    *HashPtr;
+   uint32           Slot;
+   uint16           Index;
+
+   /* Unused filters hold CFE_EVS_FREE_SLOT and are not in the hash */
+   if (EventID == CFE_EVS_FREE_SLOT)
+   {
+      return(EVS_FindFreeFilter(AppDataPtr));
+   }
+
+   HashPtr = AppDataPtr->FilterHash[CFE_ATOMIC_LOAD(&AppDataPtr->FilterHashIdx) & 1];
+   Slot = (uint16) EventID % CFE_EVS_FILTER_HASH_SIZE;
+
+   while ((Index = HashPtr[Slot]) != 0)
+   {
+      FilterPtr = &AppDataPtr->BinFilters[Index - 1];
+
+      if (FilterPtr->EventID == EventID)
+      {
+         return(FilterPtr);
+      }
+
+      Slot = (Slot + 1) % CFE_EVS_FILTER_HASH_SIZE;
+   }
+
+   return((EVS_BinFilter_t *) NULL);
+
+} /* End EVS_FindEventID */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_FindFreeFilter
+**
+** Purpose:  This routine returns a pointer to an unused filter in the given
+**           application's filter array, or NULL if all filters are in use.
+**
+** Assumptions and Notes:
+**
+*/
+EVS_BinFilter_t *EVS_FindFreeFilter (EVS_AppData_t *AppDataPtr)
 {
    uint32 i;
 
    for (i = 0; i < CFE_EVS_MAX_EVENT_FILTERS; i++)
    {
-      if (FilterArray[i].EventID == EventID)
+      if (AppDataPtr->BinFilters[i].EventID == CFE_EVS_FREE_SLOT)
       {
-         return(&FilterArray[i]);
+         return(&AppDataPtr->BinFilters[i]);
       }
    }
 
    return((EVS_BinFilter_t *) NULL);
 
-} /* End EVS_FindEventID */
+} /* End EVS_FindFreeFilter */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_IndexFilters
+**
+** Purpose:  This routine rebuilds the filter hash of the given application from its
+**           filter array.  It must be called whenever a filter Event ID is changed.
+**
+** Assumptions and Notes:
+**   Filters are entered in array order, so when an Event ID appears twice in the
+**   array the lookup finds the first one, as the former linear search did.
+**   The new hash is built in the copy lookups are not using and then swapped in,
+**   so a lookup running meanwhile never sees a partly built hash.  Rebuilds hold
+**   the shared data mutex so that two of them cannot build the same hash.
+**
+*/
+void EVS_IndexFilters (EVS_AppData_t *AppDataPtr)
+{
+   uint16 *HashPtr;
+   uint32  NewIdx;
+   uint32  i;
+   uint32  Slot;
+
+   OS_MutSemTake(CFE_EVS_GlobalData.EVS_SharedDataMutexID);
+
+   NewIdx = (AppDataPtr->FilterHashIdx + 1) & 1;
+   HashPtr = AppDataPtr->FilterHash[NewIdx];
+
+   CFE_PSP_MemSet(HashPtr, 0, sizeof(AppDataPtr->FilterHash[0]));
+
+   for (i = 0; i < CFE_EVS_MAX_EVENT_FILTERS; i++)
+   {
+      if (AppDataPtr->BinFilters[i].EventID != CFE_EVS_FREE_SLOT)
+      {
+         Slot = (uint16) AppDataPtr->BinFilters[i].EventID % CFE_EVS_FILTER_HASH_SIZE;
+
+         while (HashPtr[Slot] != 0)
+         {
+            Slot = (Slot + 1) % CFE_EVS_FILTER_HASH_SIZE;
+         }
+
+         HashPtr[Slot] = (uint16) (i + 1);
+      }
+   }
+
+   /* The hash must be complete before lookups can start using it */
+   CFE_ATOMIC_BARRIER();
+   AppDataPtr->FilterHashIdx = NewIdx;
+
+   OS_MutSemGive(CFE_EVS_GlobalData.EVS_SharedDataMutexID);
+
+} /* End EVS_IndexFilters */
 
 
 /*
@@ -647,4 +752,540 @@ int32 EVS_SendEvent (uint16 EventID, uint16 EventType, const char *Spec, ... )
 } /* End EVS_SendEvent */
 
 
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_GenerateEvent
+**
+** Purpose:  This routine formats an event message and sends it out the
+**           software bus and all enabled output ports, or, if deferred
+**           sending is enabled, queues the event for the EVS task to do so.
+**
+** Assumptions and Notes:  The caller has checked that the application is
+**           registered and the event is unfiltered.  ArgPtr is left for the
+**           caller to end.
+*/
+void EVS_GenerateEvent(uint32 AppID, CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType,
+                       const char *Spec, va_list ArgPtr)
+{
+   int32              ExpandedLength;
+   CFE_EVS_Packet_t   EVS_Packet;
+
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+
+   if (EVS_DeferEvent(AppID, Time, EventID, EventType, Spec, ArgPtr) == TRUE)
+   {
+      return;
+   }
+
+#endif
+
+   /* Initialize EVS event packet */
+   CFE_SB_InitMsg(&EVS_Packet, CFE_EVS_EVENT_MSG_MID, sizeof(CFE_EVS_Packet_t), TRUE);
+   EVS_Packet.Payload.PacketID.EventID   = EventID;
+   EVS_Packet.Payload.PacketID.EventType = EventType;
+
+   /* vsnprintf() returns the total expanded length of the formatted string */
+   /* vsnprintf() copies and zero terminates portion that fits in the buffer */
+   ExpandedLength = vsnprintf((char *)EVS_Packet.Payload.Message, sizeof(EVS_Packet.Payload.Message), Spec, ArgPtr);
+
+   /* Were any characters truncated in the buffer? */
+   if (ExpandedLength >= sizeof(EVS_Packet.Payload.Message))
+   {
+      /* Mark character before zero terminator to indicate truncation */
+      EVS_Packet.Payload.Message[sizeof(EVS_Packet.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
+      CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter++;
+   }
+
+   /* Send the event packet */
+   EVS_SendPacket(AppID, Time, &EVS_Packet);
+
+} /* End EVS_GenerateEvent */
+
+
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_FindConversion
+**
+** Purpose:  This routine finds the next printf conversion that takes an
+**           argument in an event format string and works out the type of
+**           the argument.
+**
+** Assumptions and Notes:  "%%" is skipped.  Conversions the deferred queue
+**           cannot carry, such as %n, %Lf, %ls or a '*' width or precision,
+**           are returned with an ArgType of EVS_ARG_UNSUPPORTED.
+*/
+boolean EVS_FindConversion(const char *Text, EVS_Conversion_t *ConvPtr)
+{
+   const char  *Ptr = Text;
+   uint32       ArgType = EVS_ARG_INT;
+
+   while ((*Ptr != '\0') && ((*Ptr != '%') || (Ptr[1] == '%')))
+   {
+      Ptr += (*Ptr == '%') ? 2 : 1;
+   }
+
+   if (*Ptr == '\0')
+   {
+      return(FALSE);
+   }
+
+   ConvPtr->Start = Ptr;
+   ConvPtr->Precision = -1;
+   Ptr++;
+
+   /* Flags and field width */
+   while ((*Ptr == '-') || (*Ptr == '+') || (*Ptr == ' ') || (*Ptr == '#') ||
+          ((*Ptr >= '0') && (*Ptr <= '9')))
+   {
+      Ptr++;
+   }
+
+   /* Precision */
+   if (*Ptr == '.')
+   {
+      Ptr++;
+      ConvPtr->Precision = 0;
+      while ((*Ptr >= '0') && (*Ptr <= '9'))
+      {
+         if (ConvPtr->Precision < CFE_EVS_MAX_MESSAGE_LENGTH)
+         {
+            ConvPtr->Precision = (ConvPtr->Precision * 10) + (*Ptr - '0');
+         }
+         Ptr++;
+      }
+   }
+
+   /* Length modifier, char and short arguments are promoted to int */
+   if (*Ptr == 'h')
+   {
+      Ptr += (Ptr[1] == 'h') ? 2 : 1;
+   }
+   else if (*Ptr == 'l')
+   {
+      ArgType = (Ptr[1] == 'l') ? EVS_ARG_LONGLONG : EVS_ARG_LONG;
+      Ptr += (Ptr[1] == 'l') ? 2 : 1;
+   }
+   else if (*Ptr == 'z')
+   {
+      ArgType = EVS_ARG_SIZE;
+      Ptr++;
+   }
+
+   switch (*Ptr)
+   {
+      case 'd': case 'i': case 'o': case 'u': case 'x': case 'X':
+         break;
+
+      case 'c':
+         ArgType = (ArgType == EVS_ARG_INT) ? EVS_ARG_INT : EVS_ARG_UNSUPPORTED;
+         break;
+
+      case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+         ArgType = EVS_ARG_DOUBLE;
+         break;
+
+      case 'p':
+         ArgType = EVS_ARG_POINTER;
+         break;
+
+      case 's':
+         ArgType = (ArgType == EVS_ARG_INT) ? EVS_ARG_STRING : EVS_ARG_UNSUPPORTED;
+         break;
+
+      default:
+         ArgType = EVS_ARG_UNSUPPORTED;
+         break;
+   }
+
+   if (*Ptr != '\0')
+   {
+      Ptr++;
+   }
+
+   ConvPtr->Length = Ptr - ConvPtr->Start;
+   ConvPtr->ArgType = (ConvPtr->Length < CFE_EVS_DEFERRED_SPEC_LENGTH) ? ArgType : EVS_ARG_UNSUPPORTED;
+
+   return(TRUE);
+
+} /* End EVS_FindConversion */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_DeferEvent
+**
+** Purpose:  This routine copies an event and its arguments into the deferred
+**           event queue, for the EVS task to format and send.
+**
+** Assumptions and Notes:  Returns FALSE, without using the queue, if the
+**           format string is too long to copy, has a conversion the queue
+**           cannot carry, more than CFE_EVS_DEFERRED_MAX_ARGS arguments or
+**           more string data than fits; the caller then formats the event
+**           itself.  Returns TRUE if the event was queued, or discarded and
+**           counted because the queue was full.  Any number of tasks may call
+**           this routine at once.
+*/
+boolean EVS_DeferEvent(uint32 AppID, CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType,
+                       const char *Spec, va_list ArgPtr)
+{
+   EVS_DeferredQueue_t *QueuePtr = &CFE_EVS_GlobalData.DeferredQueue;
+   EVS_DeferredEvent_t *EventPtr;
+   EVS_DeferredArg_t    Args[CFE_EVS_DEFERRED_MAX_ARGS];
+   uint32               ArgTypes[CFE_EVS_DEFERRED_MAX_ARGS];
+   uint32               StrLength[CFE_EVS_DEFERRED_MAX_ARGS];
+   EVS_Conversion_t     Conv;
+   const char          *Text = Spec;
+   const char          *StrPtr;
+   boolean              Supported = TRUE;
+   uint32               ArgCount = 0;
+   uint32               StrUsed = 0;
+   uint32               StrLimit;
+   uint32               SpecLength = 0;
+   uint32               Pos;
+   uint32               Seq;
+   uint32               i;
+   va_list              Ptr;
+
+   /* The format string is copied too, the caller's copy may not outlive the event */
+   while ((SpecLength < sizeof(QueuePtr->Event[0].Spec)) && (Spec[SpecLength] != '\0'))
+   {
+      SpecLength++;
+   }
+
+   if (SpecLength == sizeof(QueuePtr->Event[0].Spec))
+   {
+      return(FALSE);
+   }
+
+   /* Pick up the arguments with the types the format string gives them */
+   va_copy(Ptr, ArgPtr);
+
+   while ((Supported == TRUE) && (EVS_FindConversion(Text, &Conv) == TRUE))
+   {
+      if (ArgCount == CFE_EVS_DEFERRED_MAX_ARGS)
+      {
+         Supported = FALSE;
+         break;
+      }
+
+      ArgTypes[ArgCount] = Conv.ArgType;
+      StrLength[ArgCount] = 0;
+
+      switch (Conv.ArgType)
+      {
+         case EVS_ARG_INT:
+            Args[ArgCount].Integer = va_arg(Ptr, int);
+            break;
+
+         case EVS_ARG_LONG:
+            Args[ArgCount].Integer = va_arg(Ptr, long);
+            break;
+
+         case EVS_ARG_LONGLONG:
+            Args[ArgCount].Integer = va_arg(Ptr, long long);
+            break;
+
+         case EVS_ARG_SIZE:
+            Args[ArgCount].Integer = va_arg(Ptr, size_t);
+            break;
+
+         case EVS_ARG_DOUBLE:
+            Args[ArgCount].Float = va_arg(Ptr, double);
+            break;
+
+         case EVS_ARG_POINTER:
+            Args[ArgCount].Pointer = va_arg(Ptr, void *);
+            break;
+
+         case EVS_ARG_STRING:
+            /* Measure the string, it is copied once the event has a slot */
+            StrPtr = va_arg(Ptr, const char *);
+            StrLimit = sizeof(QueuePtr->Event[0].Strings) - StrUsed;
+
+            if ((Conv.Precision >= 0) && ((uint32)Conv.Precision < StrLimit))
+            {
+               StrLimit = Conv.Precision;
+            }
+
+            while ((StrPtr != NULL) && (StrLength[ArgCount] < StrLimit) && (StrPtr[StrLength[ArgCount]] != '\0'))
+            {
+               StrLength[ArgCount]++;
+            }
+
+            if ((StrPtr == NULL) || ((StrUsed + StrLength[ArgCount] + 1) > sizeof(QueuePtr->Event[0].Strings)))
+            {
+               Supported = FALSE;
+            }
+
+            Args[ArgCount].Pointer = StrPtr;
+            StrUsed += StrLength[ArgCount] + 1;
+            break;
+
+         default:
+            Supported = FALSE;
+            break;
+      }
+
+      ArgCount++;
+      Text = Conv.Start + Conv.Length;
+   }
+
+   va_end(Ptr);
+
+   if (Supported == FALSE)
+   {
+      return(FALSE);
+   }
+
+   /* Claim the event at the tail, unless the EVS task has not freed it yet */
+   Pos = CFE_ATOMIC_LOAD(&QueuePtr->Tail);
+   for (;;)
+   {
+      EventPtr = &QueuePtr->Event[Pos & (CFE_EVS_DEFERRED_QUEUE_DEPTH - 1)];
+      Seq = CFE_ATOMIC_LOAD(&EventPtr->Seq);
+
+      if ((int32)(Seq - Pos) < 0)
+      {
+         CFE_ATOMIC_INC(&QueuePtr->DropCounter);
+         return(TRUE);
+      }
+
+      if ((Seq == Pos) && (CFE_ATOMIC_CAS(&QueuePtr->Tail, Pos, Pos + 1)))
+      {
+         break;
+      }
+
+      Pos = CFE_ATOMIC_LOAD(&QueuePtr->Tail);
+   }
+
+   EventPtr->AppID     = AppID;
+   EventPtr->EventID   = EventID;
+   EventPtr->EventType = EventType;
+   EventPtr->Time      = Time;
+   memcpy(EventPtr->Spec, Spec, SpecLength + 1);
+
+   /* Strings are copied into the event in place of their pointers */
+   StrUsed = 0;
+   for (i = 0; i < ArgCount; i++)
+   {
+      if (ArgTypes[i] == EVS_ARG_STRING)
+      {
+         memcpy(&EventPtr->Strings[StrUsed], Args[i].Pointer, StrLength[i]);
+         EventPtr->Strings[StrUsed + StrLength[i]] = '\0';
+         EventPtr->Args[i].Integer = StrUsed;
+         StrUsed += StrLength[i] + 1;
+      }
+      else
+      {
+         EventPtr->Args[i] = Args[i];
+      }
+   }
+
+   /* Hand the event to the EVS task */
+   CFE_ATOMIC_BARRIER();
+   EventPtr->Seq = Pos + 1;
+
+   return(TRUE);
+
+} /* End EVS_DeferEvent */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_CopyText
+**
+** Purpose:  This routine copies the text of a format string up to End, or
+**           to its end if End is NULL, into an event message, printing "%%"
+**           as '%'.
+**
+** Assumptions and Notes:  Used is the expanded length of the message so far,
+**           the new expanded length is returned.  Characters that do not fit
+**           are counted but not copied.
+*/
+uint32 EVS_CopyText (const char *Text, const char *End, char *Message, uint32 Size, uint32 Used)
+{
+   while ((Text != End) && (*Text != '\0'))
+   {
+      if (Used < (Size - 1))
+      {
+         Message[Used] = *Text;
+      }
+
+      Used++;
+      Text += (*Text == '%') ? 2 : 1;
+   }
+
+   return(Used);
+
+} /* End EVS_CopyText */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_FormatDeferredEvent
+**
+** Purpose:  This routine builds the event packet of a deferred event, giving
+**           the same message text that vsnprintf would have.
+**
+** Assumptions and Notes:  The event was checked by EVS_DeferEvent, so each
+**           conversion in its format string has a supported argument type.
+**           Each conversion is printed on its own, with its saved argument.
+*/
+void EVS_FormatDeferredEvent(EVS_DeferredEvent_t *EventPtr, CFE_EVS_Packet_t *EVS_PktPtr)
+{
+   char               *Message = (char *)EVS_PktPtr->Payload.Message;
+   uint32              Size = sizeof(EVS_PktPtr->Payload.Message);
+   char                ConvSpec[CFE_EVS_DEFERRED_SPEC_LENGTH];
+   EVS_DeferredArg_t  *ArgPtr = EventPtr->Args;
+   EVS_Conversion_t    Conv;
+   const char         *Text = EventPtr->Spec;
+   char               *Dest;
+   uint32              Room;
+   uint32              Used = 0;
+   int32               Length = 0;
+
+   /* Initialize EVS event packet */
+   CFE_SB_InitMsg(EVS_PktPtr, CFE_EVS_EVENT_MSG_MID, sizeof(CFE_EVS_Packet_t), TRUE);
+   EVS_PktPtr->Payload.PacketID.EventID   = EventPtr->EventID;
+   EVS_PktPtr->Payload.PacketID.EventType = EventPtr->EventType;
+
+   while (EVS_FindConversion(Text, &Conv) == TRUE)
+   {
+      Used = EVS_CopyText(Text, Conv.Start, Message, Size, Used);
+
+      memcpy(ConvSpec, Conv.Start, Conv.Length);
+      ConvSpec[Conv.Length] = '\0';
+
+      /* snprintf() still returns the expanded length once the message is full */
+      Dest = (Used < Size) ? &Message[Used] : NULL;
+      Room = (Used < Size) ? (Size - Used) : 0;
+
+      switch (Conv.ArgType)
+      {
+         case EVS_ARG_INT:
+            Length = snprintf(Dest, Room, ConvSpec, (int)ArgPtr->Integer);
+            break;
+
+         case EVS_ARG_LONG:
+            Length = snprintf(Dest, Room, ConvSpec, (long)ArgPtr->Integer);
+            break;
+
+         case EVS_ARG_LONGLONG:
+            Length = snprintf(Dest, Room, ConvSpec, ArgPtr->Integer);
+            break;
+
+         case EVS_ARG_SIZE:
+            Length = snprintf(Dest, Room, ConvSpec, (size_t)ArgPtr->Integer);
+            break;
+
+         case EVS_ARG_DOUBLE:
+            Length = snprintf(Dest, Room, ConvSpec, ArgPtr->Float);
+            break;
+
+         case EVS_ARG_POINTER:
+            Length = snprintf(Dest, Room, ConvSpec, ArgPtr->Pointer);
+            break;
+
+         case EVS_ARG_STRING:
+            Length = snprintf(Dest, Room, ConvSpec, &EventPtr->Strings[ArgPtr->Integer]);
+            break;
+
+         default:
+            Length = 0;
+            break;
+      }
+
+      if (Length > 0)
+      {
+         Used += Length;
+      }
+
+      ArgPtr++;
+      Text = Conv.Start + Conv.Length;
+   }
+
+   Used = EVS_CopyText(Text, NULL, Message, Size, Used);
+
+   if (Used < Size)
+   {
+      Message[Used] = '\0';
+   }
+   else
+   {
+      /* Mark character before zero terminator to indicate truncation */
+      Message[Size - 1] = '\0';
+      Message[Size - 2] = CFE_EVS_MSG_TRUNCATED;
+      CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter++;
+   }
+
+} /* End EVS_FormatDeferredEvent */
+
+
+/*
+**             Function Prologue
+**
+** Function Name:      EVS_SendDeferredEvents
+**
+** Purpose:  This routine formats and sends the events waiting in the deferred
+**           event queue, and reports events that were discarded because the
+**           queue was full.
+**
+** Assumptions and Notes:  Only the EVS task may call this routine.  At most
+**           one queue's worth of events is sent per call, so that tasks that
+**           keep sending events cannot hold off EVS commands.
+*/
+void EVS_SendDeferredEvents(void)
+{
+   EVS_DeferredQueue_t *QueuePtr = &CFE_EVS_GlobalData.DeferredQueue;
+   EVS_DeferredEvent_t *EventPtr;
+   CFE_EVS_Packet_t     EVS_Packet;
+   CFE_TIME_SysTime_t   Time;
+   uint32               AppID;
+   uint32               Pos;
+   uint32               DropCount;
+   uint32               i;
+
+   for (i = 0; i < CFE_EVS_DEFERRED_QUEUE_DEPTH; i++)
+   {
+      Pos = QueuePtr->Head;
+      EventPtr = &QueuePtr->Event[Pos & (CFE_EVS_DEFERRED_QUEUE_DEPTH - 1)];
+
+      if (CFE_ATOMIC_LOAD(&EventPtr->Seq) != (Pos + 1))
+      {
+         break;
+      }
+
+      EVS_FormatDeferredEvent(EventPtr, &EVS_Packet);
+      AppID = EventPtr->AppID;
+      Time = EventPtr->Time;
+
+      /* Hand the event to the writer that will use it on the next lap */
+      CFE_ATOMIC_BARRIER();
+      EventPtr->Seq = Pos + CFE_EVS_DEFERRED_QUEUE_DEPTH;
+      QueuePtr->Head = Pos + 1;
+
+      /* Send the event packet */
+      EVS_SendPacket(AppID, Time, &EVS_Packet);
+   }
+
+   DropCount = CFE_ATOMIC_LOAD(&QueuePtr->DropCounter);
+   if (DropCount != 0)
+   {
+      CFE_ATOMIC_SUB(&QueuePtr->DropCounter, DropCount);
+      EVS_SendEvent(CFE_EVS_DEFERRED_DROP_EID, CFE_EVS_ERROR,
+                    "%u events discarded, deferred event queue full", (unsigned int)DropCount);
+   }
+
+} /* End EVS_SendDeferredEvents */
+
+#endif
+
+
 /* End cfe_evs_utils */
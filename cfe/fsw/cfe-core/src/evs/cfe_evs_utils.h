@@ -68,10 +68,32 @@
 
 #include "cfe_evs_task.h"        /* EVS internal definitions */
 
+#include <stdarg.h>
+
 /* ==============   Section I: Macro and Constant Type Definitions   =========== */
 
+/* Argument types of the printf conversions in an event format string */
+#define EVS_ARG_UNSUPPORTED   0
+#define EVS_ARG_INT           1
+#define EVS_ARG_LONG          2
+#define EVS_ARG_LONGLONG      3
+#define EVS_ARG_SIZE          4
+#define EVS_ARG_DOUBLE        5
+#define EVS_ARG_POINTER       6
+#define EVS_ARG_STRING        7
+
 /* ==============   Section II: Internal Structures ============ */     
 
+/* One printf conversion found in an event format string */
+typedef struct
+{
+   const char         *Start;       /* The '%' that starts the conversion */
+   uint32              Length;      /* Length of the conversion specification */
+   int32               Precision;   /* Precision, or -1 if none was given */
+   uint32              ArgType;     /* One of the EVS_ARG_ types */
+
+} EVS_Conversion_t;
+
 /* ==============   Section III: Function Prototypes =========== */
 
 int32 EVS_GetAppID(uint32 *AppIdPtr);
@@ -82,7 +104,11 @@ int32 EVS_NotRegistered(uint32 AppID);
 
 boolean EVS_IsFiltered(uint32 AppID, uint16 EventID, uint16 EventType);
 
-EVS_BinFilter_t *EVS_FindEventID(int16 EventID, EVS_BinFilter_t *FilterArray);
+EVS_BinFilter_t *EVS_FindEventID(int16 EventID, EVS_AppData_t *AppDataPtr);
+
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr);
+
+void EVS_IndexFilters(EVS_AppData_t *AppDataPtr);
 
 void EVS_EnableTypes(uint8 BitMask, uint32 AppID);
 
@@ -92,4 +118,20 @@ void EVS_SendPacket(uint32 AppID, CFE_TIME_SysTime_t Time, CFE_EVS_Packet_t *EVS
 
 int32 EVS_SendEvent (uint16 EventID, uint16 EventType, const char *Spec, ... );
 
+void EVS_GenerateEvent(uint32 AppID, CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType,
+                       const char *Spec, va_list ArgPtr);
+
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+
+boolean EVS_FindConversion(const char *Text, EVS_Conversion_t *ConvPtr);
+
+boolean EVS_DeferEvent(uint32 AppID, CFE_TIME_SysTime_t Time, uint16 EventID, uint16 EventType,
+                       const char *Spec, va_list ArgPtr);
+
+void EVS_FormatDeferredEvent(EVS_DeferredEvent_t *EventPtr, CFE_EVS_Packet_t *EVS_PktPtr);
+
+void EVS_SendDeferredEvents(void);
+
+#endif
+
 #endif  /* _cfe_evs_utils_ */
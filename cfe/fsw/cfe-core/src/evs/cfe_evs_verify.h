@@ -65,6 +65,10 @@
     #error CFE_EVS_LOG_MAX cannot be greater than 65535
 #endif
 
+#if (CFE_EVS_COMPACT_LOG != TRUE) && (CFE_EVS_COMPACT_LOG != FALSE)
+    #error CFE_EVS_COMPACT_LOG must be either TRUE or FALSE!
+#endif
+
 #if( CFE_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_LONG_FORMAT) && (CFE_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_SHORT_FORMAT)
     #error CFE_EVS_DEFAULT_MSG_FORMAT can only be CFE_EVS_LONG_FORMAT or CFE_EVS_SHORT_FORMAT !
 #endif
@@ -73,5 +77,22 @@
     #error CFE_EVS_PORT_DEFAULT cannot be greater than 0x0F!
 #endif
 
+#if (CFE_EVS_DEFERRED_SEND != TRUE) && (CFE_EVS_DEFERRED_SEND != FALSE)
+    #error CFE_EVS_DEFERRED_SEND must be either TRUE or FALSE!
+#endif
+
+#if (CFE_EVS_DEFERRED_SEND == TRUE) && !defined(__GNUC__)
+    #error CFE_EVS_DEFERRED_SEND requires a toolchain with the GCC atomic builtins!
+#endif
+
+#if (CFE_EVS_DEFERRED_QUEUE_DEPTH < 2) || (CFE_EVS_DEFERRED_QUEUE_DEPTH > 1024) || \
+    ((CFE_EVS_DEFERRED_QUEUE_DEPTH & (CFE_EVS_DEFERRED_QUEUE_DEPTH - 1)) != 0)
+    #error CFE_EVS_DEFERRED_QUEUE_DEPTH must be a power of two from 2 to 1024!
+#endif
+
+#if CFE_EVS_DEFERRED_SEND_MSEC < 1
+    #error CFE_EVS_DEFERRED_SEND_MSEC must be greater than zero!
+#endif
+
 #endif /* _cfe_evs_verify_ */
 /*****************************************************************************/
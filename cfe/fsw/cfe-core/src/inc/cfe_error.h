@@ -1252,6 +1252,15 @@
 #define CFE_TBL_ERR_BAD_PROCESSOR_ID (int32)(0xcc000029L)
 
 
+/**
+**  The selected table patch file holds a patch that lies outside the
+**  span of the table given in the table file header, or a patch that
+**  holds no data.
+**
+*/
+#define CFE_TBL_ERR_BAD_PATCH (int32)(0xcc00002AL)
+
+
 /**
 **  Current version of cFE does not have the function or the feature
 **  of the function implemented.  This could be due to either an early
@@ -350,6 +350,8 @@ typedef struct
                                                         \brief Number of bytes never allocated to a block */
     CFE_ES_BlockStats_t   BlockStats[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES]; /**< \cfetlmmnemonic \ES_BLKSTATS
                                                                            \brief Contains stats on each block size */
+    uint32                MaxFreeBlockSize;        /**< \cfetlmmnemonic \ES_MAXFREEBLK
+                                                        \brief Largest block size that can currently be allocated */
 } CFE_ES_MemPoolStats_t;
 
 /*
@@ -1035,7 +1037,9 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1,2);
 **        used is determined by the last parameter. 
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        A range that lies within an EEPROM range of the PSP memory table is read one
+**        byte at a time with #CFE_PSP_MemRead8.  All other memory is read directly,
+**        eight bytes per table lookup step.
 **
 ** \param[in]   DataPtr     Pointer to the base of the memory block.
 **
@@ -1048,8 +1052,9 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1,2);
 ** \param[in]   TypeCRC     One of the following CRC algorithm selections:
 **
 **                          \arg \c CFE_ES_CRC_8 - (Not currently implemented)
-**                          \arg \c CFE_ES_CRC_16 - a CRC-16 algorithm
-**                          \arg \c CFE_ES_CRC_32 - (not currently implemented)
+**                          \arg \c CFE_ES_CRC_16 - a CRC-16 algorithm (CRC-16/ARC, returned sign extended)
+**                          \arg \c CFE_ES_CRC_32 - the IEEE 802.3 CRC-32 algorithm.  Passing
+**                               a previous result as \c InputCRC continues that CRC.
 **
 ** \returns
 ** \retstmt The result of the CRC calculation on the specified memory block. \endcode
@@ -1058,6 +1063,42 @@ int32 CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1,2);
 ******************************************************************************/
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, uint32 DataLength, uint32 InputCRC, uint32 TypeCRC);
 
+/*****************************************************************************/
+/**
+** \brief Update the CRC of a block of memory for a change to a range of it
+**
+** \par Description
+**        This routine returns the CRC the whole block would have after a range of it
+**        was changed, from the CRCs of the old and the new contents of the range.  The
+**        rest of the block does not have to be read again, and the work only grows
+**        with the log of the number of bytes after the range.
+**
+** \par Assumptions, External Events, and Notes:
+**        Both range CRCs must be calculated by #CFE_ES_CalculateCRC with the same
+**        \c InputCRC and \c TypeCRC, nominally zero and the type of \c BlockCRC.
+**
+** \param[in]   BlockCRC     The CRC of the whole block before the change, as returned by
+**                           #CFE_ES_CalculateCRC.
+**
+** \param[in]   OldRangeCRC  The CRC of the old contents of the range.
+**
+** \param[in]   NewRangeCRC  The CRC of the new contents of the range.
+**
+** \param[in]   TailLength   The number of bytes in the block after the end of the range.
+**
+** \param[in]   TypeCRC      The CRC algorithm, as for #CFE_ES_CalculateCRC.
+**
+** \returns
+** \retstmt The CRC of the whole block after the change, or zero for a \c TypeCRC that
+**          #CFE_ES_CalculateCRC does not implement. \endcode
+** \endreturns
+**
+** \sa #CFE_ES_CalculateCRC
+**
+******************************************************************************/
+uint32 CFE_ES_UpdateCRC(uint32 BlockCRC, uint32 OldRangeCRC, uint32 NewRangeCRC,
+                        uint32 TailLength, uint32 TypeCRC);
+
 /*
 ** Critical Data Store API
 */
@@ -1124,6 +1165,41 @@ int32 CFE_ES_RegisterCDS(CFE_ES_CDSHandle_t *HandlePtr, int32 BlockSize, const c
 */
 int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy);
 
+/*****************************************************************************/
+/**
+** \brief Save part of a block of data in the Critical Data Store (CDS)
+**
+** \par Description
+**        This routine copies \c Length bytes of memory into the Critical Data Store that
+**        had been previously registered via #CFE_ES_RegisterCDS, starting \c Offset bytes
+**        into the CDS.  Only that part of the CDS is written, and only its old contents
+**        are read back to update the data integrity check.  An application that changes
+**        a little of a large CDS can use this instead of #CFE_ES_CopyToCDS.
+**
+** \par Assumptions, External Events, and Notes:
+**        The integrity check still covers the whole CDS, so #CFE_ES_RestoreFromCDS
+**        detects corruption anywhere in it.
+**
+** \param[in]   Handle       The handle of the CDS block that was previously obtained from #CFE_ES_RegisterCDS.
+**
+** \param[in]   Offset       The byte offset into the CDS at which to start copying.
+**
+** \param[in]   Length       The number of bytes to copy.
+**
+** \param[in]   DataToCopy   A Pointer to the memory to be copied into the CDS at \c Offset.
+**
+** \returns
+** \retcode #OS_SUCCESS              \retdesc \copydoc OS_SUCCESS              \endcode
+** \retcode #CFE_ES_ERR_MEM_HANDLE   \retdesc \copydoc CFE_ES_ERR_MEM_HANDLE   \endcode
+** \retcode #CFE_ES_BAD_ARGUMENT     \retdesc The range does not lie within the CDS \endcode
+** \retcode #OS_ERROR                \retdesc Problem with handle or a size mismatch   \endcode
+** \endreturns
+**
+** \sa #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS, #CFE_ES_RestoreFromCDS
+**
+*/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, uint32 Offset, uint32 Length, const void *DataToCopy);
+
 /*****************************************************************************/
 /**
 ** \brief Recover a block of data from the Critical Data Store (CDS)
@@ -1204,6 +1280,7 @@ int32 CFE_ES_PoolCreateNoSem(CFE_ES_MemHandle_t *HandlePtr, uint8 *MemPtr, uint3
 **        -# The size of the pool must be an integral number of 32-bit words
 **        -# The start address of the pool must be 32-bit aligned
 **        -# 168 bytes are used for internal bookkeeping, therefore, they will not be available for allocation.
+**        -# When #CFE_ES_LOCKLESS_POOLS is TRUE the pool is managed with lock-free free lists instead of a mutex.
 **
 ** \param[in]   HandlePtr   A pointer to the variable the caller wishes to have the memory pool handle kept in.
 **
@@ -1235,6 +1312,8 @@ int32 CFE_ES_PoolCreate(CFE_ES_MemHandle_t *HandlePtr, uint8 *MemPtr, uint32 Siz
 **        -# The size of the pool must be an integral number of 32-bit words
 **        -# The start address of the pool must be 32-bit aligned
 **        -# 168 bytes are used for internal bookkeeping, therefore, they will not be available for allocation.
+**        -# When #CFE_ES_LOCKLESS_POOLS is TRUE a pool created with #CFE_ES_USE_MUTEX is managed with lock-free
+**           free lists instead of a mutex.
 **
 ** \param[in]   HandlePtr      A pointer to the variable the caller wishes to have the memory pool handle kept in.
 **
@@ -1260,11 +1339,57 @@ int32 CFE_ES_PoolCreate(CFE_ES_MemHandle_t *HandlePtr, uint8 *MemPtr, uint32 Siz
 ** \retcode #CFE_ES_BAD_ARGUMENT   \retdesc \copydoc CFE_ES_BAD_ARGUMENT  \endcode
 ** \endreturns
 **
-** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateNoSem, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateNoSem, #CFE_ES_PoolCreateBuddy, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
 **
 ******************************************************************************/
 int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *HandlePtr, uint8 *MemPtr, uint32 Size, uint32 NumBlockSizes, uint32 *BlockSizes, uint16 UseMutex);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a memory pool created by an application that splits and merges its blocks.
+**
+** \par Description
+**        This routine initializes a pool of memory supplied by the calling application as a buddy
+**        allocator.  Block sizes are powers of two, descriptor included, starting at the smallest
+**        power of two that holds \c MinBlockSize bytes.  A request is served by splitting the
+**        smallest free block that is large enough, and a returned block is merged with its buddy
+**        whenever both are free, so memory once used for large blocks can be reused for small ones.
+**        Allocating and freeing take a bounded time that does not depend on the number of blocks.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The size of the pool must be an integral number of 32-bit words
+**        -# The start address of the pool must be 32-bit aligned
+**        -# The pool is used through #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetPoolBufInfo
+**           and #CFE_ES_GetMemPoolStats like any other pool.  The block statistics report the number
+**           of blocks of each size currently in the pool rather than the number ever created, and
+**           the free byte count includes the bytes in free blocks.
+**
+** \param[in]   HandlePtr      A pointer to the variable the caller wishes to have the memory pool handle kept in.
+**
+** \param[in]   MemPtr         A Pointer to the pool of memory created by the calling application. This address must
+**                             be on a 32-bit boundary.
+**
+** \param[in]   Size           The size of the pool of memory.  Note that this must be an integral number of 32 bit words.
+**
+** \param[in]   MinBlockSize   The number of bytes in the smallest block.  If set equal to zero,
+**                             #CFE_ES_MEM_BLOCK_SIZE_01 is used.  The largest block is
+**                             2^(#CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 1) times the smallest one.
+**
+** \param[in]   UseMutex       Flag indicating whether the new memory pool will be processing with mutex handling or not.
+**                             Valid parameter values are #CFE_ES_USE_MUTEX and #CFE_ES_NO_MUTEX
+**
+** \param[out]  *HandlePtr     The memory pool handle.
+**
+** \returns
+** \retcode #CFE_SUCCESS           \retdesc \copydoc CFE_SUCCESS          \endcode
+** \retcode #CFE_ES_BAD_ARGUMENT   \retdesc \copydoc CFE_ES_BAD_ARGUMENT  \endcode
+** \endreturns
+**
+** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateNoSem, #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+int32 CFE_ES_PoolCreateBuddy(CFE_ES_MemHandle_t *HandlePtr, uint8 *MemPtr, uint32 Size, uint32 MinBlockSize, uint16 UseMutex);
+
 /*****************************************************************************/
 /**
 ** \brief Gets a buffer from the memory pool created by #CFE_ES_PoolCreate or #CFE_ES_PoolCreateNoSem
@@ -1368,7 +1493,7 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t HandlePtr, uint32 *BufPtr);
 ** \retcode #CFE_ES_ERR_MEM_HANDLE      \retdesc \copydoc CFE_ES_ERR_MEM_HANDLE  \endcode
 ** \endreturns
 **
-** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateNoSem, #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf
+** \sa #CFE_ES_PoolCreate, #CFE_ES_PoolCreateNoSem, #CFE_ES_PoolCreateEx, #CFE_ES_PoolCreateBuddy, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf
 **
 ******************************************************************************/
 int32 CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHandle_t  Handle);
@@ -1553,6 +1553,39 @@
 **/
 #define CFE_ES_BUILD_INF_EID    92
 
+/** \brief <tt> '\%s written:Perf IDs=\%d,Size=\%d,\%dmS,\%d B/s' </tt>
+**  \event <tt> '\%s written:Perf IDs=\%d,Size=\%d,\%dmS,\%d B/s' </tt> 
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is issued upon successful completion of the cFE Executive
+**  Services \link #CFE_ES_WRITE_PERF_HIST_CC Write Performance Histograms command \endlink
+**
+**  The \c 's' field identifies the name of the file written, the \c Perf \c IDs field
+**  gives, in decimal, the number of histograms written and the \c Size field gives the
+**  total number of bytes written to the file.  The last two fields give the time
+**  taken to write the file and the resulting write rate.
+**/
+#define CFE_ES_PERF_HIST_EID    93
+
+/** \brief <tt> 'Error creating file \%s, RC = 0x\%08X' </tt>
+**  \event <tt> 'Error creating file \%s, RC = 0x\%08X' </tt> 
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services
+**  \link #CFE_ES_WRITE_PERF_HIST_CC Write Performance Histograms command \endlink
+**  fails to create the file.
+**
+**  The \c 's' field identifies the name of the file and the \c RC field gives, in hex,
+**  the error code returned by #OS_creat.
+**/
+#define CFE_ES_PERF_HIST_ERR_EID    94
+
 
 
 #endif /* _cfe_es_events_ */
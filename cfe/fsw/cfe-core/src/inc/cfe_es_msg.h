@@ -1141,6 +1141,57 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC     24
 
+/** \cfeescmd Write Performance Histograms to a File
+**
+**  \par Description
+**       This command writes the latency histogram that Executive Services keeps
+**       for each performance ID to the specified file.  A histogram collects the
+**       time between each #CFE_ES_PerfLogEntry and the matching
+**       #CFE_ES_PerfLogExit made by the same task, whether or not the
+**       Performance Analyzer is collecting data.  One #CFE_ES_PerfHistRecord_t
+**       is written for each performance ID that has been timed at least once.
+**       The histograms may optionally be cleared once they have been written.
+**
+**       This command is only accepted when the #CFE_ES_PERF_HISTOGRAMS
+**       configuration parameter is TRUE.
+**
+**  \cfecmdmnemonic \ES_WRITEPERFHIST2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WritePerfHistCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with 
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will 
+**         increment
+**       - The #CFE_ES_PERF_HIST_EID debug event message will be 
+**         generated.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_ES_DEFAULT_PERF_HIST_FILENAME configuration parameter) will be 
+**         updated with the lastest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The command packet length is incorrect
+**       - The file could not be created
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error 
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new 
+**       file in the file system (or overwrite an existing one) and could, 
+**       if performed repeatedly without sufficient file management by the 
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_PERF_STARTDATA_CC, #CFE_ES_PERF_STOPDATA_CC
+*/
+#define CFE_ES_WRITE_PERF_HIST_CC     25
+
 
 /** \} */
 
@@ -1239,6 +1290,27 @@ typedef struct
     CFE_ES_QueryAllTasksCmd_Payload_t   Payload;
 } CFE_ES_QueryAllTasksCmd_t;
 
+/**
+** \brief Write Performance Histograms to File Command
+**
+** For command details, see #CFE_ES_WRITE_PERF_HIST_CC
+**
+**/
+typedef struct
+{
+  char                  HistFileName[OS_MAX_PATH_LEN]; /**< \brief ASCII text string containing full path and
+                                                            filename of file in which the histograms are to be written */
+  uint8                 ClearHistograms;               /**< \brief TRUE to clear the histograms once they are written */
+  uint8                 Spare[3];                      /**< \brief Pad to a 32-bit boundary */
+
+} CFE_ES_WritePerfHistCmd_Payload_t;
+
+typedef struct
+{
+    uint8                               CmdHeader[CFE_SB_CMD_HDR_SIZE];    /**< \brief cFE Software Bus Command Message Header */
+    CFE_ES_WritePerfHistCmd_Payload_t   Payload;
+} CFE_ES_WritePerfHistCmd_t;
+
 
 /**
 ** \brief Dump System Log to File Command
@@ -1656,6 +1728,41 @@ typedef struct
     CFE_ES_ShellPacket_Payload_t    Payload;
 }CFE_ES_ShellPacket_t;
 
+/*************************************************************************/
+/*****************************/
+/* File Data Formats         */
+/*****************************/
+
+/**
+** \brief Number of buckets in a performance histogram
+**
+** Bucket 0 counts durations of 0 or 1 timer ticks.  Bucket N counts durations
+** of at least 2^N and less than 2^(N+1) ticks, and the last bucket counts
+** every longer duration.
+*/
+#define CFE_ES_PERF_HIST_BUCKETS      32
+
+/**
+** \brief Performance Histogram File Record
+**
+** One record is written for each timed performance ID in response to the
+** #CFE_ES_WRITE_PERF_HIST_CC command.  All durations are in ticks of the
+** timebase returned by #CFE_PSP_Get_Timebase.
+*/
+typedef struct
+{
+  uint32                PerfId;              /**< \brief Performance ID the histogram is for */
+  uint32                TimerTicksPerSecond; /**< \brief Number of timer ticks in a second */
+  uint32                Count;               /**< \brief Number of entry/exit pairs timed */
+  uint32                MinTicks;            /**< \brief Shortest duration */
+  uint32                MaxTicks;            /**< \brief Longest duration */
+  uint32                SumTicksUpper32;     /**< \brief Upper 32 bits of the sum of all durations */
+  uint32                SumTicksLower32;     /**< \brief Lower 32 bits of the sum of all durations */
+  uint32                P50Bucket;           /**< \brief Bucket holding the median duration */
+  uint32                P99Bucket;           /**< \brief Bucket holding the 99th percentile duration */
+  uint32                Bucket[CFE_ES_PERF_HIST_BUCKETS]; /**< \brief Number of durations in each bucket */
+} CFE_ES_PerfHistRecord_t;
+
 /*************************************************************************/
 
 #endif /* _cfe_es_msg_ */
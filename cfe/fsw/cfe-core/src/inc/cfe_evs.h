@@ -232,7 +232,9 @@ int32 CFE_EVS_Unregister( void );
 **          event log, and optionally sent as an ASCII text string out the enabled output port(s). 
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          When #CFE_EVS_DEFERRED_SEND is TRUE the event may be queued for the EVS task
+**          to format and send after this function returns.  \c Spec and the \%s
+**          arguments are copied into the queue.
 **
 ** \param[in] EventID            A numeric literal used to uniquely identify an application event.  
 **                               The \c EventID is defined and supplied by the application sending the event.   
@@ -281,7 +283,9 @@ int32 CFE_EVS_SendEvent (uint16 EventID,
 **          preserve the context of an Application's event.  In general, #CFE_EVS_SendEvent should be used. 
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          When #CFE_EVS_DEFERRED_SEND is TRUE the event may be queued for the EVS task
+**          to format and send after this function returns.  \c Spec and the \%s
+**          arguments are copied into the queue.
 **
 ** \param[in] EventID            A numeric literal used to uniquely identify an application event.  
 **                               The \c EventID is defined and supplied by the application sending the event.   
@@ -332,7 +336,9 @@ int32 CFE_EVS_SendEventWithAppID (uint16 EventID,
 **          at a later time. 
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          When #CFE_EVS_DEFERRED_SEND is TRUE the event may be queued for the EVS task
+**          to format and send after this function returns.  \c Spec and the \%s
+**          arguments are copied into the queue.
 **
 ** \param[in] Time               The time to include in the event.  This will usually be a time returned 
 **                               by the function #CFE_TIME_GetTime().   
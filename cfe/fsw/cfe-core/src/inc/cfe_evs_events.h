@@ -700,5 +700,20 @@
 **/
 #define CFE_EVS_LEN_ERR_EID       43
 
+/** \brief <tt> '\%u events discarded, deferred event queue full' </tt>
+**  \event <tt> '\%u events discarded, deferred event queue full' </tt> 
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated by the EVS task when #CFE_EVS_DEFERRED_SEND is TRUE
+**  and applications sent events while the deferred event queue was full.  Those events
+**  were discarded.  The count is the number of events discarded since the last time
+**  this event message was generated.  #CFE_EVS_DEFERRED_QUEUE_DEPTH sets the size of
+**  the queue and #CFE_EVS_DEFERRED_SEND_MSEC how long events may wait in it.
+**/
+#define CFE_EVS_DEFERRED_DROP_EID 44
+
 #endif  /* _cfe_evs_events_ */
 
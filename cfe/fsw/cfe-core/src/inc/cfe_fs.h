@@ -101,6 +101,10 @@
                                               /**< Table Services Table Image File 
                                                    which is generated either on the ground or in response to a 
                                                    \link #CFE_TBL_DUMP_CC \TBL_DUMP \endlink command. */
+#define CFE_FS_TBL_PATCH_SUBTYPE        10    /**< \brief Table Services Table Patch File */
+                                              /**< Table Services Table Patch File 
+                                                   which carries only the bytes of a table image that
+                                                   differ from the image already loaded (see #CFE_TBL_PatchHdr_t). */
 #define CFE_FS_EVS_APPDATA_SUBTYPE      15    /**< \brief Event Services Application Data Dump File */
                                               /**< Event Services Application Data Dump File 
                                                    which is generated in response to a 
@@ -131,6 +135,11 @@
                                                    which is generated in response to a 
                                                    \link #CFE_ES_QUERY_ALL_TASKS_CC \ES_WRITETASKINFO2FILE \endlink
                                                    command. */
+#define CFE_FS_ES_PERFHIST_SUBTYPE      24    /**< \brief Executive Services Performance Histogram File */
+                                              /**< Executive Services Performance Histogram File 
+                                                   which is generated in response to a 
+                                                   \link #CFE_ES_WRITE_PERF_HIST_CC \ES_WRITEPERFHIST2FILE \endlink
+                                                   command. */
 /** \} */
 
 /**
@@ -499,6 +499,48 @@ int32  CFE_SB_SendMsg(CFE_SB_Msg_t   *MsgPtr);
 **/
 int32  CFE_SB_PassMsg(CFE_SB_Msg_t   *MsgPtr);
 
+/*****************************************************************************/
+/** 
+** \brief Send several software bus messages
+**
+** \par Description
+**          This routine sends each of the specified messages to all of its
+**          subscribers, in array order, as #CFE_SB_SendMsg would.  The
+**          routing table is held across the whole batch and the name of the
+**          sending task is looked up at most once, which makes this cheaper
+**          than one #CFE_SB_SendMsg call per message for apps that publish
+**          several packets at a time.
+**
+** \par Assumptions, External Events, and Notes:
+**          - This routine will not normally wait for the receiver tasks to 
+**            process the messages before returning control to the caller's task.
+**          - A message that cannot be sent does not stop the rest of the
+**            batch from being sent.
+**          - This function tracks and increments the source sequence counter 
+**            of telemetry messages.
+**
+** \param[in]  MsgPtrs      An array of \c Count pointers to the messages to be
+**                          sent.  Each must point to the first byte of a
+**                          software bus message header (#CFE_SB_Msg_t). 
+**
+** \param[in]  Count        The number of messages in \c MsgPtrs.
+**
+** \param[out] StatusArray  An optional array of \c Count entries that receives
+**                          the status of each message, as #CFE_SB_SendMsg would
+**                          have returned it.  May be NULL.
+**
+** \returns
+** \retcode #CFE_SUCCESS            \retdesc   All of the messages were sent    \endcode
+** \retcode #CFE_SB_BAD_ARGUMENT    \retdesc   \copydoc CFE_SB_BAD_ARGUMENT    \endcode
+** \retcode #CFE_SB_MSG_TOO_BIG     \retdesc   \copydoc CFE_SB_MSG_TOO_BIG     \endcode
+** \retcode #CFE_SB_BUF_ALOC_ERR    \retdesc   \copydoc CFE_SB_BUF_ALOC_ERR    \endcode
+** \endreturns
+**          If more than one message failed the status of the first is returned.
+**
+** \sa #CFE_SB_SendMsg, #CFE_SB_PassMsg
+**/
+int32  CFE_SB_SendMsgBatch(CFE_SB_Msg_t   **MsgPtrs, uint32 Count, int32 *StatusArray);
+
 /*****************************************************************************/
 /** 
 ** \brief Receive a message from a software bus pipe
@@ -542,12 +584,65 @@ int32  CFE_SB_PassMsg(CFE_SB_Msg_t   *MsgPtr);
 ** \retcode #CFE_SB_NO_MESSAGE      \retdesc  \copydoc CFE_SB_NO_MESSAGE    \endcode
 ** \endreturns
 **
-** \sa #CFE_SB_SendMsg, #CFE_SB_ZeroCopySend
+** \sa #CFE_SB_SendMsg, #CFE_SB_ZeroCopySend, #CFE_SB_MakeWritable
 **/
 int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t  *BufPtr,
                      CFE_SB_PipeId_t  PipeId,
                      int32            TimeOut);
 
+/*****************************************************************************/
+/** 
+** \brief Receive several messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to \c MaxMsgs messages from the specified
+**          pipe in one call.  If the pipe is empty, this routine will block
+**          until either a new message comes in or the timeout value is
+**          reached.  Once one message has been received, only the messages
+**          already on the pipe are returned; the routine does not wait for
+**          more.
+**
+** \par Assumptions, External Events, and Notes:
+**          - All of the messages returned remain valid until the next call to
+**            #CFE_SB_RcvMsg or #CFE_SB_RcvMsgBatch for the same pipe, when
+**            they are released together.
+**          - At most #CFE_SB_MAX_RCV_BATCH messages are returned per call.
+**          - #CFE_SB_GetLastSenderId reports the sender of the last message
+**            in the batch.
+**
+** \param[in]  BufPtrs      An array of at least \c MaxMsgs message pointers.
+**
+** \param[in]  MaxMsgs      The largest number of messages to return.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages. 
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for the first message
+**                          if the pipe is empty at the time of the call.  This can
+**                          also be set to #CFE_SB_POLL for a non-blocking receive or 
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \param[out] *BufPtrs     Pointers to the messages obtained from the pipe, in the
+**                          order they were sent.  These should be used as read-only
+**                          pointers.
+**
+** \param[out] *NumMsgs     The number of messages returned in \c BufPtrs.
+**
+** \returns
+** \retcode #CFE_SUCCESS            \retdesc  \copydoc CFE_SUCCESS          \endcode
+** \retcode #CFE_SB_BAD_ARGUMENT    \retdesc  \copydoc CFE_SB_BAD_ARGUMENT  \endcode
+** \retcode #CFE_SB_TIME_OUT        \retdesc  \copydoc CFE_SB_TIME_OUT      \endcode
+** \retcode #CFE_SB_PIPE_RD_ERR     \retdesc  \copydoc CFE_SB_PIPE_RD_ERR   \endcode
+** \retcode #CFE_SB_NO_MESSAGE      \retdesc  \copydoc CFE_SB_NO_MESSAGE    \endcode
+** \endreturns
+**
+** \sa #CFE_SB_RcvMsg
+**/
+int32  CFE_SB_RcvMsgBatch(CFE_SB_MsgPtr_t  *BufPtrs,
+                          uint32            MaxMsgs,
+                          uint32           *NumMsgs,
+                          CFE_SB_PipeId_t   PipeId,
+                          int32             TimeOut);
+
 /*****************************************************************************/
 /** 
 ** \brief Retrieve the application Info of the sender for the last message.
@@ -740,6 +835,47 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
                           CFE_SB_ZeroCopyHandle_t          BufferHandle);
 
 
+/*****************************************************************************/
+/** 
+** \brief Take ownership of a received message so that it can be modified.
+**
+** \par Description
+**          A message delivered to several pipes is held in one shared software
+**          bus buffer, so the pointer returned by #CFE_SB_RcvMsg or
+**          #CFE_SB_RcvMsgBatch must be treated as read-only.  This routine
+**          turns a received message into a "zero copy" buffer owned by the
+**          caller.  The message is only copied if another pipe still holds it;
+**          otherwise the caller is given the received buffer itself.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Must be called by the task that received the message, before its
+**             next receive from the same pipe.
+**          -# The message is removed from the pipe, so call
+**             #CFE_SB_GetLastSenderId first if the sender is needed.
+**          -# The buffer must then be given to #CFE_SB_ZeroCopySend or
+**             #CFE_SB_ZeroCopyPass (which allows an application to forward a
+**             message without copying it) or released with
+**             #CFE_SB_ZeroCopyReleasePtr.
+**
+** \param[in, out] BufPtr  A pointer to the received message pointer.  On
+**                         success *BufPtr points to the writable message.
+**
+** \param[in]  PipeId      The pipe the message was received from.
+**
+** \param[out] *BufferHandle  The handle to use with the "zero copy" APIs.
+**
+** \returns
+** \retcode #CFE_SUCCESS            \retdesc   \copydoc CFE_SUCCESS            \endcode
+** \retcode #CFE_SB_BAD_ARGUMENT    \retdesc   \copydoc CFE_SB_BAD_ARGUMENT    \endcode
+** \retcode #CFE_SB_BUFFER_INVALID  \retdesc   \copydoc CFE_SB_BUFFER_INVALID  \endcode
+** \retcode #CFE_SB_BUF_ALOC_ERR    \retdesc   \copydoc CFE_SB_BUF_ALOC_ERR    \endcode
+** \endreturns
+**
+** \sa #CFE_SB_RcvMsg, #CFE_SB_ZeroCopySend, #CFE_SB_ZeroCopyPass, #CFE_SB_ZeroCopyReleasePtr
+**/
+int32 CFE_SB_MakeWritable(CFE_SB_MsgPtr_t *BufPtr, CFE_SB_PipeId_t PipeId,
+                          CFE_SB_ZeroCopyHandle_t *BufferHandle);
+
 /*****************************************************************************/
 /** 
 ** \brief Initialize a buffer for a software bus message.
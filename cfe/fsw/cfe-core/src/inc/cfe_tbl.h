@@ -79,6 +79,10 @@
 #define CFE_TBL_OPT_NOT_CRITICAL (0x0000)
 #define CFE_TBL_OPT_CRITICAL     (0x0008)
 
+#define CFE_TBL_OPT_VALIDATE_MSK  (0x0010)
+#define CFE_TBL_OPT_APP_VALIDATE  (0x0000)
+#define CFE_TBL_OPT_TASK_VALIDATE (0x0010)
+
 #define CFE_TBL_OPT_DEFAULT      (CFE_TBL_OPT_SNGL_BUFFER | CFE_TBL_OPT_LOAD_DUMP)
 
 /** Computation for maximum length allowed for a table name. <BR>
@@ -222,6 +226,17 @@ typedef struct
 **                                                                 the update of the double buffered table from being quick and
 **                                                                 it could be blocked.  Therefore, critical tables should not be
 **                                                                 updated by Interrupt Service Routines.
+**                                 \arg #CFE_TBL_OPT_APP_VALIDATE - When this option is selected, the table's validation
+**                                                                 function is called by the Application when it calls
+**                                                                 #CFE_TBL_Validate or #CFE_TBL_Manage.  This option is
+**                                                                 mutually exclusive with the #CFE_TBL_OPT_TASK_VALIDATE
+**                                                                 option.
+**                                 \arg #CFE_TBL_OPT_TASK_VALIDATE- When this option is selected, the table's validation
+**                                                                 function is called by the Table Services task instead,
+**                                                                 and #CFE_TBL_Manage is only needed to activate the
+**                                                                 validated table.  The validation function must then not
+**                                                                 depend on the context of the Application.  The option
+**                                                                 is ignored when #CFE_TBL_TASK_VALIDATION is FALSE.
 **
 ** \param[in] TblValidationFuncPtr is a pointer to a function that will be executed in the context of the Table 
 **                                 Management Service when the contents of a table need to be validated.  If set 
@@ -622,7 +637,8 @@ int32 CFE_TBL_ReleaseAddresses( uint16 NumTables,
 **        the Application would call this function to perform the necessary actions.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          -# Tables registered with the #CFE_TBL_OPT_TASK_VALIDATE option are validated by the
+**             Table Services task, so this function has nothing to do for them.
 **
 ** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
 **                       identifies the Table to be managed.
@@ -690,7 +706,8 @@ int32 CFE_TBL_Manage( CFE_TBL_Handle_t TblHandle );
 **        a call to #CFE_TBL_Update or #CFE_TBL_Validate respectively.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**          -# #CFE_TBL_INFO_VALIDATION_PENDING is not returned for tables registered with the
+**             #CFE_TBL_OPT_TASK_VALIDATE option, since the Table Services task validates them.
 **
 ** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
 **                       identifies the Table to be managed.
@@ -256,6 +256,34 @@
 **  #CFE_TBL_Register API.
 **/
 #define CFE_TBL_ASSUMED_VALID_INF_EID          23  
+
+/** \brief <tt> 'Loading '\%s' into '\%s' working buffer (\%d bytes)' </tt>
+**  \event <tt> 'Loading '\%s' into '\%s' working buffer (\%d bytes)' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when a cFE Table Services \link #CFE_TBL_LOAD_CC Load Table command \endlink
+**  names a file holding more than #CFE_TBL_LOAD_CHUNK_SIZE bytes of table data.  The rest of the file is read
+**  whenever the Table Services command pipe is empty.  The load completes with #CFE_TBL_FILE_LOADED_INF_EID,
+**  or with one of the errors that a Load Table command can report.
+**/
+#define CFE_TBL_FILE_LOADING_INF_EID           24
+
+/** \brief <tt> 'Dumping '\%s' to '\%s' (\%d bytes)' </tt>
+**  \event <tt> 'Dumping '\%s' to '\%s' (\%d bytes)' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when a cFE Table Services \link #CFE_TBL_DUMP_CC Dump Table command \endlink
+**  names the active buffer of a table larger than #CFE_TBL_DUMP_CHUNK_SIZE bytes.  The rest of the table is
+**  written whenever the Table Services command pipe is empty.  The dump completes with #CFE_TBL_WRITE_DUMP_INF_EID
+**  or #CFE_TBL_OVERWRITE_DUMP_INF_EID, or with one of the errors that a Dump Table command can report.
+**/
+#define CFE_TBL_FILE_DUMPING_INF_EID           25
 /** \} */
 
 
@@ -858,6 +886,88 @@
 **  is the error code returned by the #CFE_SB_SendMsg API call. 
 **/
 #define CFE_TBL_FAIL_NOTIFY_SEND_ERR_EID       89
+
+/** \brief <tt> 'Cannot load '\%s' while '\%s' is being loaded from '\%s'' </tt>
+**  \event <tt> 'Cannot load '\%s' while '\%s' is being loaded from '\%s'' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a \link #CFE_TBL_LOAD_CC Load Table command \endlink is received
+**  while the file named by an earlier Load Table command is still being read (see #CFE_TBL_FILE_LOADING_INF_EID).
+**  Only one table file is read at a time.  The command can be sent again once the earlier load has completed,
+**  or the earlier load can be stopped with the \link #CFE_TBL_ABORT_LOAD_CC Abort Load Command \endlink.
+**/
+#define CFE_TBL_LOAD_BUSY_ERR_EID              99
+
+/** \brief <tt> 'Inactive buffer of '\%s' is still being loaded from '\%s'' </tt>
+**  \event <tt> 'Inactive buffer of '\%s' is still being loaded from '\%s'' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a \link #CFE_TBL_VALIDATE_CC Validate Table command \endlink or
+**  a \link #CFE_TBL_DUMP_CC Dump Table command \endlink names the inactive buffer of a table whose file is
+**  still being read into that buffer.
+**/
+#define CFE_TBL_INACTIVE_LOADING_ERR_EID       100
+
+/** \brief <tt> 'Load of '\%s' from '\%s' stopped, working buffer was released' </tt>
+**  \event <tt> 'Load of '\%s' from '\%s' stopped, working buffer was released' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when the table whose file was being read in the background
+**  (see #CFE_TBL_FILE_LOADING_INF_EID) lost its working buffer before the load completed.  The most
+**  likely cause is that the owning application unregistered the table.
+**/
+#define CFE_TBL_LOAD_STOPPED_ERR_EID           101
+
+/** \brief <tt> 'Unable to patch '\%s' from '\%s', Status = 0x\%08X' </tt>
+**  \event <tt> 'Unable to patch '\%s' from '\%s', Status = 0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a \link #CFE_TBL_LOAD_CC Load Table command \endlink names
+**  a table patch file (see #CFE_FS_TBL_PATCH_SUBTYPE) whose patches could not be applied.  A \c Status
+**  of #CFE_TBL_ERR_BAD_PATCH means a patch lies outside the span given in the table header, and
+**  #CFE_TBL_ERR_LOAD_INCOMPLETE means the file ended in the middle of a patch.
+**/
+#define CFE_TBL_PATCH_ERR_EID                  102
+
+/** \brief <tt> 'Cannot dump '\%s' while '\%s' is being dumped to '\%s'' </tt>
+**  \event <tt> 'Cannot dump '\%s' while '\%s' is being dumped to '\%s'' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when a \link #CFE_TBL_DUMP_CC Dump Table command \endlink names the
+**  active buffer of a table larger than #CFE_TBL_DUMP_CHUNK_SIZE bytes while the table named by an earlier
+**  Dump Table command is still being written (see #CFE_TBL_FILE_DUMPING_INF_EID).  Only one table is
+**  written a piece at a time.  The command can be sent again once the earlier dump has completed.
+**/
+#define CFE_TBL_DUMP_BUSY_ERR_EID              103
+
+/** \brief <tt> 'Dump of '\%s' to '\%s' stopped, table buffer was released' </tt>
+**  \event <tt> 'Dump of '\%s' to '\%s' stopped, table buffer was released' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when the table being written in the background
+**  (see #CFE_TBL_FILE_DUMPING_INF_EID) lost its buffer before the dump completed.  The most
+**  likely cause is that the owning application unregistered the table.  The dump file is
+**  left incomplete.
+**/
+#define CFE_TBL_DUMP_STOPPED_ERR_EID           104
 /** \} */
 
 /** \name API Informational Event Message IDs */
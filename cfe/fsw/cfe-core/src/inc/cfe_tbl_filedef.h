@@ -81,6 +81,19 @@ typedef struct
     char                     TableName[CFE_TBL_MAX_FULL_NAME_LEN]; /**< Fully qualified name of table to load */
 } CFE_TBL_File_Hdr_t;
 
+/**
+**  A table patch file (#CFE_FS_TBL_PATCH_SUBTYPE) holds a standard cFE file header and a
+**  #CFE_TBL_File_Hdr_t whose \c Offset and \c NumBytes give the span of the table covered
+**  by the patches.  The rest of the file is a series of patches, each one a #CFE_TBL_PatchHdr_t
+**  immediately followed by the \c NumBytes bytes to be written at \c Offset.  Like the table
+**  header, the patch headers are stored in big endian format.
+*/
+typedef struct
+{
+    uint32                   Offset;                               /**< Byte Offset of the patch within the table */
+    uint32                   NumBytes;                             /**< Number of bytes in the patch */
+} CFE_TBL_PatchHdr_t;
+
 
 typedef struct
 {
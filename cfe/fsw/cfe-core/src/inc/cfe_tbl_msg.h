@@ -786,6 +786,10 @@ typedef struct
                                                                      \brief Path and Name of last file dumped to */
     char                  LastTableLoaded[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \cfetlmmnemonic \TBL_LASTTABLELOADED 
                                                                           \brief Name of the last table loaded */
+    uint32                DumpBytesWritten;                     /**< \cfetlmmnemonic \TBL_DUMPBYTESWRITTEN 
+                                                                     \brief Number of bytes of table data written so far by the dump in progress */
+    uint32                DumpBytesTotal;                       /**< \cfetlmmnemonic \TBL_DUMPBYTESTOTAL 
+                                                                     \brief Number of bytes of table data the dump in progress will write, zero when no dump is in progress */
 } CFE_TBL_HkPacket_Payload_t;
 
 typedef struct
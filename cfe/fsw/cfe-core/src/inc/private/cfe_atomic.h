@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2004-2015, United States government as represented by the
+ *  administrator of the National Aeronautics Space Administration.
+ *  All rights reserved. This software was created at NASA Glenn
+ *  Research Center pursuant to government contracts.
+ *
+ *  This is governed by the NASA Open Source Agreement and may be used,
+ *  distributed and modified only according to the terms of that agreement.
+ */
+
+/**
+ * \file cfe_atomic.h
+ *
+ * Atomic memory operations shared between cFE core modules.
+ *
+ * These wrap the compiler's atomic builtins so that core code which updates
+ * counters or links outside of a service mutex does not depend directly on a
+ * particular toolchain.  Every operation implies a full memory barrier.
+ *
+ * On toolchains without the GCC "__sync" builtins the operations fall back to
+ * plain (non-atomic) accesses.  Such targets must leave every lock-free
+ * configuration option (for example #CFE_SB_LOCKLESS_SEND) disabled so that
+ * these macros are only ever used under a mutex.
+ */
+
+#ifndef CFE_ATOMIC_H_
+#define CFE_ATOMIC_H_
+
+#include <common_types.h>
+
+#if defined(__GNUC__)
+
+#define CFE_ATOMIC_HAVE_BUILTINS        TRUE
+
+/** Read a shared variable exactly once */
+#define CFE_ATOMIC_LOAD(ptr)            (*(volatile __typeof__(*(ptr)) *)(ptr))
+
+/** Add/subtract and return the resulting value */
+#define CFE_ATOMIC_ADD(ptr,val)         __sync_add_and_fetch((ptr),(val))
+#define CFE_ATOMIC_SUB(ptr,val)         __sync_sub_and_fetch((ptr),(val))
+#define CFE_ATOMIC_INC(ptr)             __sync_add_and_fetch((ptr),1)
+#define CFE_ATOMIC_DEC(ptr)             __sync_sub_and_fetch((ptr),1)
+
+/** Store "newval" only if the variable still holds "oldval"; TRUE on success */
+#define CFE_ATOMIC_CAS(ptr,oldval,newval)  __sync_bool_compare_and_swap((ptr),(oldval),(newval))
+
+/** Full memory barrier */
+#define CFE_ATOMIC_BARRIER()            __sync_synchronize()
+
+/**
+ * Raise a high water mark to "val" if it is currently lower.  Safe against
+ * concurrent updates of the same mark.
+ */
+#define CFE_ATOMIC_RAISE_PEAK(ptr,val)                                      \
+    do {                                                                    \
+        __typeof__(*(ptr)) CfeAtomicOldPeak_;                               \
+        do {                                                                \
+            CfeAtomicOldPeak_ = CFE_ATOMIC_LOAD(ptr);                       \
+        } while ((CfeAtomicOldPeak_ < (val)) &&                             \
+                 !CFE_ATOMIC_CAS((ptr), CfeAtomicOldPeak_, (val)));         \
+    } while (0)
+
+#else
+
+#define CFE_ATOMIC_HAVE_BUILTINS        FALSE
+
+#define CFE_ATOMIC_LOAD(ptr)            (*(ptr))
+#define CFE_ATOMIC_ADD(ptr,val)         (*(ptr) += (val))
+#define CFE_ATOMIC_SUB(ptr,val)         (*(ptr) -= (val))
+#define CFE_ATOMIC_INC(ptr)             (++(*(ptr)))
+#define CFE_ATOMIC_DEC(ptr)             (--(*(ptr)))
+#define CFE_ATOMIC_CAS(ptr,oldval,newval)  ((*(ptr) == (oldval)) ? ((*(ptr) = (newval)), TRUE) : FALSE)
+#define CFE_ATOMIC_BARRIER()
+#define CFE_ATOMIC_RAISE_PEAK(ptr,val)  do { if (*(ptr) < (val)) { *(ptr) = (val); } } while (0)
+
+#endif
+
+#endif /* CFE_ATOMIC_H_ */
@@ -21,7 +21,7 @@
 #define CFE_ES_PERFDATA_TYPEDEF_H_
 
 #include <common_types.h>
-#include "cfe_platform_cfg.h"  /* Required for CFE_ES_PERF_MAX_IDS */
+#include "cfe_platform_cfg.h"  /* Required for CFE_ES_PERF_MAX_IDS, CFE_ES_PERF_TASK_RINGS */
 
 #define CFE_ES_PERF_32BIT_WORDS_IN_MASK ((CFE_ES_PERF_MAX_IDS) / 32)
 
@@ -50,9 +50,29 @@ typedef struct {
     uint32                         TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
 } CFE_ES_PerfMetaData_t;
 
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+
+#define CFE_ES_PERF_RING_SIZE ((CFE_ES_PERF_DATA_BUFFER_SIZE) / (CFE_ES_PERF_RING_COUNT))
+
+/*
+ * Write position of one per-task ring.  Ring N holds entries
+ * DataBuffer[N * CFE_ES_PERF_RING_SIZE] on, and Next counts every entry
+ * claimed since collection started.  Each ring is padded to its own cache
+ * line so tasks on different CPUs do not contend for the counters.
+ */
+typedef struct {
+    uint32                         Next;
+    uint32                         Spare[15];
+} CFE_ES_PerfRing_t;
+
+#endif
+
 typedef struct {
     CFE_ES_PerfMetaData_t          MetaData;
     CFE_ES_PerfDataEntry_t         DataBuffer[CFE_ES_PERF_DATA_BUFFER_SIZE];
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+    CFE_ES_PerfRing_t              Ring[CFE_ES_PERF_RING_COUNT];
+#endif
 } CFE_ES_PerfData_t;
 
 
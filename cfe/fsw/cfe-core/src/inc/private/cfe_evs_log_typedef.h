@@ -24,6 +24,50 @@
 #include <common_types.h>
 #include "cfe_evs_msg.h"  /* Required for CFE_EVS_Packet_t definition */
 
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+
+/*
+** \brief  Size of the compact EVS log data area, the memory that would hold
+**  CFE_EVS_LOG_MAX event packets in the full log format
+*/
+#define CFE_EVS_LOG_DATA_SIZE  ((CFE_EVS_LOG_MAX * sizeof(CFE_EVS_Packet_t)) & ~3)
+
+/*
+** \brief  Header of an entry in the compact EVS log.  The header is followed by
+**  TextLength bytes of event text (no terminator) and padding to a multiple of 4.
+**  An entry stands for RepeatCount identical events in a row: the header of the
+**  first one is kept, with the time of the last one in LastTime.
+*/
+typedef struct {
+    uint16             EntrySize;             /**< \brief Bytes in the entry, header and padding included */
+    uint16             TextLength;            /**< \brief Bytes of event text after the header */
+    uint32             RepeatCount;           /**< \brief Number of identical events in the entry */
+    CFE_TIME_SysTime_t LastTime;              /**< \brief Time of the last event in the entry */
+    uint8              TlmHeader[CFE_SB_TLM_HDR_SIZE]; /**< \brief Telemetry header of the first event */
+    CFE_EVS_PacketID_t PacketID;              /**< \brief Event packet information */
+
+} CFE_EVS_LogEntryHdr_t;
+
+/*
+** \brief  EVS Log type definition. This is declared here so ES can include it
+**  in the reset area structure.  Entries are kept in a ring of bytes, from the
+**  entry at First (oldest) to the one at Last (newest).
+*/
+typedef struct {
+    uint32 Next;                              /**< \brief Offset of the next entry in the local event log */
+    uint32 LogCount;                          /**< \brief Local Event Log counter */
+    uint8  LogFullFlag;                       /**< \brief Local Event Log full flag */
+    uint8  LogMode;                           /**< \brief Local Event Logging mode (overwrite/discard) */
+    uint16 LogOverflowCounter;                /**< \brief Local Event Log overflow counter */
+    uint32 First;                             /**< \brief Offset of the oldest entry in the local event log */
+    uint32 Last;                              /**< \brief Offset of the newest entry in the local event log */
+    uint32 Used;                              /**< \brief Bytes of log data in use */
+    uint8  LogData[CFE_EVS_LOG_DATA_SIZE];    /**< \brief The Local Event Log entries */
+
+} CFE_EVS_Log_t;
+
+#else
+
 /*
 ** \brief  EVS Log type definition. This is declared here so ES can include it
 **  in the reset area structure
@@ -38,6 +82,8 @@ typedef struct {
 
 } CFE_EVS_Log_t;
 
+#endif
+
 
 
 #endif /* CFE_EVS_LOG_TYPEDEF_H_ */
@@ -220,6 +220,30 @@ extern int32 CFE_TBL_CleanUpApp(uint32 AppId);
 ******************************************************************************/
 extern int32 CFE_SB_CleanUpApp(uint32 AppId);
 
+/*****************************************************************************/
+/**
+** \brief Discards the sender identity SB has cached for a task
+**
+** \par Description
+**        This function is called by cFE Executive Services whenever it
+**        creates, registers or deletes a task, so that messages sent from
+**        a reused task slot do not carry the name of a previous task.
+**
+******************************************************************************/
+extern void CFE_SB_InvalidateSenderCache(uint32 TaskId);
+
+/*****************************************************************************/
+/**
+** \brief Returns the SB buffers cached by a deleted task to the pool
+**
+** \par Description
+**        This function is called by cFE Executive Services after it deletes
+**        a task (or by a child task as it exits) so that the buffers parked
+**        in the task's SB buffer cache are not lost to the SB memory pool.
+**
+******************************************************************************/
+extern void CFE_SB_ReleaseTaskBufCache(uint32 TaskId);
+
 /*****************************************************************************/
 /**
 ** \brief Removes EVS resources associated with specified Application
@@ -245,6 +269,36 @@ extern int32 CFE_EVS_CleanUpApp(uint32 AppId);
 extern int32 CFE_TIME_CleanUpApp(uint32 AppId);
 
 
+/*****************************************************************************/
+/** cFE Core shared type definitions *****************************************/
+/*****************************************************************************/
+
+/**
+** \brief Buffered log dump writer
+**
+** \par Description
+**        State of one file dump written through #CFE_ES_DumpWrite.  Records are
+**        collected in the buffer and written to the file in
+**        #CFE_ES_DUMP_BUFFER_SIZE byte writes.  Each task that dumps a file
+**        keeps its own writer.
+*/
+typedef struct
+{
+    int32     FileDescriptor;                   /**< \brief File the dump is written to */
+    int32     Status;                           /**< \brief #CFE_SUCCESS, or #CFE_ES_FILE_IO_ERR after a failed write */
+    uint32    WriteSize;                        /**< \brief Bytes requested by the failed write */
+    int32     WriteStatus;                      /**< \brief Return code of the failed write */
+    uint32    FileSize;                         /**< \brief Bytes written to the file */
+    uint32    ElapsedMsec;                      /**< \brief Duration of the dump, set by #CFE_ES_DumpFinish */
+    uint32    BytesPerSec;                      /**< \brief Throughput of the dump, set by #CFE_ES_DumpFinish */
+    OS_time_t StartTime;                        /**< \brief Time the dump started */
+    OS_time_t RunStartTime;                     /**< \brief Time the dump last started or resumed writing */
+    uint32    BufferUsed;                       /**< \brief Bytes collected in the buffer */
+    uint8     Buffer[CFE_ES_DUMP_BUFFER_SIZE];  /**< \brief Records waiting to be written */
+
+} CFE_ES_DumpWriter_t;
+
+
 /*****************************************************************************/
 /** cFE Core task other function call prototypes *****************************/
 /*****************************************************************************/
@@ -313,6 +367,108 @@ int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, int32 BlockSize, const
 ******************************************************************************/
 int32  CFE_ES_DeleteCDS(const char *CDSName, boolean CalledByTblServices);
 
+/*****************************************************************************/
+/**
+** \brief Starts a buffered dump to an open file
+**
+** \par Description
+**        Initializes the writer for a dump to the given file and records the
+**        start time of the dump.  Anything already written to the file (such
+**        as the cFE file header) is not counted in the writer's file size.
+**
+** \param[in]  Writer          Pointer to the writer of the dump.
+**
+** \param[in]  FileDescriptor  File to write, opened by the caller.
+**
+******************************************************************************/
+void   CFE_ES_DumpInit(CFE_ES_DumpWriter_t *Writer, int32 FileDescriptor);
+
+/*****************************************************************************/
+/**
+** \brief Adds data to a buffered dump
+**
+** \par Description
+**        Copies the data into the writer's buffer, writing the buffer to the
+**        file each time it fills.  Data larger than the buffer is written
+**        straight from the caller's memory when the buffer is empty.  After
+**        each write, a dump that has been writing for #CFE_ES_DUMP_RUN_MSEC
+**        delays for #CFE_ES_DUMP_YIELD_MSEC.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Once a write fails, no more data is written and the failed write
+**           is described by the WriteSize and WriteStatus of the writer.
+**        -# The calling function is responsible for issuing any event messages
+**           associated with errors.
+**
+** \param[in]  Writer  Pointer to the writer of the dump.
+**
+** \param[in]  Data    Pointer to the data to add.
+**
+** \param[in]  Size    Number of bytes to add.
+**
+** \return #CFE_SUCCESS         \copydoc CFE_SUCCESS
+** \return #CFE_ES_FILE_IO_ERR  \copydoc CFE_ES_FILE_IO_ERR
+**
+******************************************************************************/
+int32  CFE_ES_DumpWrite(CFE_ES_DumpWriter_t *Writer, const void *Data, uint32 Size);
+
+/*****************************************************************************/
+/**
+** \brief Adds data from a ring buffer to a buffered dump
+**
+** \par Description
+**        Same as #CFE_ES_DumpWrite for Size bytes of a ring buffer starting
+**        at the given offset, continuing at the start of the ring when the
+**        data wraps.
+**
+** \param[in]  Writer    Pointer to the writer of the dump.
+**
+** \param[in]  Ring      Pointer to the start of the ring buffer.
+**
+** \param[in]  RingSize  Size of the ring buffer in bytes.
+**
+** \param[in]  Offset    Offset of the first byte to add, less than RingSize.
+**
+** \param[in]  Size      Number of bytes to add, at most RingSize.
+**
+** \return See return codes for #CFE_ES_DumpWrite
+**
+******************************************************************************/
+int32  CFE_ES_DumpWriteRing(CFE_ES_DumpWriter_t *Writer, const void *Ring, uint32 RingSize,
+                            uint32 Offset, uint32 Size);
+
+/*****************************************************************************/
+/**
+** \brief Completes a buffered dump
+**
+** \par Description
+**        Writes what is left in the writer's buffer and sets the duration
+**        and throughput of the dump in the writer.  The file is not closed.
+**
+** \param[in]  Writer  Pointer to the writer of the dump.
+**
+** \return See return codes for #CFE_ES_DumpWrite
+**
+******************************************************************************/
+int32  CFE_ES_DumpFinish(CFE_ES_DumpWriter_t *Writer);
+
+/*****************************************************************************/
+/**
+** \brief Computes the milliseconds between two PSP times
+**
+** \par Description
+**        Returns the time from Start to Stop, as read by #CFE_PSP_GetTime,
+**        in whole milliseconds.
+**
+** \param[in]  Start  Pointer to the earlier time.
+**
+** \param[in]  Stop   Pointer to the later time.
+**
+** \return Elapsed milliseconds, 0 if the clock went backwards.
+**
+******************************************************************************/
+uint32 CFE_ES_ElapsedMsec(const OS_time_t *Start, const OS_time_t *Stop);
+
 
 
 
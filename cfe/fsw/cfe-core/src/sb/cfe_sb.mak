@@ -15,7 +15,7 @@ TARGET = sb.o
 
 OBJS=\
  cfe_sb_task.o cfe_sb_api.o cfe_sb_priv.o cfe_sb_init.o cfe_sb_buf.o \
- cfe_sb_util.o ccsds.o
+ cfe_sb_util.o cfe_sb_pipe.o ccsds.o
 
 #==============================================================================
 # Source files required to build subsystem; used to generate dependencies.
@@ -210,7 +210,7 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     }/* end if */
 
     /* create the queue */
-    Status = OS_QueueCreate(&SysQueueId,PipeName,Depth,sizeof(CFE_SB_BufferD_t *),0);
+    Status = CFE_SB_CreatePipeQueue(PipeTblIdx,PipeName,Depth,&SysQueueId);
     if (Status != OS_SUCCESS) {
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
@@ -237,6 +237,7 @@ int32  CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16  Depth, const char *
     CFE_SB.PipeTbl[PipeTblIdx].SendErrors  = 0;
     CFE_SB.PipeTbl[PipeTblIdx].CurrentBuff = NULL;
     CFE_SB.PipeTbl[PipeTblIdx].ToTrashBuff = NULL;
+    CFE_SB.PipeTbl[PipeTblIdx].RcvBatchCount = 0;
     strcpy(&CFE_SB.PipeTbl[PipeTblIdx].AppName[0],&AppName[0]);
     strncpy(&CFE_SB.PipeTbl[PipeTblIdx].PipeName[0],PipeName,OS_MAX_API_NAME);
     CFE_SB.PipeTbl[PipeTblIdx].PipeName[OS_MAX_API_NAME-1]='\0';
@@ -425,7 +426,7 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId,uint32 AppId)
     }while(Stat == CFE_SUCCESS);
 
     /* Delete the underlying OS queue */
-    OS_QueueDelete(CFE_SB.PipeTbl[PipeTblIdx].SysQueueId);
+    CFE_SB_DeletePipeQueue(&CFE_SB.PipeTbl[PipeTblIdx]);
 
     /* remove the pipe from the pipe table */
     CFE_SB.PipeTbl[PipeTblIdx].InUse         = CFE_SB_NOT_IN_USE;
@@ -614,6 +615,7 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
     uint32 TskId = 0;
     uint32 AppId = 0xFFFFFFFF;
     uint8  PipeIdx;
+    boolean NewRoute = FALSE;
     CFE_SB_DestinationD_t *DestBlkPtr = NULL;
     char   FullName[(OS_MAX_API_NAME * 2)];
 
@@ -696,12 +698,12 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
            CFE_SB.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB.StatTlmMsg.Payload.MsgIdsInUse;
         }/* end if */
 
-        /* populate the look up table with the routing table index */
-        CFE_SB_SetRoutingTblIdx(MsgId,Idx);
-
-        /* label the new routing block with the message identifier */
+        /* label the new routing block with the message identifier; the */
+        /* look up table is populated once the route has a destination  */
         CFE_SB.RoutingTbl[Idx].MsgId = MsgId;
 
+        NewRoute = TRUE;
+
     }/* end if */
 
     if(CFE_SB.RoutingTbl[Idx].Destinations >= CFE_SB_MAX_DEST_PER_PKT){
@@ -715,6 +717,11 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
 
     DestBlkPtr = CFE_SB_GetDestinationBlk();
     if(DestBlkPtr == NULL){
+        if(NewRoute == TRUE){
+            /* the route was never published, so it can be released right away */
+            CFE_SB.RoutingTbl[Idx].MsgId = CFE_SB_INVALID_MSG_ID;
+            CFE_SB.StatTlmMsg.Payload.MsgIdsInUse--;
+        }/* end if */
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_DEST_BLK_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
             "Subscribe Err:Request for Destination Blk failed for Msg 0x%x", (unsigned int)MsgId);
@@ -736,6 +743,13 @@ int32  CFE_SB_SubscribeFull(CFE_SB_MsgId_t   MsgId,
 
     CFE_SB.RoutingTbl[Idx].Destinations++;
 
+    if(NewRoute == TRUE){
+        /* senders find the route through the look up table, so it is */
+        /* populated only after the route is complete                 */
+        CFE_ATOMIC_BARRIER();
+        CFE_SB_SetRoutingTblIdx(MsgId,Idx);
+    }/* end if */
+
     CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse++;
     if(CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse > CFE_SB.StatTlmMsg.Payload.PeakSubscriptionsInUse)
     {
@@ -907,6 +921,7 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
     uint32  PipeIdx;
     uint32  TskId = 0;
     uint32  MatchFound = FALSE;
+    boolean RouteReleased = FALSE;
     int32   Stat;
     CFE_SB_DestinationD_t   *DestPtr = NULL;
     char    FullName[(OS_MAX_API_NAME * 2)];
@@ -973,25 +988,45 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId,CFE_SB_PipeId_t PipeId,
             /* match found, remove node from list */
             CFE_SB_RemoveDest(Idx,DestPtr);
 
-            /* return node to memory pool */
-            CFE_SB_PutDestinationBlk(DestPtr);
-
             CFE_SB.RoutingTbl[Idx].Destinations--;
             CFE_SB.StatTlmMsg.Payload.SubscriptionsInUse--;
 
             MatchFound = TRUE;
 
-        }/* end if */
+        }else{
 
-        DestPtr = DestPtr->Next;
+            DestPtr = DestPtr->Next;
+
+        }/* end if */
 
     }while((MatchFound == FALSE)&&(DestPtr != NULL));
 
-    /* if 'Destinations' was decremented to zero above... */
+    /* if 'Destinations' was decremented to zero above, release the route */
     if(CFE_SB.RoutingTbl[Idx].Destinations==0){
         CFE_SB.StatTlmMsg.Payload.MsgIdsInUse--;
-        CFE_SB.RoutingTbl[Idx].MsgId = CFE_SB_INVALID_MSG_ID;
         CFE_SB_SetRoutingTblIdx(MsgId,CFE_SB_AVAILABLE);
+        RouteReleased = TRUE;
+    }/* end if */
+
+    if(MatchFound == TRUE){
+
+        /* wait for senders that may still be using the removed node or the    */
+        /* released route before either can be reused.  The routing block keeps */
+        /* its MsgId meanwhile, so it is not handed out again while unlocked.   */
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_SB_SynchronizeSenders();
+        CFE_SB_LockSharedData(__func__,__LINE__);
+
+        DestPtr->Next = NULL;
+        DestPtr->Prev = NULL;
+
+        /* return node to memory pool */
+        CFE_SB_PutDestinationBlk(DestPtr);
+
+    }/* end if */
+
+    if(RouteReleased == TRUE){
+        CFE_SB.RoutingTbl[Idx].MsgId = CFE_SB_INVALID_MSG_ID;
 
         /* Send unsubscribe report only if there are zero requests for this pkt */
         if((CFE_SB.SubscriptionReporting == CFE_SB_ENABLE)&&
@@ -1125,26 +1160,220 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
 {
     CFE_SB_MsgId_t          MsgId;
     int32                   Status;
-    CFE_SB_DestinationD_t   *DestPtr = NULL;
-    CFE_SB_PipeD_t          *PipeDscPtr;
-    CFE_SB_RouteEntry_t     *RtgTblPtr;
-    CFE_SB_BufferD_t        *BufDscPtr;
     uint16                  TotalMsgSize;
-    uint16                  RtgTblIdx;
     uint32                  TskId = 0;
-    uint16                  i;
+    uint32                  Epoch;
     char                    FullName[(OS_MAX_API_NAME * 2)];
     CFE_SB_EventBuf_t       SBSndErr;
 
+    /* get task id for events and Sender Info*/
+    TskId = OS_TaskGetId();
+
+    Status = CFE_SB_ValidateSendMsg(MsgPtr,CopyMode,TskId);
+    if(Status != CFE_SUCCESS){
+        return Status;
+    }/* end if */
+
+    /* a zero copy buffer may be released while it is routed */
+    MsgId = CFE_SB_GetMsgId(MsgPtr);
+    TotalMsgSize = CFE_SB_GetTotalMsgLength(MsgPtr);
+
     SBSndErr.EvtsToSnd = 0;
+    FullName[0] = '\0';
+
+    /*
+    ** Register as an active sender.  Depending on CFE_SB_LOCKLESS_SEND this
+    ** either takes the shared data mutex or lets the routing table be read
+    ** without it, in which case subscribe/unsubscribe wait for this send to
+    ** finish before recycling anything it may be looking at.
+    */
+    Epoch = CFE_SB_EnterSendSection(__func__,__LINE__);
+
+    Status = CFE_SB_RouteMsg(MsgPtr,MsgId,TotalMsgSize,TlmCntIncrements,CopyMode,
+                             TskId,FullName,&SBSndErr);
+
+    /* done with the routing table */
+    CFE_SB_ExitSendSection(Epoch,__func__,__LINE__);
+
+    /* send an event for each error that may have occurred */
+    CFE_SB_SendRouteEvents(MsgId,TotalMsgSize,TskId,FullName,&SBSndErr);
+
+    return Status;
+
+}/* end CFE_SB_SendMsgFull */
+
+
+
+/******************************************************************************
+** Name:    CFE_SB_SendMsgBatch
+**
+** Purpose: API used to send several messages on the software bus with a
+**          single pass over the routing table.
+**
+** Assumptions, External Events, and Notes:
+**
+**          Note: This function increments and tracks the source sequence
+**                counter for all telemetry messages.
+**
+**          Messages are routed in array order.  Each run of messages up to
+**          the next rejected one is validated first and then routed within a
+**          single send section, which is only left (and re-entered) to report
+**          routing errors for a message.
+**
+** Input Arguments:
+**          MsgPtrs
+**          Count
+**
+** Output Arguments:
+**          StatusArray - status of each message, may be NULL
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32  CFE_SB_SendMsgBatch(CFE_SB_Msg_t    **MsgPtrs,
+                           uint32           Count,
+                           int32           *StatusArray)
+{
+    CFE_SB_MsgId_t          MsgId;
+    int32                   Status;
+    int32                   RtnStatus = CFE_SUCCESS;
+    uint16                  TotalMsgSize;
+    uint32                  TskId = 0;
+    uint32                  Epoch = 0;
+    uint32                  i;
+    uint32                  j;
+    uint32                  First;
+    uint32                  Last;
+    boolean                 InSection = FALSE;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
+    CFE_SB_EventBuf_t       SBSndErr;
 
     /* get task id for events and Sender Info*/
     TskId = OS_TaskGetId();
 
+    /* check input parameter */
+    if(MsgPtrs == NULL){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt);
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID,CFE_EVS_ERROR,CFE_SB.AppId,
+            "Send Err:Bad input argument,Arg 0x%lx,App %s",
+            (unsigned long)MsgPtrs,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* the sender name is resolved once, by the first message that needs it */
+    FullName[0] = '\0';
+
+    i = 0;
+    while(i < Count){
+
+        /*
+        ** Validate the next run of messages before the send section is
+        ** entered, since rejecting a message takes the shared data mutex and
+        ** sends an event, neither of which may be done from within the section.
+        */
+        First = i;
+        Status = CFE_SUCCESS;
+        while((i < Count)&&(Status == CFE_SUCCESS)){
+
+            Status = CFE_SB_ValidateSendMsg(MsgPtrs[i],CFE_SB_SEND_ONECOPY,TskId);
+
+            if(StatusArray != NULL){
+                StatusArray[i] = Status;
+            }/* end if */
+
+            if((Status != CFE_SUCCESS)&&(RtnStatus == CFE_SUCCESS)){
+                RtnStatus = Status;
+            }/* end if */
+
+            i++;
+
+        }/* end while */
+
+        /* the run ends before the message that was rejected, if any */
+        Last = (Status == CFE_SUCCESS) ? i : (i - 1);
+
+        for(j=First;j < Last; j++){
+
+            if(InSection == FALSE){
+                Epoch = CFE_SB_EnterSendSection(__func__,__LINE__);
+                InSection = TRUE;
+            }/* end if */
+
+            MsgId = CFE_SB_GetMsgId(MsgPtrs[j]);
+            TotalMsgSize = CFE_SB_GetTotalMsgLength(MsgPtrs[j]);
+
+            SBSndErr.EvtsToSnd = 0;
+            Status = CFE_SB_RouteMsg(MsgPtrs[j],MsgId,TotalMsgSize,CFE_SB_INCREMENT_TLM,
+                                     CFE_SB_SEND_ONECOPY,TskId,FullName,&SBSndErr);
+
+            /* events may not be sent from within the send section */
+            if(SBSndErr.EvtsToSnd != 0){
+                CFE_SB_ExitSendSection(Epoch,__func__,__LINE__);
+                InSection = FALSE;
+                CFE_SB_SendRouteEvents(MsgId,TotalMsgSize,TskId,FullName,&SBSndErr);
+            }/* end if */
+
+            if(StatusArray != NULL){
+                StatusArray[j] = Status;
+            }/* end if */
+
+            if((Status != CFE_SUCCESS)&&(RtnStatus == CFE_SUCCESS)){
+                RtnStatus = Status;
+            }/* end if */
+
+        }/* end for */
+
+        /* the next message is validated outside the send section */
+        if(InSection == TRUE){
+            CFE_SB_ExitSendSection(Epoch,__func__,__LINE__);
+            InSection = FALSE;
+        }/* end if */
+
+    }/* end while */
+
+    return RtnStatus;
+
+}/* end CFE_SB_SendMsgBatch */
+
+
+
+/******************************************************************************
+** Name:    CFE_SB_ValidateSendMsg
+**
+** Purpose: SB internal function to check a message before it is routed.
+**
+** Assumptions, External Events, and Notes:
+**          Sends an event and increments the send error counter if the
+**          message is rejected.  A rejected zero copy buffer is released.
+**
+** Input Arguments:
+**          MsgPtr
+**          CopyMode
+**          TskId - task id of the sender
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32  CFE_SB_ValidateSendMsg(CFE_SB_Msg_t    *MsgPtr,
+                              uint32           CopyMode,
+                              uint32           TskId)
+{
+    CFE_SB_MsgId_t          MsgId;
+    CFE_SB_BufferD_t        *BufDscPtr;
+    uint16                  TotalMsgSize;
+    char                    FullName[(OS_MAX_API_NAME * 2)];
+
     /* check input parameter */
     if(MsgPtr == NULL){
         CFE_SB_LockSharedData(__func__,__LINE__);
-        CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt++;
+        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt);
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID,CFE_EVS_ERROR,CFE_SB.AppId,
             "Send Err:Bad input argument,Arg 0x%lx,App %s",
@@ -1157,7 +1386,7 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     /* validate the msgid in the message */
     if(CFE_SB_ValidateMsgId(MsgId) != CFE_SUCCESS){
         CFE_SB_LockSharedData(__func__,__LINE__);
-        CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt++;
+        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt);
         if (CopyMode == CFE_SB_SEND_ZEROCOPY)
         {
             BufDscPtr = CFE_SB_GetBufferFromCaller(MsgId, MsgPtr);
@@ -1175,7 +1404,7 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     /* Verify the size of the pkt is < or = the mission defined max */
     if(TotalMsgSize > CFE_SB_MAX_SB_MSG_SIZE){
         CFE_SB_LockSharedData(__func__,__LINE__);
-        CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt++;
+        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt);
         if (CopyMode == CFE_SB_SEND_ZEROCOPY)
         {
             BufDscPtr = CFE_SB_GetBufferFromCaller(MsgId, MsgPtr);
@@ -1188,34 +1417,78 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
         return CFE_SB_MSG_TOO_BIG;
     }/* end if */
 
-    /* take semaphore to prevent a task switch during this call */
-    CFE_SB_LockSharedData(__func__,__LINE__);
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_ValidateSendMsg */
+
+
+
+/******************************************************************************
+** Name:    CFE_SB_RouteMsg
+**
+** Purpose: SB internal function to deliver a validated message to all of
+**          the pipes subscribed to it.
+**
+** Assumptions, External Events, and Notes:
+**          Must be called from within a send section (see
+**          CFE_SB_EnterSendSection).  Errors that need an event are added
+**          to SBSndErr, the caller sends them with CFE_SB_SendRouteEvents
+**          after leaving the send section.
+**
+** Input Arguments:
+**          MsgPtr
+**          MsgId - message id of MsgPtr
+**          TotalMsgSize - total length of MsgPtr
+**          TlmCntIncrements
+**          CopyMode
+**          TskId - task id of the sender
+**          FullName - sender name buffer, resolved here if empty and needed
+**
+** Output Arguments:
+**          SBSndErr - events to send
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32  CFE_SB_RouteMsg(CFE_SB_Msg_t       *MsgPtr,
+                       CFE_SB_MsgId_t      MsgId,
+                       uint16              TotalMsgSize,
+                       uint32              TlmCntIncrements,
+                       uint32              CopyMode,
+                       uint32              TskId,
+                       char               *FullName,
+                       CFE_SB_EventBuf_t  *SBSndErr)
+{
+    int32                   Status;
+    CFE_SB_DestinationD_t   *DestPtr = NULL;
+    CFE_SB_PipeD_t          *PipeDscPtr;
+    CFE_SB_RouteEntry_t     *RtgTblPtr = NULL;
+    CFE_SB_BufferD_t        *BufDscPtr;
+    CFE_SB_SenderId_t       *SenderPtr;
+    uint16                  RtgTblIdx;
+    uint16                  InUse;
 
     RtgTblIdx = CFE_SB_GetRoutingTblIdx(MsgId);
 
+    if(RtgTblIdx != CFE_SB_AVAILABLE){
+        RtgTblPtr = &CFE_SB.RoutingTbl[RtgTblIdx];
+        DestPtr = CFE_ATOMIC_LOAD(&RtgTblPtr -> ListHeadPtr);
+    }/* end if */
+
     /* if there have been no subscriptions for this pkt, */
     /* increment the dropped pkt cnt, send event and return success */
     if(RtgTblIdx == CFE_SB_AVAILABLE){
 
-        CFE_SB.HKTlmMsg.Payload.NoSubscribersCnt++;
+        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.NoSubscribersCnt);
 
         if (CopyMode == CFE_SB_SEND_ZEROCOPY){
             BufDscPtr = CFE_SB_GetBufferFromCaller(MsgId, MsgPtr);
             CFE_SB_DecrBufUseCnt(BufDscPtr);
         }
 
-        CFE_SB_UnlockSharedData(__func__,__LINE__);
-
-        /* Determine if event can be sent without causing recursive event problem */
-        if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED){
-
-           CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID,CFE_EVS_INFORMATION,CFE_SB.AppId,
-              "No subscribers for MsgId 0x%x,sender %s",
-              MsgId,CFE_SB_GetAppTskName(TskId,FullName));
-
-           /* clear the bit so the task may send this event again */
-           CFE_SB_FinishSendEvent(TskId,CFE_SB_SEND_NO_SUBS_EID_BIT);
-        }/* end if */
+        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_SEND_NO_SUBS_EID;
+        SBSndErr->EvtsToSnd++;
 
         return CFE_SUCCESS;
     }/* end if */
@@ -1228,19 +1501,10 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
         BufDscPtr = CFE_SB_GetBufferFromPool(MsgId, TotalMsgSize);
     }
     if (BufDscPtr == NULL){
-        CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt++;
-        CFE_SB_UnlockSharedData(__func__,__LINE__);
-
-        /* Determine if event can be sent without causing recursive event problem */
-        if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED){
+        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt);
 
-            CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
-              "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
-              MsgId,CFE_SB_GetAppTskName(TskId,FullName),TotalMsgSize);
-
-            /* clear the bit so the task may send this event again */
-            CFE_SB_FinishSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT);
-        }/* end if */
+        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_GET_BUF_ERR_EID;
+        SBSndErr->EvtsToSnd++;
 
         return CFE_SB_BUF_ALOC_ERR;
     }/* end if */
@@ -1254,88 +1518,93 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     /* For Tlm packets, increment the seq count if requested */
     if((CFE_SB_GetPktType(MsgId)==CFE_SB_TLM) &&
        (TlmCntIncrements==CFE_SB_INCREMENT_TLM)){
-        CFE_SB.RoutingTbl[RtgTblIdx].SeqCnt++;
         CFE_SB_SetMsgSeqCnt((CFE_SB_Msg_t *)BufDscPtr->Buffer,
-                              CFE_SB.RoutingTbl[RtgTblIdx].SeqCnt);
+                              CFE_ATOMIC_INC(&RtgTblPtr->SeqCnt));
     }/* end if */
 
-    /* store the sender information */
+    /* store the sender information, the task's identity is kept by SB */
     if(CFE_SB.SenderReporting != 0)
     {
-       BufDscPtr->Sender.ProcessorId = CFE_PSP_GetProcessorId();
-       strncpy(&BufDscPtr->Sender.AppName[0],CFE_SB_GetAppTskName(TskId,FullName),OS_MAX_API_NAME);
+       SenderPtr = CFE_SB_GetTaskSenderId(TskId,&BufDscPtr->Sender);
+       if(SenderPtr != &BufDscPtr->Sender){
+           BufDscPtr->Sender = *SenderPtr;
+       }/* end if */
     }
 
-    RtgTblPtr = &CFE_SB.RoutingTbl[RtgTblIdx];
+    /*
+    ** Send the packet to all destinations.  The list is walked to its end
+    ** rather than for 'Destinations' entries because subscribers may be
+    ** added or removed while it is being walked.
+    */
+    while(DestPtr != NULL){
 
-    /* At this point there must be at least one destination for pkt */
+        if (DestPtr->Active != CFE_SB_INACTIVE)    /* destination is active */
+        {
+            PipeDscPtr = &CFE_SB.PipeTbl[DestPtr->PipeId];
 
-    DestPtr = RtgTblPtr -> ListHeadPtr;
+            /* if Msg limit exceeded, log event, increment counter */
+            /* and go to next destination */
+            if(CFE_SB_ReserveDestSlot(DestPtr) == CFE_SB_DENIED){
 
-    /* Send the packet to all destinations  */
-    for (i=0; i < RtgTblPtr -> Destinations; i++) {
+                SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].PipeId  = DestPtr->PipeId;
+                SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
+                SBSndErr->EvtsToSnd++;
+                CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.MsgLimErrCnt);
+                CFE_ATOMIC_INC(&PipeDscPtr->SendErrors);
 
-        /* The DestPtr should never be NULL in this loop, this is just extra
-           protection in case of the unforseen */
-        if(DestPtr == NULL){
-          break;
-        }
+            }else{
 
-        if (DestPtr->Active != CFE_SB_INACTIVE)    /* destination is active */
-        {
+                /*
+                ** Count the pipe's reference to the buffer before the buffer
+                ** can be seen on the pipe, the receiver may release it at once.
+                */
+                CFE_ATOMIC_INC(&BufDscPtr->UseCount);    /* used for releasing buffer  */
+                if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
+                {
+                    CFE_SB_PipeDepthStats_t *StatObj =
+                            &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId];
+                    InUse = CFE_ATOMIC_INC(&StatObj->InUse);
+                    CFE_ATOMIC_RAISE_PEAK(&StatObj->PeakInUse, InUse);
+                }/* end if */
 
-        PipeDscPtr = &CFE_SB.PipeTbl[DestPtr->PipeId];
+                /*
+                ** Write the buffer descriptor to the queue of the pipe.  If the write
+                ** failed, log info and increment the pipe's error counter.
+                */
+                Status = CFE_SB_PutPipeQueue(PipeDscPtr,BufDscPtr);
 
-        /* if Msg limit exceeded, log event, increment counter */
-        /* and go to next destination */
-        if(DestPtr->BuffCount >= DestPtr->MsgId2PipeLim){
+                if (Status == OS_SUCCESS) {
 
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
-            SBSndErr.EvtsToSnd++;
-            CFE_SB.HKTlmMsg.Payload.MsgLimErrCnt++;
-            PipeDscPtr->SendErrors++;
+                    CFE_ATOMIC_INC(&DestPtr->DestCnt);   /* used for statistics */
 
-            }else{
-        /*
-        ** Write the buffer descriptor to the queue of the pipe.  If the write
-        ** failed, log info and increment the pipe's error counter.
-        */
-                Status = OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&BufDscPtr,
-                                     sizeof(CFE_SB_BufferD_t *),0);
-
-        if (Status == OS_SUCCESS) {
-            BufDscPtr->UseCount++;    /* used for releasing buffer  */
-            DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
-            DestPtr->DestCnt++;   /* used for statistics */
-            if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
-            {
-                CFE_SB_PipeDepthStats_t *StatObj =
-                        &CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId];
-                StatObj->InUse++;
-                if(StatObj->InUse > StatObj->PeakInUse){
-                    StatObj->PeakInUse = StatObj->InUse;
-            }/* end if */
-            }
+                }else{
 
-        }else if(Status == OS_QUEUE_FULL) {
+                    /* the buffer is not on the pipe, undo the counts taken above */
+                    CFE_ATOMIC_DEC(&BufDscPtr->UseCount);
+                    CFE_ATOMIC_DEC(&DestPtr->BuffCount);
+                    if (DestPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
+                    {
+                        CFE_ATOMIC_DEC(&CFE_SB.StatTlmMsg.Payload.PipeDepthStats[DestPtr->PipeId].InUse);
+                    }/* end if */
 
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
-            SBSndErr.EvtsToSnd++;
-            CFE_SB.HKTlmMsg.Payload.PipeOverflowErrCnt++;
-            PipeDscPtr->SendErrors++;
+                    if(Status == OS_QUEUE_FULL) {
 
+                        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].PipeId  = DestPtr->PipeId;
+                        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
+                        SBSndErr->EvtsToSnd++;
+                        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.PipeOverflowErrCnt);
+                        CFE_ATOMIC_INC(&PipeDscPtr->SendErrors);
 
-        }else{ /* Unexpected error while writing to queue. */
+                    }else{ /* Unexpected error while writing to queue. */
 
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_WR_ERR_EID;
-            SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].ErrStat = Status;
-            SBSndErr.EvtsToSnd++;
-            CFE_SB.HKTlmMsg.Payload.InternalErrCnt++;
-            PipeDscPtr->SendErrors++;
+                        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].PipeId  = DestPtr->PipeId;
+                        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].EventId = CFE_SB_Q_WR_ERR_EID;
+                        SBSndErr->EvtBuf[SBSndErr->EvtsToSnd].ErrStat = Status;
+                        SBSndErr->EvtsToSnd++;
+                        CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.InternalErrCnt);
+                        CFE_ATOMIC_INC(&PipeDscPtr->SendErrors);
 
+                    }/*end if */
                 }/*end if */
             }/*end if */
         }/*end if */
@@ -1353,14 +1622,80 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     */
     CFE_SB_DecrBufUseCnt(BufDscPtr);
 
-    /* release the semaphore */
-    CFE_SB_UnlockSharedData(__func__,__LINE__);
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_RouteMsg */
+
+
+
+/******************************************************************************
+** Name:    CFE_SB_SendRouteEvents
+**
+** Purpose: SB internal function to send the events for the errors found by
+**          CFE_SB_RouteMsg.
+**
+** Assumptions, External Events, and Notes:
+**          Must be called outside of the send section.
+**
+** Input Arguments:
+**          MsgId
+**          TotalMsgSize
+**          TskId - task id of the sender
+**          FullName - sender name buffer, resolved here if empty
+**          SBSndErr - events to send
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          None
+**
+******************************************************************************/
+void  CFE_SB_SendRouteEvents(CFE_SB_MsgId_t      MsgId,
+                             uint16              TotalMsgSize,
+                             uint32              TskId,
+                             char               *FullName,
+                             CFE_SB_EventBuf_t  *SBSndErr)
+{
+    uint32                  i;
 
+    if(SBSndErr->EvtsToSnd == 0){
+        return;
+    }/* end if */
 
-    /* send an event for each pipe write error that may have occurred */
-    for(i=0;i < SBSndErr.EvtsToSnd; i++)
+    if(FullName[0] == '\0'){
+        CFE_SB_GetAppTskName(TskId,FullName);
+    }/* end if */
+
+    for(i=0;i < SBSndErr->EvtsToSnd; i++)
     {
-        if(SBSndErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
+        if(SBSndErr->EvtBuf[i].EventId == CFE_SB_SEND_NO_SUBS_EID)
+        {
+            /* Determine if event can be sent without causing recursive event problem */
+            if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED){
+
+               CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID,CFE_EVS_INFORMATION,CFE_SB.AppId,
+                  "No subscribers for MsgId 0x%x,sender %s",
+                  MsgId,FullName);
+
+               /* clear the bit so the task may send this event again */
+               CFE_SB_FinishSendEvent(TskId,CFE_SB_SEND_NO_SUBS_EID_BIT);
+            }/* end if */
+
+        }else if(SBSndErr->EvtBuf[i].EventId == CFE_SB_GET_BUF_ERR_EID){
+
+            /* Determine if event can be sent without causing recursive event problem */
+            if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED){
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
+                  "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
+                  MsgId,FullName,TotalMsgSize);
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId,CFE_SB_GET_BUF_ERR_EID_BIT);
+            }/* end if */
+
+        }else if(SBSndErr->EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
         {
             /* Determine if event can be sent without causing recursive event problem */
             if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED){
@@ -1370,15 +1705,15 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
 
               CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
                 "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                (unsigned int)RtgTblPtr->MsgId,
-                CFE_SB_GetPipeName(SBSndErr.EvtBuf[i].PipeId),
-                CFE_SB_GetAppTskName(TskId,FullName));
+                (unsigned int)MsgId,
+                CFE_SB_GetPipeName(SBSndErr->EvtBuf[i].PipeId),
+                FullName);
 
               /* clear the bit so the task may send this event again */
               CFE_SB_FinishSendEvent(TskId,CFE_SB_MSGID_LIM_ERR_EID_BIT);
             }/* end if */
 
-        }else if(SBSndErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID){
+        }else if(SBSndErr->EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID){
 
             /* Determine if event can be sent without causing recursive event problem */
             if(CFE_SB_RequestToSendEvent(TskId,CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED){
@@ -1388,9 +1723,9 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
 
               CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
                   "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                  (unsigned int)RtgTblPtr->MsgId,
-                  CFE_SB_GetPipeName(SBSndErr.EvtBuf[i].PipeId),
-                  CFE_SB_GetAppTskName(TskId,FullName));
+                  (unsigned int)MsgId,
+                  CFE_SB_GetPipeName(SBSndErr->EvtBuf[i].PipeId),
+                  FullName);
 
                /* clear the bit so the task may send this event again */
               CFE_SB_FinishSendEvent(TskId,CFE_SB_Q_FULL_ERR_EID_BIT);
@@ -1403,10 +1738,10 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
 
               CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
                 "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat 0x%x",
-                (unsigned int)RtgTblPtr->MsgId,
-                CFE_SB_GetPipeName(SBSndErr.EvtBuf[i].PipeId),
-                CFE_SB_GetAppTskName(TskId,FullName),
-                (unsigned int)SBSndErr.EvtBuf[i].ErrStat);
+                (unsigned int)MsgId,
+                CFE_SB_GetPipeName(SBSndErr->EvtBuf[i].PipeId),
+                FullName,
+                (unsigned int)SBSndErr->EvtBuf[i].ErrStat);
 
                /* clear the bit so the task may send this event again */
               CFE_SB_FinishSendEvent(TskId,CFE_SB_Q_WR_ERR_EID_BIT);
@@ -1415,10 +1750,7 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
         }/* end if */
     }
 
-
-    return CFE_SUCCESS;
-
-}/* end CFE_SB_SendMsgFull */
+}/* end CFE_SB_SendRouteEvents */
 
 
 
@@ -1512,6 +1844,9 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 
     }/* end if */
 
+    /* and any buffers left from a batch receive */
+    CFE_SB_ReleaseRcvBatch(PipeDscPtr);
+
     if (Status == CFE_SUCCESS) {
 
         /*
@@ -1535,15 +1870,13 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
         */
         if(DestPtr != NULL){
 
-            if (DestPtr->BuffCount > 0){
-                DestPtr->BuffCount--;
-            }
+            CFE_SB_ReleaseDestSlot(DestPtr);
 
         }/* end if DestPtr != NULL */
 
         if (PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
         {
-        CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse--;
+        CFE_ATOMIC_DEC(&CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse);
         }
 
     }else{
@@ -1566,6 +1899,180 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 }/* end CFE_SB_RcvMsg */
 
 
+
+/******************************************************************************
+** Name:    CFE_SB_RcvMsgBatch
+**
+** Purpose: API used to receive several messages from a pipe in one call.
+**
+** Assumptions, External Events, and Notes:
+**          The timeout only applies to the first message, the remaining
+**          messages are only taken if they are already on the pipe.  The
+**          buffers are released on the next receive from the pipe.
+**
+** Input Arguments:
+**          BufPtrs - array of at least MaxMsgs message pointers
+**          MaxMsgs - limited to CFE_SB_MAX_RCV_BATCH
+**          PipeId
+**          timeOut - CFE_SB_PEND, CFE_SB_POLL or millisecond timeout
+**
+** Output Arguments:
+**          NumMsgs - number of messages received
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32  CFE_SB_RcvMsgBatch(CFE_SB_MsgPtr_t    *BufPtrs,
+                          uint32              MaxMsgs,
+                          uint32             *NumMsgs,
+                          CFE_SB_PipeId_t     PipeId,
+                          int32               TimeOut)
+{
+    int32                  Status;
+    int32                  Stat;
+    CFE_SB_BufferD_t       *Message[CFE_SB_MAX_RCV_BATCH];
+    CFE_SB_PipeD_t         *PipeDscPtr;
+    CFE_SB_DestinationD_t  *DestPtr = NULL;
+    uint32                 Count = 0;
+    uint32                 i;
+    uint32                 TskId = 0;
+    char                   FullName[(OS_MAX_API_NAME * 2)];
+
+    /* get task id for events */
+    TskId = OS_TaskGetId();
+
+    /* Check input parameters */
+    if((BufPtrs == NULL)||(NumMsgs == NULL)||(MaxMsgs == 0)||(TimeOut < (-1))){
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgReceiveErrCnt++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID,CFE_EVS_ERROR,CFE_SB.AppId,
+            "Rcv Err:Bad Input Arg:BufPtr 0x%lx,pipe %d,t/o %d,app %s",
+            (unsigned long)BufPtrs,(int)PipeId,(int)TimeOut,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    *NumMsgs = 0;
+
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    /* If the pipe does not exist or PipeId is out of range... */
+    if (PipeDscPtr == NULL) {
+        CFE_SB_LockSharedData(__func__,__LINE__);
+        CFE_SB.HKTlmMsg.Payload.MsgReceiveErrCnt++;
+        CFE_SB_UnlockSharedData(__func__,__LINE__);
+        CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID,CFE_EVS_ERROR,CFE_SB.AppId,
+            "Rcv Err:PipeId %d does not exist,app %s",
+            (int)PipeId,CFE_SB_GetAppTskName(TskId,FullName));
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    if(MaxMsgs > CFE_SB_MAX_RCV_BATCH){
+        MaxMsgs = CFE_SB_MAX_RCV_BATCH;
+    }/* end if */
+
+    /* Save off any currently in use buffer to free later */
+    PipeDscPtr->ToTrashBuff = PipeDscPtr->CurrentBuff;
+    PipeDscPtr->CurrentBuff = NULL;
+
+    /* wait for the first message, then take whatever else is already there */
+    Status = CFE_SB_ReadQueue(PipeDscPtr, TskId, TimeOut, &Message[0]);
+    if (Status == CFE_SUCCESS) {
+        Count = 1;
+        while (Count < MaxMsgs) {
+            Stat = CFE_SB_ReadQueue(PipeDscPtr, TskId, CFE_SB_POLL, &Message[Count]);
+            if (Stat != CFE_SUCCESS) {
+                break;
+            }/* end if */
+            Count++;
+        }/* end while */
+    }/* end if */
+
+    /* one lock for the whole batch */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    /* free the buffers returned by the previous receive */
+    if (PipeDscPtr->ToTrashBuff != NULL) {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->ToTrashBuff);
+        PipeDscPtr->ToTrashBuff = NULL;
+    }/* end if */
+
+    CFE_SB_ReleaseRcvBatch(PipeDscPtr);
+
+    for (i = 0; i < Count; i++) {
+
+        BufPtrs[i] = (CFE_SB_MsgPtr_t) Message[i]->Buffer;
+
+        /* see CFE_SB_RcvMsg for why DestPtr may be NULL */
+        DestPtr = CFE_SB_GetDestPtr(Message[i]->MsgId, PipeDscPtr->PipeId);
+        if(DestPtr != NULL){
+            CFE_SB_ReleaseDestSlot(DestPtr);
+        }/* end if */
+
+        if (PipeDscPtr->PipeId < CFE_SB_TLM_PIPEDEPTHSTATS_SIZE)
+        {
+        CFE_ATOMIC_DEC(&CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeDscPtr->PipeId].InUse);
+        }
+
+    }/* end for */
+
+    /*
+    ** The last buffer is kept as the pipe's current buffer (so that
+    ** CFE_SB_GetLastSenderId reports its sender), the others are kept
+    ** until the next receive.
+    */
+    if (Count > 0) {
+        PipeDscPtr->CurrentBuff = Message[Count - 1];
+        for (i = 0; i < (Count - 1); i++) {
+            PipeDscPtr->RcvBatchBuff[i] = Message[i];
+        }/* end for */
+        PipeDscPtr->RcvBatchCount = Count - 1;
+    }/* end if */
+
+    /* release the semaphore */
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    *NumMsgs = Count;
+
+    return Status;
+
+}/* end CFE_SB_RcvMsgBatch */
+
+
+
+/******************************************************************************
+** Name:    CFE_SB_ReleaseRcvBatch
+**
+** Purpose: SB internal function to release the buffers kept on a pipe by
+**          the last CFE_SB_RcvMsgBatch call.
+**
+** Assumptions, External Events, and Notes:
+**          Called with the shared data mutex held.
+**
+** Input Arguments:
+**          PipeDscPtr
+**
+** Output Arguments:
+**          None
+**
+** Return Values:
+**          None
+**
+******************************************************************************/
+void  CFE_SB_ReleaseRcvBatch(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    uint32  i;
+
+    for (i = 0; i < PipeDscPtr->RcvBatchCount; i++) {
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->RcvBatchBuff[i]);
+        PipeDscPtr->RcvBatchBuff[i] = NULL;
+    }/* end for */
+
+    PipeDscPtr->RcvBatchCount = 0;
+
+}/* end CFE_SB_ReleaseRcvBatch */
+
+
 /******************************************************************************
 ** Name:    CFE_SB_GetLastSenderId
 **
@@ -1673,6 +2180,7 @@ CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
                                      CFE_SB_ZeroCopyHandle_t *BufferHandle)
 {
    int32                stat1;
+   uint32               InUse;
    uint32               AppId = 0xFFFFFFFF;
    uint8               *address = NULL;
    CFE_SB_ZeroCopyD_t  *zcd = NULL;
@@ -1689,10 +2197,8 @@ CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
 
     /* Add the size of a zero copy descriptor to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.MemInUse+=stat1;
-    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
-       CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
-    }/* end if */
+    InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)stat1);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakMemInUse, InUse);
 
     /* Allocate a new buffer (from the SB memory pool) to hold the message  */
     stat1 = CFE_ES_GetPoolBuf((uint32 **)&bd, CFE_SB.Mem.PoolHdl, MsgSize + sizeof(CFE_SB_BufferD_t));
@@ -1700,7 +2206,7 @@ CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
         /*deallocate the first buffer if the second buffer creation fails*/
         stat1 = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)zcd);
         if(stat1 > 0){
-            CFE_SB.StatTlmMsg.Payload.MemInUse-=stat1;
+            CFE_ATOMIC_SUB(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)stat1);
         }
         CFE_SB_UnlockSharedData(__func__,__LINE__);
         return NULL;
@@ -1708,17 +2214,13 @@ CFE_SB_Msg_t  *CFE_SB_ZeroCopyGetPtr(uint16 MsgSize,
 
     /* Increment the number of buffers in use by one even though two buffers */
     /* were allocated. SBBuffersInUse increments on a per-message basis */
-    CFE_SB.StatTlmMsg.Payload.SBBuffersInUse++;
-    if(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse){
-        CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
-    }/* end if */
+    InUse = CFE_ATOMIC_INC(&CFE_SB.StatTlmMsg.Payload.SBBuffersInUse);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse, InUse);
 
     /* Add the size of the actual buffer to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.MemInUse+=stat1;
-    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
-       CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
-    }/* end if */
+    InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)stat1);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakMemInUse, InUse);
 
     /* first set ptr to actual msg buffer the same as ptr to descriptor */
     address = (uint8 *)bd;
@@ -1797,8 +2299,8 @@ int32 CFE_SB_ZeroCopyReleasePtr(CFE_SB_Msg_t  *Ptr2Release,
                                   (uint32 *) (((uint8 *)Ptr2Release) - sizeof(CFE_SB_BufferD_t)));
         if(Stat2 > 0){
              /* Substract the size of the actual buffer from the Memory in use ctr */
-            CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat2;
-            CFE_SB.StatTlmMsg.Payload.SBBuffersInUse--;
+            CFE_ATOMIC_SUB(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)Stat2);
+            CFE_ATOMIC_DEC(&CFE_SB.StatTlmMsg.Payload.SBBuffersInUse);
         }/* end if */
     }
 
@@ -1862,7 +2364,7 @@ int32 CFE_SB_ZeroCopyReleaseDesc(CFE_SB_Msg_t  *Ptr2Release,
     Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)zcd);
     if(Stat > 0){
         /* Substract the size of the actual buffer from the Memory in use ctr */
-        CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
+        CFE_ATOMIC_SUB(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)Stat);
     }/* end if */
 
     CFE_SB_UnlockSharedData(__func__,__LINE__);
@@ -1950,6 +2452,144 @@ int32 CFE_SB_ZeroCopyPass(CFE_SB_Msg_t   *MsgPtr,
 }/* end CFE_SB_ZeroCopyPass */
 
 
+/******************************************************************************
+** Name:    CFE_SB_MakeWritable
+**
+** Purpose: API used to take ownership of a received message as a zero copy
+**          buffer that the caller may modify.
+**
+** Assumptions, External Events, and Notes:
+**          Only the task receiving from the pipe changes the pipe's references
+**          to received buffers, so the reference found below stays in place
+**          while the copy (if any) is made.  The message is only copied if
+**          other pipes still hold the buffer.
+**
+** Input Arguments:
+**          BufPtr - pointer to the received message pointer
+**          PipeId - the pipe the message was received from
+**
+** Output Arguments:
+**          BufPtr - pointer to the writable message
+**          BufferHandle - zero copy handle of the writable message
+**
+** Return Values:
+**          Status
+**
+******************************************************************************/
+int32 CFE_SB_MakeWritable(CFE_SB_MsgPtr_t *BufPtr, CFE_SB_PipeId_t PipeId,
+                          CFE_SB_ZeroCopyHandle_t *BufferHandle)
+{
+    CFE_SB_PipeD_t          *PipeDscPtr;
+    CFE_SB_BufferD_t        **PipeRef = NULL;
+    CFE_SB_BufferD_t        *bd;
+    CFE_SB_ZeroCopyD_t      *zcd = NULL;
+    CFE_SB_Msg_t            *CopyPtr = NULL;
+    CFE_SB_ZeroCopyHandle_t CopyHandle = 0;
+    uint32                  AppId = 0xFFFFFFFF;
+    uint32                  InUse;
+    uint32                  i;
+    int32                   Stat;
+
+    if((BufPtr == NULL)||(*BufPtr == NULL)||(BufferHandle == NULL)){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    PipeDscPtr = CFE_SB_GetPipePtr(PipeId);
+    if(PipeDscPtr == NULL){
+        return CFE_SB_BAD_ARGUMENT;
+    }/* end if */
+
+    /* find the pipe's reference to the message */
+    CFE_SB_LockSharedData(__func__,__LINE__);
+
+    if((PipeDscPtr->CurrentBuff != NULL) &&
+       (PipeDscPtr->CurrentBuff->Buffer == (void *)*BufPtr)){
+        PipeRef = &PipeDscPtr->CurrentBuff;
+    }/* end if */
+
+    for(i = 0; (PipeRef == NULL) && (i < PipeDscPtr->RcvBatchCount); i++){
+        if(PipeDscPtr->RcvBatchBuff[i]->Buffer == (void *)*BufPtr){
+            PipeRef = &PipeDscPtr->RcvBatchBuff[i];
+        }/* end if */
+    }/* end for */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(PipeRef == NULL){
+        return CFE_SB_BUFFER_INVALID;
+    }/* end if */
+
+    bd = *PipeRef;
+
+    if(CFE_ATOMIC_LOAD(&bd->UseCount) > 1){
+
+        /* other pipes still hold the buffer, give the caller its own copy */
+        CopyPtr = CFE_SB_ZeroCopyGetPtr((uint16)bd->Size, &CopyHandle);
+        if(CopyPtr == NULL){
+            return CFE_SB_BUF_ALOC_ERR;
+        }/* end if */
+
+        CFE_PSP_MemCpy(CopyPtr, bd->Buffer, (uint16)bd->Size);
+
+        CFE_SB_LockSharedData(__func__,__LINE__);
+
+    }else{
+
+        /* the pipe holds the only reference, loan the buffer itself */
+        CFE_SB_LockSharedData(__func__,__LINE__);
+
+        Stat = CFE_ES_GetPoolBuf((uint32 **)&zcd, CFE_SB.Mem.PoolHdl, sizeof(CFE_SB_ZeroCopyD_t));
+        if(Stat < 0){
+            CFE_SB_UnlockSharedData(__func__,__LINE__);
+            return CFE_SB_BUF_ALOC_ERR;
+        }/* end if */
+
+        InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)Stat);
+        CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakMemInUse, InUse);
+
+        zcd->Size      = bd->Size;
+        zcd->Buffer    = bd->Buffer;
+        zcd->Next      = NULL;
+
+        /* Add this Zero Copy Descriptor to the end of the chain */
+        if(CFE_SB.ZeroCopyTail != NULL){
+            ((CFE_SB_ZeroCopyD_t *) CFE_SB.ZeroCopyTail)->Next = (void *)zcd;
+        }
+        zcd->Prev = CFE_SB.ZeroCopyTail;
+        CFE_SB.ZeroCopyTail = (void *)zcd;
+
+    }/* end if */
+
+    /* remove the message from the pipe */
+    if(PipeRef == &PipeDscPtr->CurrentBuff){
+        PipeDscPtr->CurrentBuff = NULL;
+    }else{
+        PipeDscPtr->RcvBatchCount--;
+        *PipeRef = PipeDscPtr->RcvBatchBuff[PipeDscPtr->RcvBatchCount];
+        PipeDscPtr->RcvBatchBuff[PipeDscPtr->RcvBatchCount] = NULL;
+    }/* end if */
+
+    /* drop the pipe's reference to a shared buffer */
+    if(CopyPtr != NULL){
+        CFE_SB_DecrBufUseCnt(bd);
+    }/* end if */
+
+    CFE_SB_UnlockSharedData(__func__,__LINE__);
+
+    if(CopyPtr != NULL){
+        *BufPtr = CopyPtr;
+        *BufferHandle = CopyHandle;
+    }else{
+        CFE_ES_GetAppID(&AppId);
+        zcd->AppID = AppId;
+        *BufferHandle = (CFE_SB_ZeroCopyHandle_t) zcd;
+    }/* end if */
+
+    return CFE_SUCCESS;
+
+}/* end CFE_SB_MakeWritable */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_ReadQueue()
 **
@@ -1982,7 +2622,6 @@ int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
                          CFE_SB_BufferD_t       **Message)
 {
     int32              Status,TimeOut;
-    uint32             Nbytes;
     char               FullName[(OS_MAX_API_NAME * 2)];
 
     /* translate the given Time_Out value */
@@ -2003,11 +2642,7 @@ int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
     }/* end switch */
 
     /* Read the buffer descriptor address from the queue.  */
-    Status = OS_QueueGet(PipeDscPtr->SysQueueId,
-                        (void *)Message,
-                        sizeof(CFE_SB_BufferD_t *),
-                        &Nbytes,
-                        TimeOut);
+    Status = CFE_SB_GetPipeQueue(PipeDscPtr,Message,TimeOut);
 
     /* translate the return value */
     switch(Status){
@@ -2026,7 +2661,7 @@ int32  CFE_SB_ReadQueue (CFE_SB_PipeD_t         *PipeDscPtr,
 
       default:
           CFE_SB_LockSharedData(__func__,__LINE__);
-          CFE_SB.HKTlmMsg.Payload.InternalErrCnt++;
+          CFE_ATOMIC_INC(&CFE_SB.HKTlmMsg.Payload.InternalErrCnt);
           CFE_SB_UnlockSharedData(__func__,__LINE__);
           /* Unexpected error while reading the queue. */
           CFE_EVS_SendEventWithAppID(CFE_SB_Q_RD_ERR_EID,CFE_EVS_ERROR,CFE_SB.AppId,
@@ -87,6 +87,356 @@
 #include "cfe_es.h"
 #include "cfe_error.h"
 
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+
+/******************************************************************************
+**  Function:   CFE_SB_GetTaskBufCache()
+**
+**  Purpose:
+**    Return the buffer cache of the calling task, marked busy.  The caller
+**    must give it back with CFE_SB_PutTaskBufCache.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    Pointer to the cache, or NULL if the caller has no task table index or
+**    its buffers are being given back to the memory pool.
+*/
+static CFE_SB_BufCache_t *CFE_SB_GetTaskBufCache(void)
+{
+    uint32  TskIdx;
+
+    if((OS_ConvertToArrayIndex(OS_TaskGetId(), &TskIdx) != OS_SUCCESS) ||
+       (TskIdx >= OS_MAX_TASKS)){
+        return NULL;
+    }/* end if */
+
+    if(!CFE_ATOMIC_CAS(&CFE_SB.Mem.Cache[TskIdx].Busy, 0, 1)){
+        return NULL;
+    }/* end if */
+
+    return &CFE_SB.Mem.Cache[TskIdx];
+
+}/* end CFE_SB_GetTaskBufCache */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_PutTaskBufCache()
+**
+**  Purpose:
+**    Give back a buffer cache taken with CFE_SB_GetTaskBufCache.
+**
+**  Arguments:
+**    Cache : Pointer to the cache.
+**
+**  Return:
+**    None
+*/
+static void CFE_SB_PutTaskBufCache(CFE_SB_BufCache_t *Cache)
+{
+    /* the magazine updates must land before the cache is free again */
+    CFE_ATOMIC_BARRIER();
+    Cache->Busy = 0;
+
+}/* end CFE_SB_PutTaskBufCache */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_EmptyBufCache()
+**
+**  Purpose:
+**    Give every buffer parked in a cache back to the SB memory pool, if the
+**    cache is not busy.  The BuffersInUse and MemInUse counters are left
+**    alone; they are the task's share of the totals and are still summed by
+**    CFE_SB_CollectBufStats.
+**
+**  Arguments:
+**    Cache : Pointer to the cache.
+**
+**  Return:
+**    Number of buffers given back to the pool.
+*/
+static uint32 CFE_SB_EmptyBufCache(CFE_SB_BufCache_t *Cache)
+{
+    uint32  Class;
+    uint32  i;
+    uint32  Released = 0;
+    CFE_SB_BufMagazine_t *Mag;
+
+    /* a busy cache is in use by a task, which keeps its buffers */
+    if(!CFE_ATOMIC_CAS(&Cache->Busy, 0, 1)){
+        return 0;
+    }/* end if */
+
+    for(Class = 0; Class < CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; Class++){
+
+        Mag = &Cache->Magazine[Class];
+        for(i = 0; i < Mag->Count; i++){
+            CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)Mag->Buffers[i]);
+        }/* end for */
+        Released += Mag->Count;
+        Mag->Count = 0;
+
+    }/* end for */
+
+    CFE_SB_PutTaskBufCache(Cache);
+
+    return Released;
+
+}/* end CFE_SB_EmptyBufCache */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_ReclaimBufCaches()
+**
+**  Purpose:
+**    Give the buffers parked in every task's cache back to the SB memory
+**    pool.  Called when the pool has no buffer left, so buffers cached by
+**    tasks that stopped sending can be used by the others.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    Number of buffers given back to the pool.
+*/
+static uint32 CFE_SB_ReclaimBufCaches(void)
+{
+    uint32  i;
+    uint32  Released = 0;
+
+    for(i = 0; i < OS_MAX_TASKS; i++){
+        Released += CFE_SB_EmptyBufCache(&CFE_SB.Mem.Cache[i]);
+    }/* end for */
+
+    return Released;
+
+}/* end CFE_SB_ReclaimBufCaches */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_GetBufCacheClass()
+**
+**  Purpose:
+**    Look up the SB memory pool block size index that the pool would use for
+**    a buffer of the given size.
+**
+**  Arguments:
+**    BlockSize : Size of the message plus its buffer descriptor.
+**
+**  Return:
+**    Index into CFE_SB_MemPoolDefSize, or CFE_SB_BUF_CACHE_NONE if buffers of
+**    this size are not cached.
+*/
+static uint32 CFE_SB_GetBufCacheClass(uint32 BlockSize)
+{
+    if(BlockSize > CFE_SB_BUF_CACHE_MAX_BLOCK){
+        return CFE_SB_BUF_CACHE_NONE;
+    }/* end if */
+
+    return CFE_SB.Mem.CacheClass[BlockSize];
+
+}/* end CFE_SB_GetBufCacheClass */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_RefillBufMagazine()
+**
+**  Purpose:
+**    Take up to half a magazine worth of buffers of one block size from the
+**    SB memory pool.
+**
+**  Arguments:
+**    Mag   : Pointer to the (empty) magazine.
+**    Class : Index of the block size in CFE_SB_MemPoolDefSize.
+**
+**  Return:
+**    None
+*/
+static void CFE_SB_RefillBufMagazine(CFE_SB_BufMagazine_t *Mag, uint32 Class)
+{
+    uint32  Want;
+    int32   Stat;
+    CFE_SB_BufferD_t *bd;
+
+    Want = CFE_SB_BUF_CACHE_DEPTH / 2;
+    if(Want == 0){
+        Want = 1;
+    }/* end if */
+
+    while(Mag->Count < Want){
+        Stat = CFE_ES_GetPoolBuf((uint32 **)&bd, CFE_SB.Mem.PoolHdl,
+                                 CFE_SB_MemPoolDefSize[Class]);
+        if((Stat < 0) && (Mag->Count == 0) && (CFE_SB_ReclaimBufCaches() > 0)){
+            /* other tasks were holding the free buffers in their caches */
+            Stat = CFE_ES_GetPoolBuf((uint32 **)&bd, CFE_SB.Mem.PoolHdl,
+                                     CFE_SB_MemPoolDefSize[Class]);
+        }/* end if */
+        if(Stat < 0){
+            break;
+        }/* end if */
+        Mag->Buffers[Mag->Count] = bd;
+        Mag->Count++;
+    }/* end while */
+
+}/* end CFE_SB_RefillBufMagazine */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_DrainBufMagazine()
+**
+**  Purpose:
+**    Give the older half of a full magazine back to the SB memory pool.
+**
+**  Arguments:
+**    Mag   : Pointer to the magazine.
+**
+**  Return:
+**    None
+*/
+static void CFE_SB_DrainBufMagazine(CFE_SB_BufMagazine_t *Mag)
+{
+    uint32  Keep;
+    uint32  i;
+
+    Keep = CFE_SB_BUF_CACHE_DEPTH / 2;
+
+    for(i = Keep; i < Mag->Count; i++){
+        CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)Mag->Buffers[i]);
+    }/* end for */
+
+    Mag->Count = Keep;
+
+}/* end CFE_SB_DrainBufMagazine */
+
+#endif /* CFE_SB_BUF_CACHE_DEPTH > 0 */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_InitBufCache()
+**
+**  Purpose:
+**    Clear the per-task SB buffer caches and build the table that maps a
+**    buffer size to the SB memory pool block size that holds it.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_InitBufCache(void)
+{
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+    uint32  Size;
+    uint32  Class;
+    uint32  i;
+
+    CFE_PSP_MemSet(CFE_SB.Mem.Cache, 0, sizeof(CFE_SB.Mem.Cache));
+
+    for(Size = 0; Size <= CFE_SB_BUF_CACHE_MAX_BLOCK; Size++){
+
+        /* find the smallest block size that holds this many bytes */
+        Class = CFE_SB_BUF_CACHE_NONE;
+        for(i = 0; i < CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++){
+            if((CFE_SB_MemPoolDefSize[i] >= Size) &&
+               ((Class == CFE_SB_BUF_CACHE_NONE) ||
+                (CFE_SB_MemPoolDefSize[i] < CFE_SB_MemPoolDefSize[Class]))){
+                Class = i;
+            }/* end if */
+        }/* end for */
+
+        CFE_SB.Mem.CacheClass[Size] = (uint8)Class;
+
+    }/* end for */
+#endif
+
+}/* end CFE_SB_InitBufCache */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_ReleaseTaskBufCache()
+**
+**  Purpose:
+**    Give every buffer parked in a deleted task's cache back to the SB memory
+**    pool.  Called by ES once the task is gone (or by the task itself as it
+**    exits).  A new task may already have the deleted task's table index; if
+**    it is using the cache at that moment, the buffers stay with it.
+**
+**  Arguments:
+**    TaskId : OS task id of the deleted task
+**
+**  Return:
+**    None
+*/
+void CFE_SB_ReleaseTaskBufCache(uint32 TaskId)
+{
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+    uint32  TskIdx;
+
+    if((OS_ConvertToArrayIndex(TaskId, &TskIdx) != OS_SUCCESS) ||
+       (TskIdx >= OS_MAX_TASKS)){
+        return;
+    }/* end if */
+
+    CFE_SB_EmptyBufCache(&CFE_SB.Mem.Cache[TskIdx]);
+#endif
+
+}/* end CFE_SB_ReleaseTaskBufCache */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_CollectBufStats()
+**
+**  Purpose:
+**    Add the buffers taken and released through the per-task caches since
+**    the last call into the SB statistics packet.  Called by the SB task
+**    before it reports the buffer statistics.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_CollectBufStats(void)
+{
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+    uint32  i;
+    int32   Buffers;
+    int32   Mem;
+    int32   BuffersDelta = 0;
+    int32   MemDelta = 0;
+    uint32  InUse;
+    CFE_SB_BufCache_t *Cache;
+
+    for(i = 0; i < OS_MAX_TASKS; i++){
+
+        Cache = &CFE_SB.Mem.Cache[i];
+
+        /* the owning task may be updating these, take one sample of each */
+        Buffers = CFE_ATOMIC_LOAD(&Cache->BuffersInUse);
+        Mem     = CFE_ATOMIC_LOAD(&Cache->MemInUse);
+
+        BuffersDelta += Buffers - Cache->BuffersReported;
+        MemDelta     += Mem - Cache->MemReported;
+
+        Cache->BuffersReported = Buffers;
+        Cache->MemReported     = Mem;
+
+    }/* end for */
+
+    InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.SBBuffersInUse, (uint32)BuffersDelta);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse, InUse);
+
+    InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)MemDelta);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakMemInUse, InUse);
+#endif
+
+}/* end CFE_SB_CollectBufStats */
+
+
 /******************************************************************************
 **  Function:   CFE_SB_GetBufferFromPool()
 **
@@ -107,27 +457,66 @@
 
 CFE_SB_BufferD_t * CFE_SB_GetBufferFromPool(uint16 MsgId, uint16 Size) {
    int32                stat1;
+   uint32               InUse;
    uint8               *address = NULL;
    CFE_SB_BufferD_t    *bd = NULL;
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+   uint32               Class;
+   CFE_SB_BufCache_t   *Cache;
+   CFE_SB_BufMagazine_t *Mag;
+
+    /* Small buffers come from the calling task's cache when it has one */
+    Class = CFE_SB_GetBufCacheClass(Size + sizeof(CFE_SB_BufferD_t));
+    Cache = (Class != CFE_SB_BUF_CACHE_NONE) ? CFE_SB_GetTaskBufCache() : NULL;
+    if(Cache != NULL){
+
+        Mag = &Cache->Magazine[Class];
+        if(Mag->Count == 0){
+            CFE_SB_RefillBufMagazine(Mag, Class);
+            if(Mag->Count == 0){
+                CFE_SB_PutTaskBufCache(Cache);
+                return NULL;
+            }/* end if */
+        }/* end if */
+
+        Mag->Count--;
+        bd = Mag->Buffers[Mag->Count];
+
+        /* only this task updates its cache counters, the SB task */
+        /* adds them into the statistics in CFE_SB_CollectBufStats */
+        Cache->BuffersInUse++;
+        Cache->MemInUse += CFE_SB_MemPoolDefSize[Class];
+
+        CFE_SB_PutTaskBufCache(Cache);
+
+    }else{
+#endif
 
     /* Allocate a new buffer descriptor from the SB memory pool.*/
     stat1 = CFE_ES_GetPoolBuf((uint32 **)&bd, CFE_SB.Mem.PoolHdl,  Size + sizeof(CFE_SB_BufferD_t));
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+    if((stat1 < 0) && (CFE_SB_ReclaimBufCaches() > 0)){
+        /* other tasks were holding the free buffers in their caches */
+        stat1 = CFE_ES_GetPoolBuf((uint32 **)&bd, CFE_SB.Mem.PoolHdl,  Size + sizeof(CFE_SB_BufferD_t));
+    }/* end if */
+#endif
     if(stat1 < 0){
         return NULL;
     }
 
     /* increment the number of buffers in use and adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.SBBuffersInUse++;
-    if(CFE_SB.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse){
-        CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
-    }/* end if */
+    /* (atomically, senders may be running without the shared data mutex) */
+    InUse = CFE_ATOMIC_INC(&CFE_SB.StatTlmMsg.Payload.SBBuffersInUse);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse, InUse);
 
     /* Add the size of the actual buffer to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.MemInUse+=stat1;
-    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
-        CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
+    InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)stat1);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakMemInUse, InUse);
+
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
     }/* end if */
+#endif
 
     /* first set ptr to actual msg buffer the same as ptr to descriptor */
     address = (uint8 *)bd;
@@ -190,13 +579,39 @@ CFE_SB_BufferD_t * CFE_SB_GetBufferFromCaller(uint16 MsgId,
 */
 int32 CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd){
     int32    Stat;
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+    uint32               Class;
+    CFE_SB_BufCache_t   *Cache;
+    CFE_SB_BufMagazine_t *Mag;
+
+    /* Small buffers go to the calling task's cache when it has one */
+    Class = CFE_SB_GetBufCacheClass(bd->Size + sizeof(CFE_SB_BufferD_t));
+    Cache = (Class != CFE_SB_BUF_CACHE_NONE) ? CFE_SB_GetTaskBufCache() : NULL;
+    if(Cache != NULL){
+
+        Mag = &Cache->Magazine[Class];
+        if(Mag->Count == CFE_SB_BUF_CACHE_DEPTH){
+            CFE_SB_DrainBufMagazine(Mag);
+        }/* end if */
+
+        Mag->Buffers[Mag->Count] = bd;
+        Mag->Count++;
+
+        Cache->BuffersInUse--;
+        Cache->MemInUse -= CFE_SB_MemPoolDefSize[Class];
+
+        CFE_SB_PutTaskBufCache(Cache);
+
+        return CFE_SUCCESS;
+    }/* end if */
+#endif
 
     /* give the buf descriptor back to the buf descriptor pool */
     Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)bd);
     if(Stat > 0){
-        CFE_SB.StatTlmMsg.Payload.SBBuffersInUse--;
+        CFE_ATOMIC_DEC(&CFE_SB.StatTlmMsg.Payload.SBBuffersInUse);
         /* Substract the size of a buffer descriptor from the Memory in use ctr */
-        CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
+        CFE_ATOMIC_SUB(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)Stat);
     }/* end if */
 
     return CFE_SUCCESS;
@@ -215,7 +630,9 @@ int32 CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd){
 **
 **  Note:
 **    UseCount is a variable in the CFE_SB_BufferD_t and is used only to
-**    determine when a buffer may be returned to the memory pool.
+**    determine when a buffer may be returned to the memory pool.  It is
+**    updated atomically because senders and receivers may release their
+**    references concurrently.
 **
 **  Arguments:
 **    bd : Pointer to the buffer descriptor.
@@ -225,16 +642,23 @@ int32 CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd){
 */
 int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd){
 
-    /* range check the UseCount variable */
-    if(bd->UseCount > 0){
+    uint16  Count;
+
+    do{
 
-        bd->UseCount--;
+        Count = CFE_ATOMIC_LOAD(&bd->UseCount);
 
-        if (bd->UseCount == 0) {
-           CFE_SB_ReturnBufferToPool(bd);
+        /* range check the UseCount variable */
+        if(Count == 0){
+            return CFE_SUCCESS;
         }/* end if */
 
-    }
+    }while(!CFE_ATOMIC_CAS(&bd->UseCount,Count,(uint16)(Count - 1)));
+
+    /* the last reference was released */
+    if (Count == 1) {
+       CFE_SB_ReturnBufferToPool(bd);
+    }/* end if */
 
     return CFE_SUCCESS;
 
@@ -257,6 +681,7 @@ int32 CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd){
 CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 {
     int32 Stat;
+    uint32 InUse;
     CFE_SB_DestinationD_t *Dest = NULL;
 
     /* Allocate a new destination descriptor from the SB memory pool.*/
@@ -267,10 +692,8 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 
     /* Add the size of a destination descriptor to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB.StatTlmMsg.Payload.MemInUse+=Stat;
-    if(CFE_SB.StatTlmMsg.Payload.MemInUse > CFE_SB.StatTlmMsg.Payload.PeakMemInUse){
-       CFE_SB.StatTlmMsg.Payload.PeakMemInUse = CFE_SB.StatTlmMsg.Payload.MemInUse;
-    }/* end if */
+    InUse = CFE_ATOMIC_ADD(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)Stat);
+    CFE_ATOMIC_RAISE_PEAK(&CFE_SB.StatTlmMsg.Payload.PeakMemInUse, InUse);
 
     return Dest;
 
@@ -301,7 +724,7 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
     Stat = CFE_ES_PutPoolBuf(CFE_SB.Mem.PoolHdl, (uint32 *)Dest);
     if(Stat > 0){
         /* Substract the size of the destination block from the Memory in use ctr */
-        CFE_SB.StatTlmMsg.Payload.MemInUse-=Stat;
+        CFE_ATOMIC_SUB(&CFE_SB.StatTlmMsg.Payload.MemInUse, (uint32)Stat);
     }/* end if */
 
     return CFE_SUCCESS;
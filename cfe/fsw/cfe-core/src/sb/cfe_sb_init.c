@@ -117,7 +117,8 @@ uint32 CFE_SB_MemPoolDefSize[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES] =
 */
 int32 CFE_SB_EarlyInit (void) {
 
-    int32 Stat = CFE_SUCCESS;
+    int32  Stat = CFE_SUCCESS;
+    uint32 i;
 
     CFE_SB_Default_Qos.Priority    = CFE_SB_QOS_LOW_PRIORITY;
     CFE_SB_Default_Qos.Reliability = CFE_SB_QOS_LOW_RELIABILITY;
@@ -127,6 +128,14 @@ int32 CFE_SB_EarlyInit (void) {
       CFE_ES_WriteToSysLog("SB shared data mutex creation failed! RC=0x%08x\n",(unsigned int)Stat);
       return Stat;
     }/* end if */
+
+#if (CFE_SB_LOCKLESS_SEND == TRUE)
+    Stat = OS_MutSemCreate(&CFE_SB.SenderSyncMutexId, "CFE_SB_SyncMutex", 0);
+    if(Stat != OS_SUCCESS){
+      CFE_ES_WriteToSysLog("SB sender sync mutex creation failed! RC=0x%08x\n",(unsigned int)Stat);
+      return Stat;
+    }/* end if */
+#endif
     
     /* Initialize the state of susbcription reporting */
     CFE_SB.SubscriptionReporting = CFE_SB_DISABLE;
@@ -134,6 +143,16 @@ int32 CFE_SB_EarlyInit (void) {
     /* Initialize the state of sender reporting */
     CFE_SB.SenderReporting = CFE_SB_DEFAULT_REPORT_SENDER;
 
+    /* No senders are active yet */
+    CFE_SB.SendEpoch = 0;
+    CFE_SB.SendersActive[0] = 0;
+    CFE_SB.SendersActive[1] = 0;
+
+    /* No sender identities are cached yet */
+    for(i=0;i<OS_MAX_TASKS;i++){
+      CFE_SB.SenderCache[i].Valid = FALSE;
+    }/* end for */
+
      /* Initialize memory partition. */
     Stat = CFE_SB_InitBuffers();
     if(Stat != CFE_SUCCESS){
@@ -175,6 +194,9 @@ int32 CFE_SB_EarlyInit (void) {
 **  Notes:
 **    This function MUST be called before any SB API's are called.
 **
+**    When CFE_SB_LOCKLESS_SEND is TRUE, buffers are allocated and released
+**    without the SB shared data mutex, so the pool is created with its own.
+**
 **  Return:
 **    none
 */
@@ -187,13 +209,19 @@ int32  CFE_SB_InitBuffers(void) {
                                 CFE_SB_BUF_MEMORY_BYTES, 
                                 CFE_ES_MAX_MEMPOOL_BLOCK_SIZES, 
                                 &CFE_SB_MemPoolDefSize[0],
+#if (CFE_SB_LOCKLESS_SEND == TRUE)
+                                CFE_ES_USE_MUTEX);
+#else
                                 CFE_ES_NO_MUTEX);
+#endif
     
     if(Stat != CFE_SUCCESS){
         CFE_ES_WriteToSysLog("PoolCreate failed for SB Buffers, gave adr 0x%lx,size %d,stat=0x%x\n",
               (unsigned long)CFE_SB.Mem.Partition,CFE_SB_BUF_MEMORY_BYTES,(unsigned int)Stat);
         return Stat;
     }
+
+    CFE_SB_InitBufCache();
     
     return CFE_SUCCESS;
     
@@ -223,6 +251,7 @@ void CFE_SB_InitPipeTbl(void){
         CFE_SB.PipeTbl[i].SysQueueId    = CFE_SB_UNUSED_QUEUE;
         CFE_SB.PipeTbl[i].PipeId        = CFE_SB_INVALID_PIPE;
         CFE_SB.PipeTbl[i].CurrentBuff   = NULL;
+        CFE_SB.PipeTbl[i].RcvBatchCount = 0;
         CFE_PSP_MemSet(&CFE_SB.PipeTbl[i].PipeName[0],0,OS_MAX_API_NAME);
     }/* end for */
 
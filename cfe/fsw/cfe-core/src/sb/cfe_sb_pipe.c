@@ -0,0 +1,335 @@
+/******************************************************************************
+** File: cfe_sb_pipe.c
+**
+**      Copyright (c) 2004-2012, United States government as represented by the
+**      administrator of the National Aeronautics Space Administration.
+**      All rights reserved. This software(cFE) was created at NASA's Goddard
+**      Space Flight Center pursuant to government contracts.
+**
+**      This is governed by the NASA Open Source Agreement and may be used,
+**      distributed and modified only pursuant to the terms of that agreement.
+**
+**
+**
+** Purpose:
+**      This file contains the source code for the queues that carry buffer
+**      descriptors to SB pipes.  A pipe queue is either an OS queue or, when
+**      CFE_SB_RING_PIPES is TRUE, an SB ring with a binary semaphore that the
+**      reader blocks on when the ring is empty.
+**
+**      The functions in this file return OSAL status codes so that callers
+**      handle both kinds of queue the same way.
+**
+******************************************************************************/
+
+/*
+**  Include Files
+*/
+
+#include "cfe_sb_priv.h"
+#include "osapi.h"
+#include "cfe_error.h"
+
+#if (CFE_SB_RING_PIPES == TRUE)
+
+/******************************************************************************
+**  Function:   CFE_SB_TakeFromRing()
+**
+**  Purpose:
+**    Take the oldest buffer descriptor from a pipe ring.
+**
+**  Arguments:
+**    Ring    : Pointer to the ring of the pipe.
+**    Message : Pointer to a variable that will receive the buffer descriptor.
+**
+**  Return:
+**    TRUE if a descriptor was taken, FALSE if the next slot has not been
+**    written yet.
+**
+**  Notes:
+**    Only the task receiving from the pipe may call this function.  The slot
+**    is given back to the writers before the count is lowered, so a writer
+**    that reserved room in CFE_SB_PutPipeQueue always finds a free slot.
+*/
+static boolean CFE_SB_TakeFromRing(CFE_SB_PipeRing_t *Ring, CFE_SB_BufferD_t **Message)
+{
+    uint32             Pos = Ring->Head;
+    CFE_SB_RingSlot_t *Slot = &Ring->Slot[Pos & CFE_SB_RING_MASK];
+
+    if(CFE_ATOMIC_LOAD(&Slot->Seq) != (Pos + 1)){
+        return FALSE;
+    }/* end if */
+
+    *Message = Slot->BufDscPtr;
+    Slot->BufDscPtr = NULL;
+
+    /* hand the slot to the writer that will use it on the next lap */
+    CFE_ATOMIC_BARRIER();
+    Slot->Seq = Pos + CFE_SB_MAX_PIPE_DEPTH;
+    Ring->Head = Pos + 1;
+
+    CFE_ATOMIC_DEC(&Ring->Count);
+
+    return TRUE;
+
+}/* end CFE_SB_TakeFromRing */
+
+#endif
+
+
+/******************************************************************************
+**  Function:   CFE_SB_CreatePipeQueue()
+**
+**  Purpose:
+**    Create the queue of a new pipe.
+**
+**  Arguments:
+**    PipeTblIdx : Index of the pipe in the pipe table.
+**    PipeName   : Name of the pipe, used for the OS object.
+**    Depth      : Number of messages the pipe can hold.
+**    SysQueueId : Pointer to a variable that will receive the id of the OS
+**                 queue (or, for a ring, of the OS semaphore) of the pipe.
+**
+**  Return:
+**    OS_SUCCESS or the OSAL error from creating the OS object.
+*/
+int32 CFE_SB_CreatePipeQueue(CFE_SB_PipeId_t PipeTblIdx, const char *PipeName,
+                             uint16 Depth, uint32 *SysQueueId)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+
+    CFE_SB_PipeRing_t *Ring = &CFE_SB.PipeRing[PipeTblIdx];
+    uint32             SemId = 0;
+    uint32             i;
+    int32              Status;
+
+    Status = OS_BinSemCreate(&SemId, PipeName, 0, 0);
+    if(Status != OS_SUCCESS){
+        return Status;
+    }/* end if */
+
+    /* nobody can write to the pipe until it is in the pipe table */
+    Ring->Tail = 0;
+    Ring->Head = 0;
+    Ring->Count = 0;
+    Ring->ReaderWaiting = FALSE;
+    Ring->Depth = Depth;
+    Ring->SemId = SemId;
+    for(i = 0; i < CFE_SB_MAX_PIPE_DEPTH; i++){
+        Ring->Slot[i].Seq = i;
+        Ring->Slot[i].BufDscPtr = NULL;
+    }/* end for */
+
+    *SysQueueId = SemId;
+
+    return OS_SUCCESS;
+
+#else
+
+    return OS_QueueCreate(SysQueueId,PipeName,Depth,sizeof(CFE_SB_BufferD_t *),0);
+
+#endif
+}/* end CFE_SB_CreatePipeQueue */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_DeletePipeQueue()
+**
+**  Purpose:
+**    Delete the queue of a pipe.  Any messages left on the pipe must have been
+**    read first.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor.
+**
+**  Return:
+**    Status of the OSAL delete call.
+*/
+int32 CFE_SB_DeletePipeQueue(CFE_SB_PipeD_t *PipeDscPtr)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+
+    return OS_BinSemDelete(CFE_SB.PipeRing[PipeDscPtr->PipeId].SemId);
+
+#else
+
+    return OS_QueueDelete(PipeDscPtr->SysQueueId);
+
+#endif
+}/* end CFE_SB_DeletePipeQueue */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_PutPipeQueue()
+**
+**  Purpose:
+**    Write a buffer descriptor to the queue of a pipe.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor.
+**    BufDscPtr  : Buffer descriptor to write.
+**
+**  Return:
+**    OS_SUCCESS, OS_QUEUE_FULL if the pipe already holds as many messages as
+**    its depth, or another OSAL error from writing the OS queue.
+**
+**  Notes:
+**    Any number of tasks may write to a ring at once.  A writer first reserves
+**    room within the pipe depth, then claims the slot at the tail and marks it
+**    written.  The reader is only woken (which may take a system call) when it
+**    is blocked on the pipe.
+*/
+int32 CFE_SB_PutPipeQueue(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+
+    CFE_SB_PipeRing_t *Ring = &CFE_SB.PipeRing[PipeDscPtr->PipeId];
+    CFE_SB_RingSlot_t *Slot;
+    uint32             Count;
+    uint32             Pos;
+
+    /* reserve room on the pipe */
+    do{
+        Count = CFE_ATOMIC_LOAD(&Ring->Count);
+        if(Count >= Ring->Depth){
+            return OS_QUEUE_FULL;
+        }/* end if */
+    }while(!CFE_ATOMIC_CAS(&Ring->Count, Count, Count + 1));
+
+    /* claim the slot at the tail, the reservation guarantees it comes free */
+    Pos = CFE_ATOMIC_LOAD(&Ring->Tail);
+    for(;;){
+        Slot = &Ring->Slot[Pos & CFE_SB_RING_MASK];
+        if((CFE_ATOMIC_LOAD(&Slot->Seq) == Pos) &&
+           (CFE_ATOMIC_CAS(&Ring->Tail, Pos, Pos + 1))){
+            break;
+        }/* end if */
+        Pos = CFE_ATOMIC_LOAD(&Ring->Tail);
+    }/* end for */
+
+    Slot->BufDscPtr = BufDscPtr;
+    CFE_ATOMIC_BARRIER();
+    Slot->Seq = Pos + 1;
+
+    /*
+    ** The reader sets ReaderWaiting before it checks the ring a last time,
+    ** so either it sees this entry or this writer sees the flag.
+    */
+    CFE_ATOMIC_BARRIER();
+    if((CFE_ATOMIC_LOAD(&Ring->ReaderWaiting) == TRUE) &&
+       (CFE_ATOMIC_CAS(&Ring->ReaderWaiting, TRUE, FALSE))){
+        OS_BinSemGive(Ring->SemId);
+    }/* end if */
+
+    return OS_SUCCESS;
+
+#else
+
+    return OS_QueuePut(PipeDscPtr->SysQueueId,(void *)&BufDscPtr,
+                       sizeof(CFE_SB_BufferD_t *),0);
+
+#endif
+}/* end CFE_SB_PutPipeQueue */
+
+
+/******************************************************************************
+**  Function:   CFE_SB_GetPipeQueue()
+**
+**  Purpose:
+**    Read the oldest buffer descriptor from the queue of a pipe.
+**
+**  Arguments:
+**    PipeDscPtr : Pointer to the pipe descriptor.
+**    Message    : Pointer to a variable that will receive the buffer
+**                 descriptor.
+**    TimeOut    : OS_PEND, OS_CHECK or a timeout in milliseconds.
+**
+**  Return:
+**    OS_SUCCESS, OS_QUEUE_EMPTY (OS_CHECK only), OS_QUEUE_TIMEOUT or another
+**    OSAL error from reading the OS queue or taking the semaphore.
+**
+**  Notes:
+**    Only the task receiving from the pipe may call this function.  A give
+**    meant for an earlier wait can wake the reader with the ring still empty;
+**    the reader then waits again, for what is left of the timeout.
+*/
+int32 CFE_SB_GetPipeQueue(CFE_SB_PipeD_t *PipeDscPtr, CFE_SB_BufferD_t **Message,
+                          int32 TimeOut)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+
+    CFE_SB_PipeRing_t *Ring = &CFE_SB.PipeRing[PipeDscPtr->PipeId];
+    int32              Status;
+    uint32             Remaining = 0;
+    uint32             Elapsed;
+    OS_time_t          Start;
+    OS_time_t          Now;
+
+    if(CFE_SB_TakeFromRing(Ring, Message) == TRUE){
+        return OS_SUCCESS;
+    }/* end if */
+
+    if(TimeOut == OS_CHECK){
+        return OS_QUEUE_EMPTY;
+    }/* end if */
+
+    if(TimeOut != OS_PEND){
+        Remaining = (uint32)TimeOut;
+        CFE_PSP_GetTime(&Start);
+    }/* end if */
+
+    for(;;){
+
+        Ring->ReaderWaiting = TRUE;
+        CFE_ATOMIC_BARRIER();
+
+        if(CFE_SB_TakeFromRing(Ring, Message) == TRUE){
+            Ring->ReaderWaiting = FALSE;
+            return OS_SUCCESS;
+        }/* end if */
+
+        if(TimeOut == OS_PEND){
+            Status = OS_BinSemTake(Ring->SemId);
+        }else{
+            Status = OS_BinSemTimedWait(Ring->SemId, Remaining);
+        }/* end if */
+
+        Ring->ReaderWaiting = FALSE;
+        CFE_ATOMIC_BARRIER();
+
+        if(CFE_SB_TakeFromRing(Ring, Message) == TRUE){
+            return OS_SUCCESS;
+        }/* end if */
+
+        if(Status == OS_SEM_TIMEOUT){
+            return OS_QUEUE_TIMEOUT;
+        }else if(Status != OS_SUCCESS){
+            return Status;
+        }/* end if */
+
+        /* woken with nothing to read, only wait out the rest of the timeout */
+        if(TimeOut != OS_PEND){
+            CFE_PSP_GetTime(&Now);
+            Elapsed = CFE_ES_ElapsedMsec(&Start, &Now);
+            if(Elapsed >= (uint32)TimeOut){
+                return OS_QUEUE_TIMEOUT;
+            }/* end if */
+            Remaining = (uint32)TimeOut - Elapsed;
+        }/* end if */
+
+    }/* end for */
+
+#else
+
+    uint32  Nbytes;
+
+    return OS_QueueGet(PipeDscPtr->SysQueueId,
+                       (void *)Message,
+                       sizeof(CFE_SB_BufferD_t *),
+                       &Nbytes,
+                       TimeOut);
+
+#endif
+}/* end CFE_SB_GetPipeQueue */
+
+/*****************************************************************************/
@@ -126,6 +126,32 @@ int32 CFE_SB_CleanUpApp(uint32 AppId){
 }/* end CFE_SB_CleanUpApp */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_InvalidateSenderCache()
+**
+**  Purpose:
+**    Called by ES when a task is created or deleted so that the next message
+**    sent from the task's slot looks up the sender identity again.
+**
+**  Arguments:
+**    TaskId - OS task id of the created or deleted task
+**
+**  Return:
+**    None
+*/
+void CFE_SB_InvalidateSenderCache(uint32 TaskId){
+
+  uint32 TskIdx;
+
+  if((OS_ConvertToArrayIndex(TaskId, &TskIdx) == OS_SUCCESS) &&
+     (TskIdx < OS_MAX_TASKS)){
+    CFE_SB.SenderCache[TskIdx].Valid = FALSE;
+    CFE_ATOMIC_BARRIER();
+  }/* end if */
+
+}/* end CFE_SB_InvalidateSenderCache */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_GetAvailPipeIdx()
 **
@@ -292,6 +318,134 @@ void CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber){
 }/* end CFE_SB_UnlockSharedData */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_EnterSendSection()
+**
+**  Purpose:
+**    SB internal function called at the start of a message send, before the
+**    routing table is read.  If CFE_SB_LOCKLESS_SEND is TRUE, the caller is
+**    registered as an active sender in the current send epoch and does not
+**    take the Shared Data Mutex.  Otherwise the Shared Data Mutex is taken.
+**
+**  Note:
+**    While registered, the caller must not take the Shared Data Mutex or
+**    block on anything a subscribe/unsubscribe caller may hold.
+**
+**  Arguments:
+**    FuncName   - the function name containing the code that generated the error.
+**    LineNumber - the line number in the file of the code that generated the error.
+**
+**  Return:
+**    The epoch to be given to CFE_SB_ExitSendSection
+*/
+uint32 CFE_SB_EnterSendSection(const char *FuncName, int32 LineNumber){
+
+#if (CFE_SB_LOCKLESS_SEND == TRUE)
+
+    uint32  Epoch;
+
+    for(;;){
+
+        Epoch = CFE_ATOMIC_LOAD(&CFE_SB.SendEpoch) & 1;
+        CFE_ATOMIC_INC(&CFE_SB.SendersActive[Epoch]);
+
+        /* if a writer flipped the epoch before the increment landed, it may */
+        /* not have seen it, so move to the new epoch and try again          */
+        if(Epoch == (CFE_ATOMIC_LOAD(&CFE_SB.SendEpoch) & 1)){
+            break;
+        }/* end if */
+
+        CFE_ATOMIC_DEC(&CFE_SB.SendersActive[Epoch]);
+
+    }/* end for */
+
+    return Epoch;
+
+#else
+
+    CFE_SB_LockSharedData(FuncName,LineNumber);
+
+    return 0;
+
+#endif
+
+}/* end CFE_SB_EnterSendSection */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ExitSendSection()
+**
+**  Purpose:
+**    SB internal function called at the end of a message send, after the
+**    last access to the routing table.
+**
+**  Arguments:
+**    Epoch      - the value returned by CFE_SB_EnterSendSection
+**    FuncName   - the function name containing the code that generated the error.
+**    LineNumber - the line number in the file of the code that generated the error.
+**
+**  Return:
+**    None
+*/
+void CFE_SB_ExitSendSection(uint32 Epoch, const char *FuncName, int32 LineNumber){
+
+#if (CFE_SB_LOCKLESS_SEND == TRUE)
+
+    CFE_ATOMIC_DEC(&CFE_SB.SendersActive[Epoch]);
+
+#else
+
+    CFE_SB_UnlockSharedData(FuncName,LineNumber);
+
+#endif
+
+}/* end CFE_SB_ExitSendSection */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_SynchronizeSenders()
+**
+**  Purpose:
+**    SB internal function used by routing table writers, after a destination
+**    has been unlinked or a message map entry has been cleared, to wait until
+**    every send that may still reference the old entry has completed.  On
+**    return the destination block may be recycled.
+**
+**  Note:
+**    Must be called without the Shared Data Mutex held, so that other SB
+**    calls are not held up while it waits, and never from inside a send
+**    section.  The entry must already have been unlinked under the mutex.
+**
+**  Arguments:
+**    None
+**
+**  Return:
+**    None
+*/
+void CFE_SB_SynchronizeSenders(void){
+
+#if (CFE_SB_LOCKLESS_SEND == TRUE)
+
+    uint32  OldEpoch;
+
+    /* a second caller flipping the epoch back would stop waiting for */
+    /* senders that registered before its entry was unlinked          */
+    OS_MutSemTake(CFE_SB.SenderSyncMutexId);
+
+    /* new senders register in the other epoch from this point on */
+    OldEpoch = (CFE_ATOMIC_INC(&CFE_SB.SendEpoch) - 1) & 1;
+
+    while(CFE_ATOMIC_LOAD(&CFE_SB.SendersActive[OldEpoch]) != 0){
+        OS_TaskDelay(CFE_SB_SENDER_SYNC_DLY);
+    }/* end while */
+
+    OS_MutSemGive(CFE_SB.SenderSyncMutexId);
+
+#endif
+
+}/* end CFE_SB_SynchronizeSenders */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_GetPipePtr()
 **
@@ -634,6 +788,61 @@ char *CFE_SB_GetAppTskName(uint32 TaskId,char *FullName){
 }/* end CFE_SB_GetAppTskName */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_GetTaskSenderId()
+**
+**  Purpose:
+**    This function returns the sender identity that SB stores with each
+**    message sent by the given task.
+**
+**  Arguments:
+**    TaskId - the task id of the calling task
+**    Uncached - sender id to fill in if the task's identity cannot be cached
+**
+**  Return:
+**    Pointer to the task's cached sender id, or to Uncached
+**
+**  Note: Only the task itself may call this function with its TaskId, it is
+**        the only writer of its cache entry.  An identity is not cached until
+**        ES knows the task, otherwise the "Unknown" name would be kept.
+*/
+CFE_SB_SenderId_t *CFE_SB_GetTaskSenderId(uint32 TaskId, CFE_SB_SenderId_t *Uncached){
+
+    CFE_ES_TaskInfo_t     TaskInfo;
+    CFE_SB_SenderCache_t  *Entry = NULL;
+    CFE_SB_SenderId_t     *Sender = Uncached;
+    uint32                TskIdx;
+    char                  FullName[(OS_MAX_API_NAME * 2)];
+
+    if((OS_ConvertToArrayIndex(TaskId, &TskIdx) == OS_SUCCESS) &&
+       (TskIdx < OS_MAX_TASKS)){
+
+      Entry = &CFE_SB.SenderCache[TskIdx];
+      if(CFE_ATOMIC_LOAD(&Entry->Valid) == TRUE){
+        return &Entry->Sender;
+      }/* end if */
+
+      if(CFE_ES_GetTaskInfo(&TaskInfo, TaskId) == CFE_SUCCESS){
+        Sender = &Entry->Sender;
+      }else{
+        Entry = NULL;
+      }/* end if */
+
+    }/* end if */
+
+    Sender->ProcessorId = CFE_PSP_GetProcessorId();
+    strncpy(&Sender->AppName[0],CFE_SB_GetAppTskName(TaskId,FullName),OS_MAX_API_NAME);
+
+    if(Entry != NULL){
+      CFE_ATOMIC_BARRIER();
+      Entry->Valid = TRUE;
+    }/* end if */
+
+    return Sender;
+
+}/* end CFE_SB_GetTaskSenderId */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_GetPktType()
 **
@@ -738,6 +947,9 @@ int32 CFE_SB_AddDest(uint16 RtgTblIdx, CFE_SB_DestinationD_t *NewNode){
         NewNode->Next = NULL;
         NewNode->Prev = NULL;
 
+        /* the node must be complete before senders can reach it */
+        CFE_ATOMIC_BARRIER();
+
         /* insert the new node */
         CFE_SB.RoutingTbl[RtgTblIdx].ListHeadPtr = NewNode;
 
@@ -749,6 +961,9 @@ int32 CFE_SB_AddDest(uint16 RtgTblIdx, CFE_SB_DestinationD_t *NewNode){
         NewNode->Next = WBS;
         NewNode->Prev = NULL;
 
+        /* the node must be complete before senders can reach it */
+        CFE_ATOMIC_BARRIER();
+
         /* insert the new node */
         WBS -> Prev = NewNode;
         CFE_SB.RoutingTbl[RtgTblIdx].ListHeadPtr = NewNode;
@@ -812,16 +1027,83 @@ int32 CFE_SB_RemoveDest(uint16 RtgTblIdx, CFE_SB_DestinationD_t *NodeToRemove){
 
     }/* end if */
 
-
-    /* initialize the node before returning it to the heap */
-    NodeToRemove -> Next = NULL;
-    NodeToRemove -> Prev = NULL;
+    /*
+    ** The links of the removed node are left intact so that a sender that is
+    ** still walking the list can step past it.  The caller must clear them
+    ** after CFE_SB_SynchronizeSenders and before returning the node to the heap.
+    */
 
     return CFE_SUCCESS;
 
 }/* CFE_SB_RemoveDest */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_ReserveDestSlot()
+**
+**  Purpose:
+**      This function will increment the buffer count of the given destination
+**      if it is below the destination's message limit.  The check and the
+**      increment are done as one atomic operation so that concurrent senders
+**      cannot exceed the limit.
+**
+**  Arguments:
+**      Dest - Pointer to the destination block
+**
+**  Return:
+**      CFE_SB_GRANTED if the count was incremented, CFE_SB_DENIED if the
+**      message limit has been reached.
+*/
+uint32 CFE_SB_ReserveDestSlot(CFE_SB_DestinationD_t *Dest){
+
+    uint16  Count;
+
+    do{
+
+        Count = CFE_ATOMIC_LOAD(&Dest->BuffCount);
+        if(Count >= Dest->MsgId2PipeLim){
+            return CFE_SB_DENIED;
+        }/* end if */
+
+    }while(!CFE_ATOMIC_CAS(&Dest->BuffCount,Count,(uint16)(Count + 1)));
+
+    return CFE_SB_GRANTED;
+
+}/* end CFE_SB_ReserveDestSlot */
+
+
+/******************************************************************************
+**  Function:  CFE_SB_ReleaseDestSlot()
+**
+**  Purpose:
+**      This function will decrement the buffer count of the given destination
+**      when a message for it is taken off its pipe.  The count is never taken
+**      below zero, it may already be zero if the message was unsubscribed to
+**      and then resubscribed to while the buffer was on the pipe.
+**
+**  Arguments:
+**      Dest - Pointer to the destination block
+**
+**  Return:
+**      None
+*/
+void CFE_SB_ReleaseDestSlot(CFE_SB_DestinationD_t *Dest){
+
+    uint16  Count;
+
+    /* senders may be updating the count without the mutex */
+    do{
+
+        Count = CFE_ATOMIC_LOAD(&Dest->BuffCount);
+        if(Count == 0){
+            return;
+        }/* end if */
+
+    }while(!CFE_ATOMIC_CAS(&Dest->BuffCount,Count,(uint16)(Count - 1)));
+
+}/* end CFE_SB_ReleaseDestSlot */
+
+
 /******************************************************************************
 ** Name:    CFE_SB_ZeroCopyReleaseAppId
 **
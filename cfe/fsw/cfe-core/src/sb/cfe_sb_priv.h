@@ -87,6 +87,7 @@
 */
 #include "common_types.h"
 #include "private/cfe_private.h"
+#include "private/cfe_atomic.h"
 #include "cfe_sb.h"
 #include "cfe_sb_msg.h"
 #include "cfe_time.h"
@@ -133,6 +134,9 @@
 #define CFE_SB_INCREMENT_TLM            1
 
 #define CFE_SB_MAIN_LOOP_ERR_DLY        1000
+#define CFE_SB_SENDER_SYNC_DLY          1
+#define CFE_SB_BUF_CACHE_NONE           0xFF
+#define CFE_SB_RING_MASK                (CFE_SB_MAX_PIPE_DEPTH - 1)
 #define CFE_SB_CMD_PIPE_DEPTH           32
 #define CFE_SB_CMD_PIPE_NAME            "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER     8
@@ -256,10 +260,103 @@ typedef struct {
      uint16             SendErrors;
      CFE_SB_BufferD_t  *CurrentBuff;
      CFE_SB_BufferD_t  *ToTrashBuff;
+     uint32             RcvBatchCount;
+     CFE_SB_BufferD_t  *RcvBatchBuff[CFE_SB_MAX_RCV_BATCH];
 } CFE_SB_PipeD_t;
 
 
 
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BufMagazine_t
+**
+**  Purpose:
+**     This structure holds the buffers a task has cached for one SB memory
+**     pool block size.
+*/
+typedef struct {
+     uint32             Count;
+     CFE_SB_BufferD_t  *Buffers[CFE_SB_BUF_CACHE_DEPTH];
+} CFE_SB_BufMagazine_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BufCache_t
+**
+**  Purpose:
+**     This structure defines the SB buffer cache of one task.  Its magazines
+**     are only modified while Busy is held: by the task that owns it, or when
+**     its buffers are given back to the SB memory pool after the task is
+**     deleted or the pool runs out.  BuffersInUse and MemInUse count the
+**     buffers (and bytes) the task has taken through the cache less those it
+**     has released; the SB task adds them into the statistics packet.
+*/
+typedef struct {
+     volatile uint32       Busy;
+     int32                 BuffersInUse;
+     int32                 MemInUse;
+     int32                 BuffersReported;
+     int32                 MemReported;
+     CFE_SB_BufMagazine_t  Magazine[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
+} CFE_SB_BufCache_t;
+
+#endif
+
+
+#if (CFE_SB_RING_PIPES == TRUE)
+
+/******************************************************************************
+**  Typedef:  CFE_SB_RingSlot_t
+**
+**  Purpose:
+**     This structure defines one entry of a pipe ring.  Seq tells writers and
+**     the reader whose turn it is to use the slot.
+*/
+typedef struct {
+     volatile uint32    Seq;
+     CFE_SB_BufferD_t  *BufDscPtr;
+} CFE_SB_RingSlot_t;
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_PipeRing_t
+**
+**  Purpose:
+**     This structure defines the ring that carries the buffer descriptors of a
+**     pipe when CFE_SB_RING_PIPES is TRUE.  Writers claim slots at Tail; only
+**     the task that receives from the pipe moves Head.  Count holds the
+**     entries written or being written, and is limited to the pipe depth.
+**     ReaderWaiting is set while the reader is about to block on SemId.
+*/
+typedef struct {
+     volatile uint32    Tail;
+     volatile uint32    Head;
+     volatile uint32    Count;
+     volatile uint32    ReaderWaiting;
+     uint32             Depth;
+     uint32             SemId;
+     CFE_SB_RingSlot_t  Slot[CFE_SB_MAX_PIPE_DEPTH];
+} CFE_SB_PipeRing_t;
+
+#endif
+
+
+/******************************************************************************
+**  Typedef:  CFE_SB_SenderCache_t
+**
+**  Purpose:
+**     This structure holds the sender identity of one task, so that it is
+**     only looked up and formatted on the first send after ES creates or
+**     deletes a task in this slot.  Only the task itself fills in the entry;
+**     ES clears Valid through CFE_SB_InvalidateSenderCache.
+*/
+typedef struct {
+     volatile uint32    Valid;
+     CFE_SB_SenderId_t  Sender;
+} CFE_SB_SenderCache_t;
+
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
@@ -270,6 +367,10 @@ typedef struct {
 
    CFE_ES_MemHandle_t PoolHdl;
    uint8              Partition[CFE_SB_BUF_MEMORY_BYTES];
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+   uint8              CacheClass[CFE_SB_BUF_CACHE_MAX_BLOCK + 1];
+   CFE_SB_BufCache_t  Cache[OS_MAX_TASKS];
+#endif
 
 } CFE_SB_MemParams_t;
 
@@ -279,15 +380,27 @@ typedef struct {
 **
 **  Purpose:
 **     This structure contains the SB global variables.
+**
+**     SendEpoch and SendersActive track the senders currently reading the
+**     routing table without the shared data mutex (see CFE_SB_LOCKLESS_SEND).
+**     SenderSyncMutexId lets one CFE_SB_SynchronizeSenders caller at a time
+**     flip the epoch.
 */
 typedef struct {
     uint32              SharedDataMutexId;
+    uint32              SenderSyncMutexId;
+    volatile uint32     SendEpoch;
+    volatile uint32     SendersActive[2];
     uint32              SubscriptionReporting;
     uint32              SenderReporting;
+    CFE_SB_SenderCache_t SenderCache[OS_MAX_TASKS];
     uint32              AppId;
     uint32              StopRecurseFlags[CFE_ES_MAX_APPLICATIONS];
     void               *ZeroCopyTail;
     CFE_SB_PipeD_t      PipeTbl[CFE_SB_MAX_PIPES];
+#if (CFE_SB_RING_PIPES == TRUE)
+    CFE_SB_PipeRing_t   PipeRing[CFE_SB_MAX_PIPES];
+#endif
     CFE_SB_HKMsg_t      HKTlmMsg;
     CFE_SB_StatMsg_t    StatTlmMsg;
     CFE_SB_PipeId_t     CmdPipe;
@@ -339,11 +452,21 @@ void   CFE_SB_ResetCounts(void);
 uint16 CFE_SB_GetAvailRoutingIdx(void);
 void   CFE_SB_LockSharedData(const char *FuncName, int32 LineNumber);
 void   CFE_SB_UnlockSharedData(const char *FuncName, int32 LineNumber);
+uint32 CFE_SB_EnterSendSection(const char *FuncName, int32 LineNumber);
+void   CFE_SB_ExitSendSection(uint32 Epoch, const char *FuncName, int32 LineNumber);
+void   CFE_SB_SynchronizeSenders(void);
 void   CFE_SB_ReleaseBuffer (CFE_SB_BufferD_t *bd, CFE_SB_DestinationD_t *dest);
+void   CFE_SB_InitBufCache(void);
+void   CFE_SB_CollectBufStats(void);
 int32  CFE_SB_ReadQueue(CFE_SB_PipeD_t *pd,uint32 TskId,
                         CFE_SB_TimeOut_t time_out,CFE_SB_BufferD_t **message );
 int32  CFE_SB_WriteQueue(CFE_SB_PipeD_t *pd,uint32 TskId,
                          const CFE_SB_BufferD_t *bd,CFE_SB_MsgId_t MsgId );
+int32  CFE_SB_CreatePipeQueue(CFE_SB_PipeId_t PipeTblIdx, const char *PipeName,
+                              uint16 Depth, uint32 *SysQueueId);
+int32  CFE_SB_DeletePipeQueue(CFE_SB_PipeD_t *pd);
+int32  CFE_SB_PutPipeQueue(CFE_SB_PipeD_t *pd, CFE_SB_BufferD_t *bd);
+int32  CFE_SB_GetPipeQueue(CFE_SB_PipeD_t *pd, CFE_SB_BufferD_t **message, int32 TimeOut);
 CFE_SB_MsgId_t CFE_SB_GetRoutingTblIdx(CFE_SB_MsgId_t MsgId);
 uint8  CFE_SB_GetPipeIdx(CFE_SB_PipeId_t PipeId);
 int32  CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
@@ -358,6 +481,7 @@ void   CFE_SB_SendStats(void);
 void   CFE_SB_EnableRoute(CFE_SB_MsgPayloadPtr_t Payload);
 void   CFE_SB_DisableRoute(CFE_SB_MsgPayloadPtr_t Payload);
 char   *CFE_SB_GetAppTskName(uint32 TaskId, char* FullName);
+CFE_SB_SenderId_t *CFE_SB_GetTaskSenderId(uint32 TaskId, CFE_SB_SenderId_t *Uncached);
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(CFE_SB_MsgId_t MsgId, uint16 size);
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromCaller(CFE_SB_MsgId_t MsgId, void *Address);
 CFE_SB_PipeD_t   *CFE_SB_GetPipePtr(CFE_SB_PipeId_t PipeId);
@@ -377,6 +501,13 @@ int32 CFE_SB_UnsubscribeWithAppId(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
 int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
                               uint8 Scope, uint32 AppId);
 int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t   *MsgPtr, uint32 TlmCntIncrements, uint32 CopyMode);
+void   CFE_SB_ReleaseRcvBatch(CFE_SB_PipeD_t *PipeDscPtr);
+int32  CFE_SB_ValidateSendMsg(CFE_SB_Msg_t *MsgPtr, uint32 CopyMode, uint32 TskId);
+int32  CFE_SB_RouteMsg(CFE_SB_Msg_t *MsgPtr, CFE_SB_MsgId_t MsgId, uint16 TotalMsgSize,
+                       uint32 TlmCntIncrements, uint32 CopyMode, uint32 TskId,
+                       char *FullName, CFE_SB_EventBuf_t *SBSndErr);
+void   CFE_SB_SendRouteEvents(CFE_SB_MsgId_t MsgId, uint16 TotalMsgSize, uint32 TskId,
+                              char *FullName, CFE_SB_EventBuf_t *SBSndErr);
 int32 CFE_SB_SendRtgInfo(const char *Filename);
 int32 CFE_SB_SendPipeInfo(const char *Filename);
 int32 CFE_SB_SendMapInfo(const char *Filename);
@@ -398,6 +529,8 @@ uint32 CFE_SB_RequestToSendEvent(uint32 TaskId, uint32 Bit);
 void CFE_SB_FinishSendEvent(uint32 TaskId, uint32 Bit);
 CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
+uint32 CFE_SB_ReserveDestSlot(CFE_SB_DestinationD_t *Dest);
+void CFE_SB_ReleaseDestSlot(CFE_SB_DestinationD_t *Dest);
 int32 CFE_SB_AddDest(uint16 RtgTblIdx, CFE_SB_DestinationD_t *Dest);
 int32 CFE_SB_RemoveDest(uint16 RtgTblIdx, CFE_SB_DestinationD_t *Dest);
 
@@ -406,6 +539,7 @@ int32 CFE_SB_RemoveDest(uint16 RtgTblIdx, CFE_SB_DestinationD_t *Dest);
  */
 
 extern cfe_sb_t CFE_SB;
+extern uint32   CFE_SB_MemPoolDefSize[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
 
 #endif /* _cfe_sb_priv_ */
 /*****************************************************************************/
@@ -467,6 +467,9 @@ void CFE_SB_ProcessCmdPipePkt(void){
 */
 void CFE_SB_SendHKTlmPkt(void){
     
+    /* pick up the buffers taken through the per-task buffer caches */
+    CFE_SB_CollectBufStats();
+
     CFE_SB.HKTlmMsg.Payload.MemInUse        = CFE_SB.StatTlmMsg.Payload.MemInUse;
     CFE_SB.HKTlmMsg.Payload.UnmarkedMem     = CFE_SB_BUF_MEMORY_BYTES - CFE_SB.StatTlmMsg.Payload.PeakMemInUse;
     
@@ -626,6 +629,8 @@ void CFE_SB_DisableRoute(CFE_SB_MsgPayloadPtr_t Payload){
 */
 void CFE_SB_SendStats(void){
 
+    CFE_SB_CollectBufStats();
+
     CFE_SB_SendMsg((CFE_SB_Msg_t *)&CFE_SB.StatTlmMsg);
 
     CFE_EVS_SendEvent(CFE_SB_SND_STATS_EID,CFE_EVS_DEBUG,
@@ -97,6 +97,14 @@
     #error CFE_SB_MAX_PIPE_DEPTH cannot be set greater than 65535!
 #endif
 
+#if CFE_SB_MAX_RCV_BATCH < 1
+    #error CFE_SB_MAX_RCV_BATCH cannot be less than 1!
+#endif
+
+#if CFE_SB_MAX_RCV_BATCH > CFE_SB_MAX_PIPE_DEPTH
+    #error CFE_SB_MAX_RCV_BATCH cannot be greater than CFE_SB_MAX_PIPE_DEPTH!
+#endif
+
 #if CFE_SB_HIGHEST_VALID_MSGID < 1
   #error CFE_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -221,5 +229,41 @@
     #error CFE_SB_DEFAULT_MSG_LIMIT cannot be greater than 65535!
 #endif
 
+#if (CFE_SB_LOCKLESS_SEND != TRUE) && (CFE_SB_LOCKLESS_SEND != FALSE)
+    #error CFE_SB_LOCKLESS_SEND must be either TRUE or FALSE!
+#endif
+
+#if (CFE_SB_LOCKLESS_SEND == TRUE) && !defined(__GNUC__)
+    #error CFE_SB_LOCKLESS_SEND requires a toolchain with the GCC atomic builtins!
+#endif
+
+#if CFE_SB_BUF_CACHE_DEPTH < 0
+    #error CFE_SB_BUF_CACHE_DEPTH cannot be less than 0!
+#endif
+
+#if CFE_SB_BUF_CACHE_DEPTH > 64
+    #error CFE_SB_BUF_CACHE_DEPTH cannot be greater than 64!
+#endif
+
+#if CFE_SB_BUF_CACHE_MAX_BLOCK < 1
+    #error CFE_SB_BUF_CACHE_MAX_BLOCK must be greater than 0!
+#endif
+
+#if CFE_SB_BUF_CACHE_MAX_BLOCK > CFE_SB_MAX_BLOCK_SIZE
+    #error CFE_SB_BUF_CACHE_MAX_BLOCK cannot be greater than CFE_SB_MAX_BLOCK_SIZE!
+#endif
+
+#if (CFE_SB_RING_PIPES != TRUE) && (CFE_SB_RING_PIPES != FALSE)
+    #error CFE_SB_RING_PIPES must be either TRUE or FALSE!
+#endif
+
+#if (CFE_SB_RING_PIPES == TRUE) && !defined(__GNUC__)
+    #error CFE_SB_RING_PIPES requires a toolchain with the GCC atomic builtins!
+#endif
+
+#if (CFE_SB_RING_PIPES == TRUE) && ((CFE_SB_MAX_PIPE_DEPTH & (CFE_SB_MAX_PIPE_DEPTH - 1)) != 0)
+    #error CFE_SB_MAX_PIPE_DEPTH must be a power of two when CFE_SB_RING_PIPES is TRUE!
+#endif
+
 #endif /* _cfe_sb_verify_ */
 /*****************************************************************************/
@@ -287,6 +287,9 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                 /* Initialize Registry Record to default settings */
                 CFE_TBL_InitRegistryRecord(RegRecPtr);
 
+                /* Work started on the previous registration of this record must not carry on */
+                RegRecPtr->Generation++;
+
                 if ((TblOptionFlags & CFE_TBL_OPT_USR_DEF_MSK) != (CFE_TBL_OPT_USR_DEF_ADDR & CFE_TBL_OPT_USR_DEF_MSK))
                 {
                     RegRecPtr->UserDefAddr = FALSE;
@@ -350,6 +353,12 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                     /* Save the Callback function pointer */
                     RegRecPtr->ValidationFuncPtr = TblValidationFuncPtr;
 
+#if (CFE_TBL_TASK_VALIDATION == TRUE)
+                    /* Note whether Table Services or the Application calls it */
+                    RegRecPtr->TaskValidation =
+                        ((TblOptionFlags & CFE_TBL_OPT_VALIDATE_MSK) == CFE_TBL_OPT_TASK_VALIDATE);
+#endif
+
                     /* Save Table Name in Registry */
                     strncpy(RegRecPtr->Name, TblName, CFE_TBL_MAX_FULL_NAME_LEN);
 
@@ -510,6 +519,7 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                     /* By making it the last step, other APIs do not have to lock registry */
                     /* to share the table or get its address because registry entries that */
                     /* are unowned are not checked to see if they match names, etc.        */
+                    CFE_TBL_AddToNameIndex(RegIndx);
                     RegRecPtr->OwnerAppId = ThisAppId;
                 }
             }
@@ -677,10 +687,18 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle )
             /* NOTE: Allocated memory is freed when all Access Links have been    */
             /*       removed.  This allows Applications to continue to use the    */
             /*       data until they acknowledge that the table has been removed. */
+            CFE_TBL_LockRegistry();
+
+            /* The validation function cannot be called once the table is unregistered */
+            CFE_TBL_WaitForTaskValidation(RegRecPtr);
+
             RegRecPtr->OwnerAppId = (uint32)CFE_TBL_NOT_OWNED;
 
             /* Remove Table Name */
+            CFE_TBL_RemoveFromNameIndex(AccessDescPtr->RegIndex);
             RegRecPtr->Name[0] = '\0';
+
+            CFE_TBL_UnlockRegistry();
         }
 
         /* Remove the Access Descriptor Link from linked list */
@@ -777,9 +795,17 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
         }
         else
         {
-            /* Loads by an Application are not allowed if a table load is already in progress */
-            if (RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
+            /* The working buffer is claimed under the registry lock, so the Table Services */
+            /* task cannot start a validation of the table at the same time                */
+            CFE_TBL_LockRegistry();
+
+            /* Loads by an Application are not allowed if a table load is already in progress, */
+            /* while the Table Services task is validating the table or reading a file into it */
+            if ((RegRecPtr->LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS) || (RegRecPtr->TaskValidating) ||
+                (CFE_TBL_TaskData.FileLoad.InProgress && (CFE_TBL_TaskData.FileLoad.RegRecPtr == RegRecPtr)))
             {
+                CFE_TBL_UnlockRegistry();
+
                 Status = CFE_TBL_ERR_LOAD_IN_PROGRESS;
 
                 CFE_ES_WriteToSysLog("CFE_TBL:Load-Tbl Load already in progress for '%s'\n", RegRecPtr->Name);
@@ -789,6 +815,8 @@ int32 CFE_TBL_Load( CFE_TBL_Handle_t TblHandle,
                 /* Obtain a working buffer (either the table's dedicated buffer or one of the shared buffers) */
                 Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, TRUE);
 
+                CFE_TBL_UnlockRegistry();
+
                 if (Status == CFE_SUCCESS)
                 {
                     /* Perform appropriate update to working buffer */
@@ -1126,7 +1154,7 @@ int32 CFE_TBL_ReleaseAddress( CFE_TBL_Handle_t TblHandle )
     if (Status == CFE_SUCCESS)
     {
         /* Clear the lock flag */
-        CFE_TBL_TaskData.Handles[TblHandle].LockFlag = FALSE;
+        CFE_TBL_ReleaseBuffer(&CFE_TBL_TaskData.Handles[TblHandle]);
 
         /* Return any pending warning or info status indicators */
         Status = CFE_TBL_GetNextNotification(TblHandle);
@@ -1254,120 +1282,14 @@ int32 CFE_TBL_Validate( CFE_TBL_Handle_t TblHandle )
 
         CFE_ES_GetAppName(AppName, ThisAppId, OS_MAX_API_NAME);
 
-        /* Identify the image to be validated, starting with the Inactive Buffer */
-        if (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
+        /* Tables validated by the Table Services task have nothing to validate here */
+        if (RegRecPtr->TaskValidation)
         {
-            /* Identify whether the Inactive Buffer is a shared buffer or a dedicated one */
-            if (RegRecPtr->DblBuffered)
-            {
-                /* Call the Application's Validation function for the Inactive Buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].BufferPtr);
-                
-                /* Allow buffer to be activated after passing validation */
-                if (Status == CFE_SUCCESS)
-                {
-                    RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].Validated = TRUE;       
-                }
-            }
-            else
-            {
-                /* Call the Application's Validation function for the appropriate shared buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)
-                          (CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr);
-                
-                /* Allow buffer to be activated after passing validation */
-                if (Status == CFE_SUCCESS)
-                {
-                    CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Validated = TRUE;       
-                }
-            }
-
-            if (Status == CFE_SUCCESS)
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
-                                           CFE_EVS_INFORMATION,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation successful for Inactive '%s'",
-                                           AppName, RegRecPtr->Name);
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
-                                           CFE_EVS_ERROR,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation failed for Inactive '%s', Status=0x%08X",
-                                           AppName, RegRecPtr->Name, (unsigned int)Status);
-                
-                if (Status > CFE_SUCCESS)
-                {
-                    CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
-                            (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
-                }
-            }
-
-            /* Save the result of the Validation function for the Table Services Task */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].Result = Status;
-
-            /* Once validation is complete, set flags to indicate response is ready */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
-            RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
-
-            /* Since the validation was successfully performed (although maybe not a successful result) */
-            /* return a success status */
-            Status = CFE_SUCCESS;
-        }
-        else if (RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
-        {
-            /* Perform validation on the currently active table buffer */
-            /* Identify whether the Active Buffer is a shared buffer or a dedicated one */
-            if (RegRecPtr->DblBuffered)
-            {
-                /* Call the Application's Validation function for the Dedicated Active Buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr);
-            }
-            else
-            {
-                /* Call the Application's Validation function for the static buffer */
-                Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[0].BufferPtr);
-            }
-
-            if (Status == CFE_SUCCESS)
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
-                                           CFE_EVS_INFORMATION,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation successful for Active '%s'",
-                                           AppName, RegRecPtr->Name);
-            }
-            else
-            {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
-                                           CFE_EVS_ERROR,
-                                           CFE_TBL_TaskData.TableTaskAppId,
-                                           "%s validation failed for Active '%s', Status=0x%08X",
-                                           AppName, RegRecPtr->Name, (unsigned int)Status);
-                
-                if (Status > CFE_SUCCESS)
-                {
-                    CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
-                            (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
-                }
-            }
-
-            /* Save the result of the Validation function for the Table Services Task */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].Result = Status;
-
-            /* Once validation is complete, reset the flags */
-            CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
-            RegRecPtr->ValidateActiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
-
-            /* Since the validation was successfully performed (although maybe not a successful result) */
-            /* return a success status */
-            Status = CFE_SUCCESS;
+            Status = CFE_TBL_INFO_NO_VALIDATION_PENDING;
         }
         else
         {
-            Status = CFE_TBL_INFO_NO_VALIDATION_PENDING;
+            Status = CFE_TBL_ValidateInternal(RegRecPtr, AppName);
         }
     }
     else
@@ -1392,6 +1314,23 @@ int32 CFE_TBL_Manage( CFE_TBL_Handle_t TblHandle )
 {
     int32   Status = CFE_SUCCESS;
     boolean FinishedManaging = FALSE;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    uint32  ThisAppId;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+
+    /* Finish an earlier update that was waiting for readers to let go of the table */
+    if (CFE_TBL_ValidateAccess(TblHandle, &ThisAppId) == CFE_SUCCESS)
+    {
+        RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[TblHandle].RegIndex];
+
+        if (RegRecPtr->OwnerAppId == ThisAppId)
+        {
+            CFE_TBL_LockRegistry();
+            CFE_TBL_ReclaimBuffers(RegRecPtr);
+            CFE_TBL_UnlockRegistry();
+        }
+    }
+#endif
 
     while (!FinishedManaging)
     {
@@ -1469,9 +1408,11 @@ int32 CFE_TBL_GetStatus( CFE_TBL_Handle_t TblHandle )
         {
             Status = CFE_TBL_INFO_UPDATE_PENDING;
         }
-        else if ((RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
-                 (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING))
+        else if (((RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
+                  (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)) &&
+                 (!RegRecPtr->TaskValidation))
         {
+            /* Validations of tables validated by the Table Services task are not the Application's to perform */
             Status = CFE_TBL_INFO_VALIDATION_PENDING;
         }
         else if (RegRecPtr->DumpControlIndex != CFE_TBL_NO_DUMP_PENDING)
@@ -1504,8 +1445,13 @@ int32 CFE_TBL_GetInfo( CFE_TBL_Info_t *TblInfoPtr, const char *TblName )
     CFE_TBL_RegistryRec_t   *RegRecPtr;
     CFE_TBL_Handle_t         HandleIterator;
 
+    /* Keep the name index from changing while it is searched */
+    CFE_TBL_LockRegistry();
+
     RegIndx = CFE_TBL_FindTableInRegistry(TblName);
 
+    CFE_TBL_UnlockRegistry();
+
     /* If we found the table, then extract the information from the Registry */
     if (RegIndx != CFE_TBL_NOT_FOUND)
     {
@@ -1570,7 +1516,9 @@ int32 CFE_TBL_DumpToBuffer( CFE_TBL_Handle_t TblHandle )
         DumpCtrlPtr = &CFE_TBL_TaskData.DumpControlBlocks[RegRecPtr->DumpControlIndex];
         
         /* Copy the contents of the active buffer to the assigned dump buffer */
-        CFE_PSP_MemCpy(DumpCtrlPtr->DumpBufferPtr->BufferPtr, RegRecPtr->Buffers[0].BufferPtr, DumpCtrlPtr->Size);
+        CFE_PSP_MemCpy(DumpCtrlPtr->DumpBufferPtr->BufferPtr,
+                       RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
+                       DumpCtrlPtr->Size);
         
         /* Save the current time so that the header in the dump file can have the correct time */
         DumpTime = CFE_TIME_GetTime();
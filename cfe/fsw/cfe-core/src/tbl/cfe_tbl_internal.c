@@ -76,9 +76,18 @@
 #include "cfe_evs.h"
 #include "cfe_fs.h"
 #include "cfe_psp.h"
+#include "private/cfe_atomic.h"
 #include <stdio.h>
 #include <string.h>
 
+/*
+** Local function prototypes
+*/
+static uint16 CFE_TBL_HashName(const char *TblName);
+static void   CFE_TBL_ReleaseRegistryEntry(int16 RegIndx);
+static void   CFE_TBL_ReleaseHandle(CFE_TBL_Handle_t TblHandle);
+static void   CFE_TBL_CopyBufferInfo(CFE_TBL_LoadBuff_t *DestPtr, const CFE_TBL_LoadBuff_t *SrcPtr);
+
 /*******************************************************************
 **
 ** CFE_TBL_EarlyInit
@@ -110,6 +119,7 @@ int32 CFE_TBL_EarlyInit (void)
     for(i=0; i < CFE_TBL_MAX_NUM_TABLES; i++)
     {
         CFE_TBL_InitRegistryRecord(&CFE_TBL_TaskData.Registry[i]);
+        CFE_TBL_TaskData.Registry[i].Generation = 0;
     }
 
     /* Initialize the Table Access Descriptors */
@@ -147,6 +157,16 @@ int32 CFE_TBL_EarlyInit (void)
         CFE_TBL_TaskData.LoadBuffs[i].Taken = TRUE;
     }
 
+    /* Start with an empty name index and every record and descriptor free */
+    CFE_TBL_IndexRegistry();
+
+    /* No table file is being read or written */
+    CFE_TBL_TaskData.FileLoad.InProgress = FALSE;
+    CFE_TBL_TaskData.FileLoad.FileDescriptor = -1;
+    CFE_TBL_TaskData.FileDump.InProgress = FALSE;
+    CFE_TBL_TaskData.FileDump.FileDescriptor = -1;
+    CFE_TBL_TaskData.TaskValidationPending = FALSE;
+
     CFE_TBL_TaskData.ValidationCtr = 0;
 
     CFE_TBL_TaskData.HkTlmTblRegIndex = CFE_TBL_NOT_FOUND;
@@ -312,12 +332,14 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->Buffers[0].FileCreateTimeSecs = 0;
     RegRecPtr->Buffers[0].FileCreateTimeSubSecs = 0;
     RegRecPtr->Buffers[0].Crc = 0;
+    RegRecPtr->Buffers[0].Readers = 0;
     RegRecPtr->Buffers[0].Taken = FALSE;
     RegRecPtr->Buffers[0].DataSource[0] = '\0';
     RegRecPtr->Buffers[1].BufferPtr = NULL;
     RegRecPtr->Buffers[1].FileCreateTimeSecs = 0;
     RegRecPtr->Buffers[1].FileCreateTimeSubSecs = 0;
     RegRecPtr->Buffers[1].Crc = 0;
+    RegRecPtr->Buffers[1].Readers = 0;
     RegRecPtr->Buffers[1].Taken = FALSE;
     RegRecPtr->Buffers[1].DataSource[0] = '\0';
     RegRecPtr->ValidationFuncPtr = NULL;
@@ -325,6 +347,7 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->TimeOfLastUpdate.Subseconds = 0;
     RegRecPtr->HeadOfAccessList = CFE_TBL_END_OF_LIST;
     RegRecPtr->LoadInProgress =  CFE_TBL_NO_LOAD_IN_PROGRESS;
+    RegRecPtr->PublishedLoadBuff = CFE_TBL_NO_LOAD_IN_PROGRESS;
     RegRecPtr->ValidateActiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
     RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
     RegRecPtr->CDSHandle = CFE_ES_CDS_BAD_HANDLE;
@@ -336,6 +359,8 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->UserDefAddr = FALSE;
     RegRecPtr->DblBuffered = FALSE;
     RegRecPtr->NotifyByMsg = FALSE;
+    RegRecPtr->TaskValidation = FALSE;
+    RegRecPtr->TaskValidating = FALSE;
     RegRecPtr->ActiveBufferIndex = 0;
     RegRecPtr->Name[0] = '\0';
     RegRecPtr->LastFileLoaded[0] = '\0';
@@ -483,6 +508,9 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
     CFE_TBL_AccessDescriptor_t *AccessDescPtr = &CFE_TBL_TaskData.Handles[TblHandle];
     CFE_TBL_RegistryRec_t      *RegRecPtr     = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
 
+    /* Let go of any table buffer still held through the descriptor */
+    CFE_TBL_ReleaseBuffer(AccessDescPtr);
+
     /* Lock Access to the table while we modify the linked list */
     CFE_TBL_LockRegistry();
 
@@ -513,6 +541,7 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
 
     /* Return the Access Descriptor to the pool */
     AccessDescPtr->UsedFlag = FALSE;
+    CFE_TBL_ReleaseHandle(TblHandle);
 
     /* If this was the last Access Descriptor for this table, we can free the memory buffers as well */
     if (RegRecPtr->HeadOfAccessList == CFE_TBL_END_OF_LIST)
@@ -551,8 +580,19 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
                     CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].Taken = FALSE;
                     RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
                 }
+
+                /* Likewise a shared buffer that an update left active */
+                if (RegRecPtr->PublishedLoadBuff != CFE_TBL_NO_LOAD_IN_PROGRESS)
+                {
+                    CFE_TBL_TaskData.LoadBuffs[RegRecPtr->PublishedLoadBuff].Taken = FALSE;
+                    RegRecPtr->PublishedLoadBuff = CFE_TBL_NO_LOAD_IN_PROGRESS;
+                    RegRecPtr->Buffers[1].BufferPtr = NULL;
+                }
             }
         }
+
+        /* The registry entry is free once the owner has also let go of it */
+        CFE_TBL_ReleaseRegistryEntry(AccessDescPtr->RegIndex);
     }
 
     /* Unlock the registry to allow others to modify it */
@@ -602,6 +642,13 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, uint
             }
             else /* Table Registry Entry is valid */
             {
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+                /* A buffer still held from an earlier call is given up for the current one */
+                CFE_TBL_ReleaseBuffer(AccessDescPtr);
+
+                AccessDescPtr->BufferIndex = CFE_TBL_PinActiveBuffer(RegRecPtr);
+                AccessDescPtr->LockFlag = TRUE;
+#else
                 /* Lock the table and return the current pointer */
                 AccessDescPtr->LockFlag = TRUE;
 
@@ -609,6 +656,7 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, uint
                 /* This is used to ensure that if the buffer becomes inactive while */
                 /* we are using it, no one will modify it until we are done */
                 AccessDescPtr->BufferIndex = RegRecPtr->ActiveBufferIndex;
+#endif
 
                 *TblPtr = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
 
@@ -635,6 +683,81 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, uint
 }   /* End of CFE_TBL_GetAddressInternal() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_ReleaseBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_ReleaseBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr)
+{
+    if (AccessDescPtr->LockFlag)
+    {
+        CFE_TBL_UnpinBuffer(&CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex], AccessDescPtr->BufferIndex);
+
+        AccessDescPtr->LockFlag = FALSE;
+    }
+}   /* End of CFE_TBL_ReleaseBuffer() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_PinActiveBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+uint8 CFE_TBL_PinActiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    uint8   BufferIndex;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    boolean Pinned;
+
+    /* Count ourselves as a reader of the active buffer, then make sure it  */
+    /* was not replaced before updaters could see the count.  If it was, it */
+    /* may already be getting overwritten, so drop it and try again.        */
+    do
+    {
+        BufferIndex = CFE_ATOMIC_LOAD(&RegRecPtr->ActiveBufferIndex);
+        CFE_ATOMIC_INC(&RegRecPtr->Buffers[BufferIndex].Readers);
+
+        Pinned = (CFE_ATOMIC_LOAD(&RegRecPtr->ActiveBufferIndex) == BufferIndex);
+        if (!Pinned)
+        {
+            CFE_ATOMIC_DEC(&RegRecPtr->Buffers[BufferIndex].Readers);
+        }
+    } while (!Pinned);
+#else
+    BufferIndex = RegRecPtr->ActiveBufferIndex;
+#endif
+
+    return BufferIndex;
+}   /* End of CFE_TBL_PinActiveBuffer() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_UnpinBuffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_UnpinBuffer(CFE_TBL_RegistryRec_t *RegRecPtr, uint8 BufferIndex)
+{
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    /* The last reader of a buffer that an update is waiting on finishes the update */
+    if ((CFE_ATOMIC_DEC(&RegRecPtr->Buffers[BufferIndex].Readers) == 0) &&
+        (CFE_ATOMIC_LOAD(&RegRecPtr->PublishedLoadBuff) != CFE_TBL_NO_LOAD_IN_PROGRESS))
+    {
+        CFE_TBL_LockRegistry();
+        CFE_TBL_ReclaimBuffers(RegRecPtr);
+        CFE_TBL_UnlockRegistry();
+    }
+#endif
+}   /* End of CFE_TBL_UnpinBuffer() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_GetNextNotification
@@ -663,6 +786,104 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
 }   /* End of CFE_TBL_GetNextNotification() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_HashName
+**
+** Purpose:  Returns the name index chain of the given table name.
+********************************************************************/
+
+static uint16 CFE_TBL_HashName(const char *TblName)
+{
+    uint32 Hash = 0;
+
+    while (*TblName != '\0')
+    {
+        Hash = (Hash * 31) + (uint8)*TblName;
+        TblName++;
+    }
+
+    return (uint16)(Hash % CFE_TBL_NAME_HASH_SIZE);
+}   /* End of CFE_TBL_HashName() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ReleaseRegistryEntry
+**
+** Purpose:  Puts a Table Registry record on the free list if it is
+**           free and not already on the list.  The list is kept in
+**           index order so the lowest free record is reused first.
+********************************************************************/
+
+static void CFE_TBL_ReleaseRegistryEntry(int16 RegIndx)
+{
+    int16 *LinkPtr;
+
+    if ((CFE_TBL_TaskData.FreeRegistryLinks[RegIndx] == CFE_TBL_NOT_LISTED) &&
+        (CFE_TBL_TaskData.Registry[RegIndx].OwnerAppId == CFE_TBL_NOT_OWNED) &&
+        (CFE_TBL_TaskData.Registry[RegIndx].HeadOfAccessList == CFE_TBL_END_OF_LIST))
+    {
+        LinkPtr = &CFE_TBL_TaskData.FreeRegistryHead;
+
+        while ((*LinkPtr != CFE_TBL_NOT_FOUND) && (*LinkPtr < RegIndx))
+        {
+            LinkPtr = &CFE_TBL_TaskData.FreeRegistryLinks[*LinkPtr];
+        }
+
+        CFE_TBL_TaskData.FreeRegistryLinks[RegIndx] = *LinkPtr;
+        *LinkPtr = RegIndx;
+    }
+}   /* End of CFE_TBL_ReleaseRegistryEntry() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ReleaseHandle
+**
+** Purpose:  Puts an Access Descriptor on the free list if it is
+**           unused and not already on the list.  The list is kept in
+**           index order so the lowest free handle is reused first.
+********************************************************************/
+
+static void CFE_TBL_ReleaseHandle(CFE_TBL_Handle_t TblHandle)
+{
+    CFE_TBL_Handle_t *LinkPtr;
+
+    if ((CFE_TBL_TaskData.FreeHandleLinks[TblHandle] == CFE_TBL_NOT_LISTED) &&
+        (CFE_TBL_TaskData.Handles[TblHandle].UsedFlag == FALSE))
+    {
+        LinkPtr = &CFE_TBL_TaskData.FreeHandleHead;
+
+        while ((*LinkPtr != CFE_TBL_END_OF_LIST) && (*LinkPtr < TblHandle))
+        {
+            LinkPtr = &CFE_TBL_TaskData.FreeHandleLinks[*LinkPtr];
+        }
+
+        CFE_TBL_TaskData.FreeHandleLinks[TblHandle] = *LinkPtr;
+        *LinkPtr = TblHandle;
+    }
+}   /* End of CFE_TBL_ReleaseHandle() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_CopyBufferInfo
+**
+** Copies the description of a buffer's contents (source, file time
+** and CRC) into another buffer.
+********************************************************************/
+
+static void CFE_TBL_CopyBufferInfo(CFE_TBL_LoadBuff_t *DestPtr, const CFE_TBL_LoadBuff_t *SrcPtr)
+{
+    strncpy(DestPtr->DataSource, SrcPtr->DataSource, OS_MAX_PATH_LEN);
+    DestPtr->FileCreateTimeSecs = SrcPtr->FileCreateTimeSecs;
+    DestPtr->FileCreateTimeSubSecs = SrcPtr->FileCreateTimeSubSecs;
+    DestPtr->Crc = SrcPtr->Crc;
+
+}   /* End of CFE_TBL_CopyBufferInfo() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_FindTableInRegistry
@@ -673,24 +894,25 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
 int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 {
     int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i = -1;
+    int16 i;
 
-    do
-    {
-        /* Point to next record in the Table Registry */
-        i++;
+    /* Only the records whose names share a hash chain with the given name need to be compared */
+    i = CFE_TBL_TaskData.NameHash[CFE_TBL_HashName(TblName)];
 
+    while ((RegIndx == CFE_TBL_NOT_FOUND) && (i != CFE_TBL_NOT_FOUND))
+    {
         /* Check to see if the record is currently being used */
-        if (CFE_TBL_TaskData.Registry[i].OwnerAppId != CFE_TBL_NOT_OWNED)
+        if ((CFE_TBL_TaskData.Registry[i].OwnerAppId != CFE_TBL_NOT_OWNED) &&
+            (strcmp(TblName, CFE_TBL_TaskData.Registry[i].Name) == 0))
         {
-            /* Perform a case sensitive name comparison */
-            if (strcmp(TblName, CFE_TBL_TaskData.Registry[i].Name) == 0)
-            {
-                /* If the names match, then return the index */
-                RegIndx = i;
-            }
+            /* If the names match, then return the index */
+            RegIndx = i;
         }
-    } while ( (RegIndx == CFE_TBL_NOT_FOUND) && (i < (CFE_TBL_MAX_NUM_TABLES-1)) );
+        else
+        {
+            i = CFE_TBL_TaskData.NameHashLinks[i];
+        }
+    }
 
     return RegIndx;
 }   /* End of CFE_TBL_FindTableInRegistry() */
@@ -705,21 +927,37 @@ int16 CFE_TBL_FindTableInRegistry(const char *TblName)
 
 int16 CFE_TBL_FindFreeRegistryEntry(void)
 {
-    int16 RegIndx = CFE_TBL_NOT_FOUND;
-    int16 i = 0;
+    int16 RegIndx;
+    int16 i;
+
+    /* Entries stay on the free list until they are found to be in use, so  */
+    /* drop any entries that have been used since they were put on the list */
+    while (((RegIndx = CFE_TBL_TaskData.FreeRegistryHead) != CFE_TBL_NOT_FOUND) &&
+           ((CFE_TBL_TaskData.Registry[RegIndx].OwnerAppId != CFE_TBL_NOT_OWNED) ||
+            (CFE_TBL_TaskData.Registry[RegIndx].HeadOfAccessList != CFE_TBL_END_OF_LIST)))
+    {
+        CFE_TBL_TaskData.FreeRegistryHead = CFE_TBL_TaskData.FreeRegistryLinks[RegIndx];
+        CFE_TBL_TaskData.FreeRegistryLinks[RegIndx] = CFE_TBL_NOT_LISTED;
+    }
 
-    while ( (RegIndx == CFE_TBL_NOT_FOUND) && (i < CFE_TBL_MAX_NUM_TABLES) )
+    /* Before reporting a full registry, make sure no entry was freed without going on the list */
+    if (RegIndx == CFE_TBL_NOT_FOUND)
     {
-        /* A Table Registry is only "Free" when there isn't an owner AND */
-        /* all other applications are not sharing or locking the table   */
-        if ((CFE_TBL_TaskData.Registry[i].OwnerAppId == CFE_TBL_NOT_OWNED) &&
-            (CFE_TBL_TaskData.Registry[i].HeadOfAccessList == CFE_TBL_END_OF_LIST))
-        {
-            RegIndx = i;
-        }
-        else
+        i = 0;
+
+        while ( (RegIndx == CFE_TBL_NOT_FOUND) && (i < CFE_TBL_MAX_NUM_TABLES) )
         {
-            i++;
+            /* A Table Registry is only "Free" when there isn't an owner AND */
+            /* all other applications are not sharing or locking the table   */
+            if ((CFE_TBL_TaskData.Registry[i].OwnerAppId == CFE_TBL_NOT_OWNED) &&
+                (CFE_TBL_TaskData.Registry[i].HeadOfAccessList == CFE_TBL_END_OF_LIST))
+            {
+                RegIndx = i;
+            }
+            else
+            {
+                i++;
+            }
         }
     }
 
@@ -736,18 +974,33 @@ int16 CFE_TBL_FindFreeRegistryEntry(void)
 
 CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void)
 {
-    CFE_TBL_Handle_t HandleIndx = CFE_TBL_END_OF_LIST;
-    int16 i = 0;
+    CFE_TBL_Handle_t HandleIndx;
+    int16 i;
 
-    while ((HandleIndx == CFE_TBL_END_OF_LIST) && (i < CFE_TBL_MAX_NUM_HANDLES))
+    /* Descriptors stay on the free list until they are found to be in use, */
+    /* so drop any descriptors that have been used since they were put on it */
+    while (((HandleIndx = CFE_TBL_TaskData.FreeHandleHead) != CFE_TBL_END_OF_LIST) &&
+           (CFE_TBL_TaskData.Handles[HandleIndx].UsedFlag == TRUE))
     {
-        if (CFE_TBL_TaskData.Handles[i].UsedFlag == FALSE)
-        {
-            HandleIndx = i;
-        }
-        else
+        CFE_TBL_TaskData.FreeHandleHead = CFE_TBL_TaskData.FreeHandleLinks[HandleIndx];
+        CFE_TBL_TaskData.FreeHandleLinks[HandleIndx] = CFE_TBL_NOT_LISTED;
+    }
+
+    /* Before reporting that no handles are left, make sure none was freed without going on the list */
+    if (HandleIndx == CFE_TBL_END_OF_LIST)
+    {
+        i = 0;
+
+        while ((HandleIndx == CFE_TBL_END_OF_LIST) && (i < CFE_TBL_MAX_NUM_HANDLES))
         {
-            i++;
+            if (CFE_TBL_TaskData.Handles[i].UsedFlag == FALSE)
+            {
+                HandleIndx = i;
+            }
+            else
+            {
+                i++;
+            }
         }
     }
 
@@ -755,6 +1008,106 @@ CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void)
 }   /* End of CFE_TBL_FindFreeHandle() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_IndexRegistry
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_IndexRegistry(void)
+{
+    int16 i;
+
+    for (i = 0; i < CFE_TBL_NAME_HASH_SIZE; i++)
+    {
+        CFE_TBL_TaskData.NameHash[i] = CFE_TBL_NOT_FOUND;
+    }
+
+    CFE_TBL_TaskData.FreeRegistryHead = CFE_TBL_NOT_FOUND;
+    CFE_TBL_TaskData.FreeHandleHead = CFE_TBL_END_OF_LIST;
+
+    /* Work down from the top so each free entry goes on the head of its list */
+    for (i = CFE_TBL_MAX_NUM_TABLES - 1; i >= 0; i--)
+    {
+        CFE_TBL_TaskData.NameHashLinks[i] = CFE_TBL_NOT_FOUND;
+        CFE_TBL_TaskData.NameHashSlot[i] = CFE_TBL_NAME_HASH_SIZE;
+        CFE_TBL_TaskData.FreeRegistryLinks[i] = CFE_TBL_NOT_LISTED;
+
+        if (CFE_TBL_TaskData.Registry[i].Name[0] != '\0')
+        {
+            CFE_TBL_AddToNameIndex(i);
+        }
+
+        CFE_TBL_ReleaseRegistryEntry(i);
+    }
+
+    for (i = CFE_TBL_MAX_NUM_HANDLES - 1; i >= 0; i--)
+    {
+        CFE_TBL_TaskData.FreeHandleLinks[i] = CFE_TBL_NOT_LISTED;
+
+        CFE_TBL_ReleaseHandle(i);
+    }
+
+}   /* End of CFE_TBL_IndexRegistry() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_AddToNameIndex
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_AddToNameIndex(int16 RegIndx)
+{
+    uint16 Slot;
+
+    CFE_TBL_RemoveFromNameIndex(RegIndx);
+
+    Slot = CFE_TBL_HashName(CFE_TBL_TaskData.Registry[RegIndx].Name);
+
+    /* The link is set before the record becomes visible at the head of the chain */
+    CFE_TBL_TaskData.NameHashSlot[RegIndx] = Slot;
+    CFE_TBL_TaskData.NameHashLinks[RegIndx] = CFE_TBL_TaskData.NameHash[Slot];
+    CFE_TBL_TaskData.NameHash[Slot] = RegIndx;
+
+}   /* End of CFE_TBL_AddToNameIndex() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_RemoveFromNameIndex
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_RemoveFromNameIndex(int16 RegIndx)
+{
+    int16 *LinkPtr;
+
+    if (CFE_TBL_TaskData.NameHashSlot[RegIndx] < CFE_TBL_NAME_HASH_SIZE)
+    {
+        LinkPtr = &CFE_TBL_TaskData.NameHash[CFE_TBL_TaskData.NameHashSlot[RegIndx]];
+
+        while ((*LinkPtr != CFE_TBL_NOT_FOUND) && (*LinkPtr != RegIndx))
+        {
+            LinkPtr = &CFE_TBL_TaskData.NameHashLinks[*LinkPtr];
+        }
+
+        /* The record's own link is left alone so that a lookup that is */
+        /* looking at this record can still reach the rest of the chain */
+        if (*LinkPtr == RegIndx)
+        {
+            *LinkPtr = CFE_TBL_TaskData.NameHashLinks[RegIndx];
+        }
+
+        CFE_TBL_TaskData.NameHashSlot[RegIndx] = CFE_TBL_NAME_HASH_SIZE;
+    }
+
+}   /* End of CFE_TBL_RemoveFromNameIndex() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_FormTableName
@@ -826,6 +1179,28 @@ int32 CFE_TBL_UnlockRegistry(void)
 }   /* End of CFE_TBL_UnlockRegistry() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_WaitForTaskValidation
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_WaitForTaskValidation(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    /* The registry is unlocked while waiting so the Table Services task can finish */
+    while (RegRecPtr->TaskValidating)
+    {
+        CFE_TBL_UnlockRegistry();
+
+        OS_TaskDelay(CFE_TBL_TASK_VALIDATION_DLY);
+
+        CFE_TBL_LockRegistry();
+    }
+
+}   /* End of CFE_TBL_WaitForTaskValidation() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_GetWorkingBuffer
@@ -840,7 +1215,9 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
     int32   Status = CFE_SUCCESS;
     int32   i;
     int32   InactiveBufferIndex;
+#if (CFE_TBL_LOCKLESS_ACCESS != TRUE)
     CFE_TBL_Handle_t AccessIterator;
+#endif
 
     /* Initialize return pointer to NULL */
     *WorkingBufferPtr = NULL;
@@ -883,6 +1260,17 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                 /* Determine the index of the Inactive Buffer Pointer */
                 InactiveBufferIndex = 1 - RegRecPtr->ActiveBufferIndex;
 
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+                /* Readers count themselves on the buffer they hold, so only that count matters */
+                if (CFE_ATOMIC_LOAD(&RegRecPtr->Buffers[InactiveBufferIndex].Readers) != 0)
+                {
+                    Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+
+                    CFE_ES_WriteToSysLog("CFE_TBL:GetWorkingBuffer-Inactive Dbl Buff Locked for '%s' by %u readers\n",
+                                         RegRecPtr->Name,
+                                         (unsigned int)CFE_ATOMIC_LOAD(&RegRecPtr->Buffers[InactiveBufferIndex].Readers));
+                }
+#else
                 /* Scan the access descriptor table to determine if anyone is still using the inactive buffer */
                 AccessIterator = RegRecPtr->HeadOfAccessList;
                 while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
@@ -899,6 +1287,7 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                     /* Move to next access descriptor in linked list */
                     AccessIterator = CFE_TBL_TaskData.Handles[AccessIterator].NextLink;
                 }
+#endif
 
                 /* If buffer is free, then return the pointer to it */
                 if (Status == CFE_SUCCESS)
@@ -954,6 +1343,9 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                 CFE_PSP_MemCpy((*WorkingBufferPtr)->BufferPtr,
                           RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr,
                           RegRecPtr->Size);
+
+                /* The CRC describes the copied contents until a load changes them */
+                (*WorkingBufferPtr)->Crc = RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Crc;
             }
         }
     }
@@ -982,6 +1374,7 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
     size_t               FilenameLen = strlen(Filename);
     uint32               NumBytes;
     uint8                ExtraByte;
+    uint32               Crc;
 
     if (FilenameLen > (OS_MAX_PATH_LEN-1))
     {
@@ -1005,6 +1398,23 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
                     {
                         Status = CFE_TBL_ERR_FILE_TOO_LARGE;
                     }
+                    else if (StdFileHeader.SubType == CFE_FS_TBL_PATCH_SUBTYPE)
+                    {
+                        /* Patches change only some of the table, just like a partial load */
+                        Status = CFE_TBL_ApplyPatches(FileDescriptor, WorkingBufferPtr, RegRecPtr, &TblFileHeader);
+
+                        if (Status == CFE_SUCCESS)
+                        {
+                            Status = CFE_TBL_WARN_PARTIAL_LOAD;
+                        }
+
+                        CFE_PSP_MemSet(WorkingBufferPtr->DataSource, 0, OS_MAX_PATH_LEN);
+                        strncpy(WorkingBufferPtr->DataSource, Filename, OS_MAX_PATH_LEN);
+
+                        /* Save file creation time for later storage into Registry */
+                        WorkingBufferPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
+                        WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
+                    }
                     else
                     {
                         /* Any Table load that starts beyond the first byte is a "partial load" */
@@ -1019,9 +1429,16 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
                             Status = CFE_TBL_WARN_SHORT_FILE;
                         }
 
-                        NumBytes = OS_read(FileDescriptor,
-                                           &WorkingBufferPtr->BufferPtr[TblFileHeader.Offset],
-                                           TblFileHeader.NumBytes);
+                        /* Read the data, computing the CRC of the table as it arrives */
+                        Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
+                                                  TblFileHeader.Offset,
+                                                  0,
+                                                  CFE_ES_DEFAULT_CRC);
+
+                        NumBytes = CFE_TBL_ReadTableData(FileDescriptor,
+                                                         &WorkingBufferPtr->BufferPtr[TblFileHeader.Offset],
+                                                         TblFileHeader.NumBytes,
+                                                         &Crc);
 
                         if (NumBytes != TblFileHeader.NumBytes)
                         {
@@ -1044,10 +1461,10 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
                         WorkingBufferPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
                         WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
                         
-                        /* Compute the CRC on the specified table buffer */
-                        WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                                    RegRecPtr->Size,
-                                                                    0,
+                        /* Finish the CRC with the rest of the table buffer */
+                        WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(&WorkingBufferPtr->BufferPtr[TblFileHeader.Offset + NumBytes],
+                                                                    RegRecPtr->Size - (TblFileHeader.Offset + NumBytes),
+                                                                    Crc,
                                                                     CFE_ES_DEFAULT_CRC);
                     }
                 }
@@ -1070,6 +1487,124 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
 }
 
 
+/*******************************************************************
+**
+** CFE_TBL_ReadTableData
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+uint32 CFE_TBL_ReadTableData(int32 FileDescriptor, uint8 *BufferPtr, uint32 NumBytes, uint32 *CrcPtr)
+{
+    uint32 BytesRead = 0;
+    uint32 ChunkSize;
+    int32  Status = 0;
+
+    while ((BytesRead < NumBytes) && (Status >= 0))
+    {
+        ChunkSize = NumBytes - BytesRead;
+        if (ChunkSize > CFE_TBL_LOAD_CHUNK_SIZE)
+        {
+            ChunkSize = CFE_TBL_LOAD_CHUNK_SIZE;
+        }
+
+        Status = OS_read(FileDescriptor, &BufferPtr[BytesRead], ChunkSize);
+
+        if (Status > 0)
+        {
+            /* Continue the CRC while the data just read is still in the cache */
+            *CrcPtr = CFE_ES_CalculateCRC(&BufferPtr[BytesRead], (uint32)Status, *CrcPtr, CFE_ES_DEFAULT_CRC);
+            BytesRead += (uint32)Status;
+        }
+
+        /* A short read means the file ended or could not be read */
+        if (Status != (int32)ChunkSize)
+        {
+            Status = -1;
+        }
+    }
+
+    return BytesRead;
+}
+
+
+/*******************************************************************
+**
+** CFE_TBL_ApplyPatches
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_ApplyPatches(int32 FileDescriptor,
+                           CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                           const CFE_TBL_RegistryRec_t *RegRecPtr,
+                           const CFE_TBL_File_Hdr_t *TblFileHeaderPtr)
+{
+    int32              Status = CFE_SUCCESS;
+    int32              EndianCheck = 0x01020304;
+    int32              ReadStatus;
+    CFE_TBL_PatchHdr_t PatchHdr;
+    uint8             *BufferPtr = WorkingBufferPtr->BufferPtr;
+    uint32             SpanEnd = TblFileHeaderPtr->Offset + TblFileHeaderPtr->NumBytes;
+    uint32             PatchCrc;
+    uint32             OldCrc;
+    boolean            PatchesDone = FALSE;
+
+    /* The patches apply to the working buffer as it is, which may already hold a load that has */
+    /* not been activated, so each patch updates the working buffer's CRC                       */
+
+    while ((Status == CFE_SUCCESS) && (!PatchesDone))
+    {
+        ReadStatus = OS_read(FileDescriptor, &PatchHdr, sizeof(CFE_TBL_PatchHdr_t));
+
+        if (ReadStatus == 0)
+        {
+            /* The patches run to the end of the file */
+            PatchesDone = TRUE;
+        }
+        else if (ReadStatus != sizeof(CFE_TBL_PatchHdr_t))
+        {
+            Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
+        else
+        {
+            if ((*(char *)&EndianCheck) == 0x04)
+            {
+                /* Patch headers are big endian, just like the table header */
+                CFE_TBL_ByteSwapUint32(&PatchHdr.Offset);
+                CFE_TBL_ByteSwapUint32(&PatchHdr.NumBytes);
+            }
+
+            if ((PatchHdr.NumBytes == 0) ||
+                (PatchHdr.Offset < TblFileHeaderPtr->Offset) ||
+                (PatchHdr.Offset >= SpanEnd) ||
+                (PatchHdr.NumBytes > (SpanEnd - PatchHdr.Offset)))
+            {
+                Status = CFE_TBL_ERR_BAD_PATCH;
+            }
+            else
+            {
+                OldCrc = CFE_ES_CalculateCRC(&BufferPtr[PatchHdr.Offset], PatchHdr.NumBytes, 0, CFE_ES_DEFAULT_CRC);
+                PatchCrc = 0;
+
+                if (CFE_TBL_ReadTableData(FileDescriptor, &BufferPtr[PatchHdr.Offset],
+                                          PatchHdr.NumBytes, &PatchCrc) != PatchHdr.NumBytes)
+                {
+                    Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+                }
+
+                WorkingBufferPtr->Crc = CFE_ES_UpdateCRC(WorkingBufferPtr->Crc, OldCrc, PatchCrc,
+                                                         RegRecPtr->Size - (PatchHdr.Offset + PatchHdr.NumBytes),
+                                                         CFE_ES_DEFAULT_CRC);
+            }
+        }
+    }
+
+    return Status;
+}
+
+
+
 /*******************************************************************
 **
 ** CFE_TBL_UpdateInternal
@@ -1082,8 +1617,10 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                               CFE_TBL_AccessDescriptor_t *AccessDescPtr )
 {
     int32 Status = CFE_SUCCESS;
+#if (CFE_TBL_LOCKLESS_ACCESS != TRUE)
     CFE_TBL_Handle_t AccessIterator;
     boolean LockStatus = FALSE;
+#endif
     
     if ((!RegRecPtr->LoadPending) || (RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS))
     {
@@ -1096,7 +1633,9 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
         if (RegRecPtr->DblBuffered)
         {
             /* To update a double buffered table only requires a pointer swap */
+            CFE_ATOMIC_BARRIER();
             RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+            CFE_ATOMIC_BARRIER();
 
             /* Source description in buffer should already have been updated by either */
             /* the LoadFromFile function or the Load function (when a memory load).    */
@@ -1113,6 +1652,55 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                 CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
             }
         }
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+        else
+        {
+            /* Readers finish waiting updates as they let go of the table, */
+            /* so the buffers are only changed with the registry locked    */
+            CFE_TBL_LockRegistry();
+
+            /* Finish any earlier update first, so its shared buffer can be given back */
+            CFE_TBL_ReclaimBuffers(RegRecPtr);
+
+            if (RegRecPtr->PublishedLoadBuff != CFE_TBL_NO_LOAD_IN_PROGRESS)
+            {
+                CFE_TBL_UnlockRegistry();
+
+                /* Readers still hold both the table's buffer and the previous update */
+                Status = CFE_TBL_INFO_TABLE_LOCKED;
+
+                CFE_ES_WriteToSysLog("CFE_TBL:UpdateInternal-Unable to update locked table Handle=%d\n", TblHandle);
+            }
+            else
+            {
+                /* Make the working buffer active right away.  The table's own buffer */
+                /* gets the new contents once its readers have let go of it.          */
+                RegRecPtr->Buffers[1].BufferPtr = CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress].BufferPtr;
+                CFE_TBL_CopyBufferInfo(&RegRecPtr->Buffers[1], &CFE_TBL_TaskData.LoadBuffs[RegRecPtr->LoadInProgress]);
+                RegRecPtr->PublishedLoadBuff = RegRecPtr->LoadInProgress;
+
+                CFE_ATOMIC_BARRIER();
+                RegRecPtr->ActiveBufferIndex = 1;
+                CFE_ATOMIC_BARRIER();
+
+                strncpy(RegRecPtr->LastFileLoaded,
+                        RegRecPtr->Buffers[1].DataSource,
+                        OS_MAX_PATH_LEN);
+
+                CFE_TBL_ReclaimBuffers(RegRecPtr);
+
+                CFE_TBL_UnlockRegistry();
+
+                CFE_TBL_NotifyTblUsersOfUpdate(RegRecPtr);
+
+                /* If the table is a critical table, update the appropriate CDS with the new data */
+                if (RegRecPtr->CriticalTable == TRUE)
+                {
+                    CFE_TBL_UpdateCriticalTblCDS(RegRecPtr);
+                }
+            }
+        }
+#else
         else
         {
             /* Check to see if the Table is locked by anyone */
@@ -1166,12 +1754,193 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                 }
             }
         }
+#endif
     }
 
     return Status;
 }   /* End of CFE_TBL_UpdateInternal() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_ValidateInternal
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_ValidateInternal(CFE_TBL_RegistryRec_t *RegRecPtr, const char *AppName)
+{
+    int32 Status = CFE_SUCCESS;
+    uint8 BufferIndex;
+    int32 LoadInProgress;
+    CFE_TBL_LoadBuff_t *InactiveBufferPtr = NULL;
+
+    /* Identify the image to be validated, starting with the Inactive Buffer */
+    if (RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        /* Identify the Inactive Buffer once, since the owner may update the table while */
+        /* the Table Services task is calling the validation function                     */
+        if (RegRecPtr->DblBuffered)
+        {
+            InactiveBufferPtr = &RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)];
+        }
+        else
+        {
+            /* Identify the shared buffer, if the load has not been activated since the request */
+            LoadInProgress = RegRecPtr->LoadInProgress;
+
+            if (LoadInProgress != CFE_TBL_NO_LOAD_IN_PROGRESS)
+            {
+                InactiveBufferPtr = &CFE_TBL_TaskData.LoadBuffs[LoadInProgress];
+            }
+        }
+
+        if (InactiveBufferPtr == NULL)
+        {
+            Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
+        }
+        else
+        {
+            /* Call the Application's Validation function for the Inactive Buffer */
+            Status = (RegRecPtr->ValidationFuncPtr)(InactiveBufferPtr->BufferPtr);
+            
+            /* Allow buffer to be activated after passing validation */
+            if (Status == CFE_SUCCESS)
+            {
+                InactiveBufferPtr->Validated = TRUE;       
+            }
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
+                                       CFE_EVS_INFORMATION,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation successful for Inactive '%s'",
+                                       AppName, RegRecPtr->Name);
+        }
+        else
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
+                                       CFE_EVS_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation failed for Inactive '%s', Status=0x%08X",
+                                       AppName, RegRecPtr->Name, (unsigned int)Status);
+            
+            if (Status > CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
+                        (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
+            }
+        }
+
+        /* Save the result of the Validation function for the Table Services Task */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].Result = Status;
+
+        /* Once validation is complete, set flags to indicate response is ready */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateInactiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
+        RegRecPtr->ValidateInactiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
+
+        /* Since the validation was successfully performed (although maybe not a successful result) */
+        /* return a success status */
+        Status = CFE_SUCCESS;
+    }
+    else if (RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)
+    {
+        /* Perform validation on the currently active table buffer.  It is held */
+        /* the way a reader holds it, since the Table Services task may be      */
+        /* validating it while the owner updates the table.                     */
+        BufferIndex = CFE_TBL_PinActiveBuffer(RegRecPtr);
+
+        /* Call the Application's Validation function for the Active Buffer */
+        Status = (RegRecPtr->ValidationFuncPtr)(RegRecPtr->Buffers[BufferIndex].BufferPtr);
+
+        CFE_TBL_UnpinBuffer(RegRecPtr, BufferIndex);
+
+        if (Status == CFE_SUCCESS)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_INF_EID,
+                                       CFE_EVS_INFORMATION,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation successful for Active '%s'",
+                                       AppName, RegRecPtr->Name);
+        }
+        else
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_VALIDATION_ERR_EID,
+                                       CFE_EVS_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "%s validation failed for Active '%s', Status=0x%08X",
+                                       AppName, RegRecPtr->Name, (unsigned int)Status);
+            
+            if (Status > CFE_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("CFE_TBL:Validate-App(%u) Validation func return code invalid (Stat=0x%08X) for '%s'\n",
+                        (unsigned int)CFE_TBL_TaskData.TableTaskAppId, (unsigned int)Status, RegRecPtr->Name);
+            }
+        }
+
+        /* Save the result of the Validation function for the Table Services Task */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].Result = Status;
+
+        /* Once validation is complete, reset the flags */
+        CFE_TBL_TaskData.ValidationResults[RegRecPtr->ValidateActiveIndex].State = CFE_TBL_VALIDATION_PERFORMED;
+        RegRecPtr->ValidateActiveIndex = CFE_TBL_NO_VALIDATION_PENDING;
+
+        /* Since the validation was successfully performed (although maybe not a successful result) */
+        /* return a success status */
+        Status = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_TBL_INFO_NO_VALIDATION_PENDING;
+    }
+
+    return Status;
+}   /* End of CFE_TBL_ValidateInternal() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ReclaimBuffers
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_ReclaimBuffers(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    if (RegRecPtr->PublishedLoadBuff == CFE_TBL_NO_LOAD_IN_PROGRESS)
+    {
+        return;
+    }
+
+    /* Once nobody holds the table's own buffer, bring it up to date and make it active again */
+    if ((RegRecPtr->ActiveBufferIndex == 1) &&
+        (CFE_ATOMIC_LOAD(&RegRecPtr->Buffers[0].Readers) == 0))
+    {
+        CFE_PSP_MemCpy(RegRecPtr->Buffers[0].BufferPtr,
+                       RegRecPtr->Buffers[1].BufferPtr,
+                       RegRecPtr->Size);
+        CFE_TBL_CopyBufferInfo(&RegRecPtr->Buffers[0], &RegRecPtr->Buffers[1]);
+
+        CFE_ATOMIC_BARRIER();
+        RegRecPtr->ActiveBufferIndex = 0;
+        CFE_ATOMIC_BARRIER();
+    }
+
+    /* Once nobody holds the shared buffer either, give it back */
+    if ((RegRecPtr->ActiveBufferIndex == 0) &&
+        (CFE_ATOMIC_LOAD(&RegRecPtr->Buffers[1].Readers) == 0))
+    {
+        RegRecPtr->Buffers[1].BufferPtr = NULL;
+        CFE_TBL_TaskData.LoadBuffs[RegRecPtr->PublishedLoadBuff].Taken = FALSE;
+        RegRecPtr->PublishedLoadBuff = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    }
+#endif
+}   /* End of CFE_TBL_ReclaimBuffers() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_NotifyTblUsersOfUpdate
@@ -1254,8 +2023,9 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
         }
         else
         {
-            /* Verify the SubType to ensure that it is a Table Image File */
-            if (StdFileHeaderPtr->SubType != CFE_FS_TBL_IMG_SUBTYPE)
+            /* Verify the SubType to ensure that it is a Table Image File or a Table Patch File */
+            if ((StdFileHeaderPtr->SubType != CFE_FS_TBL_IMG_SUBTYPE) &&
+                (StdFileHeaderPtr->SubType != CFE_FS_TBL_PATCH_SUBTYPE))
             {
                 CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_SUBTYPE_ERR_EID,
                                            CFE_EVS_ERROR,
@@ -1438,10 +2208,17 @@ int32 CFE_TBL_CleanUpApp(uint32 AppId)
                 /* NOTE: Allocated memory is freed when all Access Links have been    */
                 /*       removed.  This allows Applications to continue to use the    */
                 /*       data until they acknowledge that the table has been removed. */
+                CFE_TBL_LockRegistry();
+
+                CFE_TBL_WaitForTaskValidation(RegRecPtr);
+
                 RegRecPtr->OwnerAppId = (uint32)CFE_TBL_NOT_OWNED;
 
                 /* Remove Table Name */
+                CFE_TBL_RemoveFromNameIndex(AccessDescPtr->RegIndex);
                 RegRecPtr->Name[0] = '\0';
+
+                CFE_TBL_UnlockRegistry();
             }
             
             /* Remove the Access Descriptor Link from linked list */
@@ -72,6 +72,7 @@
 #define CFE_TBL_NOT_OWNED               0xFFFFFFFF
 #define CFE_TBL_NOT_FOUND               (-1)
 #define CFE_TBL_END_OF_LIST             (CFE_TBL_Handle_t)0xFFFF
+#define CFE_TBL_NOT_LISTED              (-2)
 
 /*****************************  Function Prototypes   **********************************/
 
@@ -222,6 +223,69 @@ int32   CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle);
 int32   CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, uint32 ThisAppId);
 
 
+/*****************************************************************************/
+/**
+** \brief Releases the table buffer held through an access descriptor
+**
+** \par Description
+**        Clears the lock flag of the access descriptor.  When
+**        #CFE_TBL_LOCKLESS_ACCESS is TRUE, the descriptor's reader count on
+**        the buffer it was given by #CFE_TBL_GetAddressInternal is dropped
+**        with #CFE_TBL_UnpinBuffer.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Does nothing if the descriptor does not hold a buffer.
+**        -# Must be called without the registry locked.
+**
+** \param[in]  AccessDescPtr  Pointer to the access descriptor that holds the buffer
+**
+******************************************************************************/
+void    CFE_TBL_ReleaseBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Holds the active buffer of a table for reading
+**
+** \par Description
+**        When #CFE_TBL_LOCKLESS_ACCESS is TRUE, counts the caller as a reader
+**        of the table's active buffer, so the buffer is not overwritten or
+**        freed until #CFE_TBL_UnpinBuffer is called.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# When #CFE_TBL_LOCKLESS_ACCESS is FALSE, only the index of the
+**           active buffer is returned.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry of the table
+**
+** \retval Index of the buffer that is held
+**
+******************************************************************************/
+uint8   CFE_TBL_PinActiveBuffer(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Lets go of a buffer held with #CFE_TBL_PinActiveBuffer
+**
+** \par Description
+**        Drops the reader count taken by #CFE_TBL_PinActiveBuffer.  When the
+**        last reader lets go of a buffer that an update is waiting on, the
+**        update is finished with #CFE_TBL_ReclaimBuffers, so the shared buffer
+**        is given back without waiting for the owner to manage the table.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Does nothing when #CFE_TBL_LOCKLESS_ACCESS is FALSE.
+**        -# Must be called without the registry locked.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry of the table
+**
+** \param[in]  BufferIndex    Index returned by #CFE_TBL_PinActiveBuffer
+**
+******************************************************************************/
+void    CFE_TBL_UnpinBuffer(CFE_TBL_RegistryRec_t *RegRecPtr, uint8 BufferIndex);
+
+
 /*****************************************************************************/
 /**
 ** \brief Returns any pending non-error status code for the specified table.
@@ -252,7 +316,12 @@ int32   CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle);
 **        returns the appropriate Registry Index.
 **
 ** \par Assumptions, External Events, and Notes:
-**          None
+**        Note: This function assumes the registry has been locked.
+**        Only the name index chain of the given name is searched, so the
+**        name index must be current (see #CFE_TBL_IndexRegistry).  A record
+**        registered under a new name moves to another chain, and a search
+**        that is following its link without the lock can miss the rest of
+**        the chain it started on.
 **
 ** \param[in]  TblName - Pointer to character string containing complete
 **                       Table Name (of the format "AppName.TblName").
@@ -271,6 +340,9 @@ int16            CFE_TBL_FindTableInRegistry(const char *TblName);
 **
 ** \par Assumptions, External Events, and Notes:
 **        Note: This function assumes the registry has been locked.
+**        The slot is taken from the head of the registry free list and is
+**        left there until it is found to be in use by a later call.  The
+**        registry is only searched when the free list is empty.
 **
 ** \retval #CFE_TBL_NOT_FOUND or Index into Table Registry of unused entry                     
 ******************************************************************************/
@@ -285,11 +357,64 @@ int16            CFE_TBL_FindFreeRegistryEntry(void);
 **
 ** \par Assumptions, External Events, and Notes:
 **        Note: This function assumes the registry has been locked.
+**        The descriptor is taken from the head of the handle free list and
+**        is left there until it is found to be in use by a later call.  The
+**        handles are only searched when the free list is empty.
 **
 ** \retval #CFE_TBL_END_OF_LIST or Table Handle of unused Access Descriptor                     
 ******************************************************************************/
 CFE_TBL_Handle_t CFE_TBL_FindFreeHandle(void);
 
+/*****************************************************************************/
+/**
+** \brief Rebuilds the Table Registry name index and free lists.
+**
+** \par Description
+**        Enters every named Table Registry record in the name index and
+**        puts every free Table Registry record and Access Descriptor on
+**        its free list, lowest index first.
+**
+** \par Assumptions, External Events, and Notes:
+**        This function must be called whenever the Table Registry or the
+**        Access Descriptors are initialized without the use of the TBL API.
+**
+******************************************************************************/
+void CFE_TBL_IndexRegistry(void);
+
+/*****************************************************************************/
+/**
+** \brief Enters a Table Registry record in the name index.
+**
+** \par Description
+**        Adds the given Table Registry record to the name index chain of
+**        its current name, so it is found by #CFE_TBL_FindTableInRegistry.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**        A record that is already indexed is first removed from its chain.
+**
+** \param[in]  RegIndx - Index of the Table Registry record to be indexed.
+**
+******************************************************************************/
+void CFE_TBL_AddToNameIndex(int16 RegIndx);
+
+/*****************************************************************************/
+/**
+** \brief Removes a Table Registry record from the name index.
+**
+** \par Description
+**        Removes the given Table Registry record from the name index chain
+**        it was entered in.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.
+**        Records that are not indexed are ignored.
+**
+** \param[in]  RegIndx - Index of the Table Registry record to be removed.
+**
+******************************************************************************/
+void CFE_TBL_RemoveFromNameIndex(int16 RegIndx);
+
 
 /*****************************************************************************/
 /**
@@ -349,6 +474,26 @@ int32   CFE_TBL_LockRegistry(void);
 ******************************************************************************/
 int32   CFE_TBL_UnlockRegistry(void);
 
+/*****************************************************************************/
+/**
+** \brief Waits for the Table Services task to finish validating a table
+**
+** \par Description
+**        Returns once the Table Services task is not calling the validation
+**        function of the specified table, checking every
+**        #CFE_TBL_TASK_VALIDATION_DLY milliseconds.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the registry has been locked.  The
+**        registry is unlocked while waiting and locked again before returning,
+**        so the Table Services task cannot start another validation of the
+**        table until the caller unlocks it.
+**
+** \param[in]  RegRecPtr - Pointer to the Table Registry record of the table.
+**
+******************************************************************************/
+void    CFE_TBL_WaitForTaskValidation(CFE_TBL_RegistryRec_t *RegRecPtr);
+
 
 /*****************************************************************************/
 /**
@@ -394,6 +539,8 @@ int32   CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
 ** \par Description
 **        Locates the specified filename in the onboard filesystem
 **        and loads its contents into the specified working buffer.
+**        A table patch file (#CFE_FS_TBL_PATCH_SUBTYPE) is applied with
+**        #CFE_TBL_ApplyPatches and reported as a partial load.
 **
 ** \par Assumptions, External Events, and Notes:
 **        -# This function assumes parameters have been verified.
@@ -423,12 +570,81 @@ int32   CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
 ** \retval #CFE_TBL_ERR_NO_TBL_HEADER        \copydoc CFE_TBL_ERR_NO_TBL_HEADER       
 ** \retval #CFE_TBL_ERR_BAD_CONTENT_ID       \copydoc CFE_TBL_ERR_BAD_CONTENT_ID      
 ** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID       \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID      
+** \retval #CFE_TBL_ERR_BAD_PATCH            \copydoc CFE_TBL_ERR_BAD_PATCH
+** \retval #CFE_TBL_ERR_LOAD_INCOMPLETE      \copydoc CFE_TBL_ERR_LOAD_INCOMPLETE
 **                     
 ******************************************************************************/
 int32   CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr, 
                              CFE_TBL_RegistryRec_t *RegRecPtr, const char *Filename);
 
 
+/*****************************************************************************/
+/**
+** \brief Reads table data from an open table file into a table buffer
+**
+** \par Description
+**        Reads the data in pieces of at most #CFE_TBL_LOAD_CHUNK_SIZE bytes
+**        and continues the CRC with each piece as soon as it has been read,
+**        so the table data is only passed over once.  Reading stops early
+**        if the file ends or a read fails.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The file is positioned at the first byte to be read.
+**
+** \param[in]  FileDescriptor   File descriptor of the open table file
+**
+** \param[in]  BufferPtr        Pointer to where the first byte read is to be stored
+**
+** \param[in]  NumBytes         Number of bytes to be read
+**
+** \param[in, out]  CrcPtr      Pointer to the CRC of the table data that precedes
+**                              \c BufferPtr.  On return, it holds the CRC continued
+**                              through the last byte read.
+**
+** \returns The number of bytes read
+**                     
+******************************************************************************/
+uint32  CFE_TBL_ReadTableData(int32 FileDescriptor, uint8 *BufferPtr, uint32 NumBytes, uint32 *CrcPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Applies the patches in an open table patch file to a table buffer
+**
+** \par Description
+**        Reads each patch (see #CFE_TBL_PatchHdr_t) up to the end of the file
+**        and writes its bytes into the working buffer.  Rather than computing
+**        the CRC of the whole table again, the CRC of the working buffer is
+**        updated with the bytes each patch changes, so the cost of a patch
+**        load grows with the size of the patches rather than the size of the
+**        table.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The file is positioned at the first patch header.
+**        -# The working buffer holds a copy of the active table image, or a
+**           load that has not been activated yet, and the span given in the
+**           table file header lies within the table.
+**        -# The CRC of the working buffer is assumed to match its contents.
+**
+** \param[in]  FileDescriptor   File descriptor of the open table patch file
+**
+** \param[in]  WorkingBufferPtr Pointer to the working buffer the patches are applied to
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry Entry for table being patched
+**
+** \param[in]  TblFileHeaderPtr Pointer to the table file header read from the file
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_BAD_PATCH            \copydoc CFE_TBL_ERR_BAD_PATCH
+** \retval #CFE_TBL_ERR_LOAD_INCOMPLETE      \copydoc CFE_TBL_ERR_LOAD_INCOMPLETE
+**                     
+******************************************************************************/
+int32   CFE_TBL_ApplyPatches(int32 FileDescriptor,
+                             CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                             const CFE_TBL_RegistryRec_t *RegRecPtr,
+                             const CFE_TBL_File_Hdr_t *TblFileHeaderPtr);
+
+
 /*****************************************************************************/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -437,7 +653,9 @@ int32   CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
 **        Copies pertinent data from working buffer (inactive buffer)
 **        to the active buffer (for single buffered tables) or just
 **        changes index to identifying the active buffer (for double
-**        buffered tables).
+**        buffered tables).  When #CFE_TBL_LOCKLESS_ACCESS is TRUE, a
+**        single buffered table is updated by making the working buffer
+**        active, see #CFE_TBL_ReclaimBuffers.
 **
 ** \par Assumptions, External Events, and Notes:
 **        -# All parameters are assumed to be verified before function
@@ -456,6 +674,52 @@ int32   CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
                                 CFE_TBL_AccessDescriptor_t *AccessDescPtr );
 
 
+/*****************************************************************************/
+/**
+** \brief Finishes a single buffered table update that was waiting for readers
+**
+** \par Description
+**        When #CFE_TBL_LOCKLESS_ACCESS is TRUE, a single buffered table is
+**        updated by making its loaded shared buffer active.  Once no reader
+**        holds the table's own buffer, this function copies the new contents
+**        into it and makes it active again.  Once no reader holds the shared
+**        buffer either, the shared buffer is freed.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Must be called with the registry locked.
+**        -# Does nothing if no shared buffer is published for the table.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry of the table
+**
+******************************************************************************/
+void    CFE_TBL_ReclaimBuffers(CFE_TBL_RegistryRec_t *RegRecPtr);
+
+
+/*****************************************************************************/
+/**
+** \brief Performs a pending validation of a table
+**
+** \par Description
+**        Calls the table's validation function for the inactive buffer, or
+**        else the active buffer, that a Validate Table command asked to be
+**        validated, and saves the result for the Table Services task.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Called by #CFE_TBL_Validate in the context of the owning
+**           application, or by the Table Services task for tables registered
+**           with the #CFE_TBL_OPT_TASK_VALIDATE option.
+**
+** \param[in]  RegRecPtr      Pointer to Table Registry Entry of the table
+**
+** \param[in]  AppName        Name of the table's owner, used in event messages
+**
+** \retval #CFE_SUCCESS                        \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_INFO_NO_VALIDATION_PENDING \copydoc CFE_TBL_INFO_NO_VALIDATION_PENDING
+**
+******************************************************************************/
+int32   CFE_TBL_ValidateInternal(CFE_TBL_RegistryRec_t *RegRecPtr, const char *AppName);
+
+
 /*****************************************************************************/
 /**
 ** \brief Sets flags in access descriptors associated with specified table
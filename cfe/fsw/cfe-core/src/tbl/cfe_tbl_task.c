@@ -93,7 +93,9 @@ const CFE_TBL_CmdHandlerTblRec_t CFE_TBL_CmdHandlerTbl[] = {
 
 void CFE_TBL_TaskMain(void)
 {
-    int32  Status;
+    int32                Status;
+    int32                TimeOut;
+    CFE_TBL_CmdProcRet_t CmdStatus;
 
     CFE_ES_PerfLogEntry(CFE_TBL_MAIN_PERF_ID);
 
@@ -123,10 +125,21 @@ void CFE_TBL_TaskMain(void)
 
         CFE_ES_PerfLogExit(CFE_TBL_MAIN_PERF_ID);
 
-        /* Pend on receipt of packet */
+        /* Pend on receipt of packet, but only for a while when a table file is being loaded */
+        /* or dumped, or tables are waiting to be validated                                  */
+        if (CFE_TBL_TaskData.FileLoad.InProgress || CFE_TBL_TaskData.FileDump.InProgress ||
+            CFE_TBL_TaskData.TaskValidationPending)
+        {
+            TimeOut = CFE_TBL_LOAD_YIELD_MSEC;
+        }
+        else
+        {
+            TimeOut = CFE_SB_PEND_FOREVER;
+        }
+
         Status = CFE_SB_RcvMsg( &CFE_TBL_TaskData.MsgPtr,
                                 CFE_TBL_TaskData.CmdPipe,
-                                CFE_SB_PEND_FOREVER);
+                                TimeOut);
 
         CFE_ES_PerfLogEntry(CFE_TBL_MAIN_PERF_ID);
 
@@ -134,6 +147,40 @@ void CFE_TBL_TaskMain(void)
         {
             /* Process cmd pipe msg */
             CFE_TBL_TaskPipe(CFE_TBL_TaskData.MsgPtr);
+        }else if ((Status == CFE_SB_NO_MESSAGE) || (Status == CFE_SB_TIME_OUT)){
+            /* Command pipe is empty, so read the next piece of the table file */
+            CmdStatus = CFE_TBL_ContinueFileLoad();
+
+            /* Count the Load Table command once its load completes */
+            if (CmdStatus == CFE_TBL_INC_CMD_CTR)
+            {
+                CFE_TBL_TaskData.CmdCounter++;
+            }
+            else if (CmdStatus == CFE_TBL_INC_ERR_CTR)
+            {
+                CFE_TBL_TaskData.ErrCounter++;
+            }
+
+            /* Write the next piece of the table being dumped, and count the */
+            /* Dump Table command once its dump completes                     */
+            CmdStatus = CFE_TBL_ContinueFileDump();
+
+            if (CmdStatus == CFE_TBL_INC_CMD_CTR)
+            {
+                CFE_TBL_TaskData.CmdCounter++;
+            }
+            else if (CmdStatus == CFE_TBL_INC_ERR_CTR)
+            {
+                CFE_TBL_TaskData.ErrCounter++;
+            }
+
+            /* Then call the next validation function waiting for this task */
+            if (CFE_TBL_TaskData.TaskValidationPending)
+            {
+                CFE_TBL_ContinueValidation();
+            }
+
+            Status = CFE_SUCCESS;
         }else{
             CFE_ES_WriteToSysLog("TBL:Error reading cmd pipe,RC=0x%08X\n",(unsigned int)Status);
         }/* end if */
@@ -82,7 +82,8 @@
 /** \brief Value indicating when no load is in progress */
 /**
 **  This macro is used to indicate no Load is in Progress by assigning it to
-**  #CFE_TBL_RegistryRec_t::LoadInProgress 
+**  #CFE_TBL_RegistryRec_t::LoadInProgress.  It also marks that no shared buffer
+**  is published in #CFE_TBL_RegistryRec_t::PublishedLoadBuff.
 */ 
 #define CFE_TBL_NO_LOAD_IN_PROGRESS   (-1)
 
@@ -100,6 +101,20 @@
 */ 
 #define CFE_TBL_NO_DUMP_PENDING (-1) 
 
+/** \brief Number of chains in the Table Registry name index */
+/**
+**  Table names are hashed into twice as many chains as there are registry
+**  records so that a name lookup rarely compares more than one name.
+*/
+#define CFE_TBL_NAME_HASH_SIZE  (2 * CFE_TBL_MAX_NUM_TABLES)
+
+/** \brief Milliseconds between checks for a validation by the Table Services task to finish */
+/**
+**  A table cannot be unregistered while the Table Services task is calling its
+**  validation function, so the owner waits for the call to return.
+*/
+#define CFE_TBL_TASK_VALIDATION_DLY  1
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -165,6 +180,7 @@ typedef struct
     uint32         FileCreateTimeSecs;          /**< \brief File creation time from last file loaded into table */
     uint32         FileCreateTimeSubSecs;       /**< \brief File creation time from last file loaded into table */
     uint32         Crc;                         /**< \brief Last calculated CRC for this buffer's contents */
+    uint32         Readers;                     /**< \brief Number of handles holding the buffer's address (see #CFE_TBL_LOCKLESS_ACCESS) */
     boolean        Taken;                       /**< \brief Flag indicating whether buffer is in use */
     boolean        Validated;                   /**< \brief Flag indicating whether the buffer has been successfully validated */
     char           DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
@@ -204,11 +220,15 @@ typedef struct
     uint32                      Size;               /**< \brief Size, in bytes, of Table */
     uint32                      NotificationMsgId;  /**< \brief Message ID of an associated management notification message */
     uint32                      NotificationParam;  /**< \brief Parameter of an associated management notification message */
+    uint32                      Generation;         /**< \brief Number of times the record has been registered, so work spanning
+                                                                commands can tell the table was unregistered and registered again */
     CFE_TBL_LoadBuff_t          Buffers[2];         /**< \brief Active and Inactive Buffer Pointers */
     CFE_TBL_CallbackFuncPtr_t   ValidationFuncPtr;  /**< \brief Ptr to Owner App's function that validates tbl contents */
     CFE_TIME_SysTime_t          TimeOfLastUpdate;   /**< \brief Time when Table was last updated */
     CFE_TBL_Handle_t            HeadOfAccessList;   /**< \brief Index into Handles Array that starts Access Linked List */
     int32                       LoadInProgress;     /**< \brief Flag identifies inactive buffer and whether load in progress */
+    int32                       PublishedLoadBuff;  /**< \brief Index of the shared buffer made active by a single buffered
+                                                                update that is still waiting for its readers */
     int32                       ValidateActiveIndex;    /**< \brief Index to Validation Request on Active Table Result data */
     int32                       ValidateInactiveIndex;  /**< \brief Index to Validation Request on Inactive Table Result data */
     int32                       DumpControlIndex;       /**< \brief Index to Dump Control Block */
@@ -222,6 +242,8 @@ typedef struct
     boolean                     UserDefAddr;        /**< \brief Flag indicating Table address was defined by Owner Application */
     boolean                     NotifyByMsg;        /**< \brief Flag indicating Table Services should notify owning App via message
                                                                 when table requires management */ 
+    boolean                     TaskValidation;     /**< \brief Flag indicating the Table Services task calls the validation function */
+    boolean                     TaskValidating;     /**< \brief Flag indicating the Table Services task is calling the validation function */
     uint8                       ActiveBufferIndex;  /**< \brief Index identifying which buffer is the active buffer */
     char                        Name[CFE_TBL_MAX_FULL_NAME_LEN];   /**< \brief Processor specific table name */
     char                        LastFileLoaded[OS_MAX_PATH_LEN];   /**< \brief Filename of last file loaded into table */
@@ -261,6 +283,53 @@ typedef struct
 } CFE_TBL_DumpControl_t;
 
 
+/*******************************************************************************/
+/**   \brief File Load Control Block
+**
+**    This structure holds the state of a Load Table command whose file
+**    is read in pieces of #CFE_TBL_LOAD_CHUNK_SIZE bytes.
+*/
+typedef struct 
+{
+    boolean                   InProgress;             /**< \brief Flag indicating a table file is being read */
+    int32                     FileDescriptor;         /**< \brief File descriptor of the table file being read */
+    CFE_TBL_RegistryRec_t    *RegRecPtr;              /**< \brief Ptr to loaded table's registry record */
+    uint32                    Generation;             /**< \brief Registration generation of the table when the load started */
+    CFE_TBL_LoadBuff_t       *WorkingBufferPtr;       /**< \brief Working buffer being loaded */
+    uint8                    *BufferPtr;              /**< \brief Working buffer data address when the load started */
+    uint32                    NextOffset;             /**< \brief Table offset of the next byte to be read */
+    uint32                    EndOffset;              /**< \brief Table offset following the last byte of the file */
+    uint32                    NumBytes;               /**< \brief Number of bytes of table data in the file */
+    uint32                    Crc;                    /**< \brief CRC of the table data preceding NextOffset */
+    uint32                    FileCreateTimeSecs;     /**< \brief File creation time from the file being read */
+    uint32                    FileCreateTimeSubSecs;  /**< \brief File creation time from the file being read */
+    char                      LoadFilename[OS_MAX_PATH_LEN];        /**< \brief Name of the file being read */
+    char                      TableName[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Name of Table being loaded */
+} CFE_TBL_FileLoad_t;
+
+
+/*******************************************************************************/
+/**   \brief File Dump Control Block
+**
+**    This structure holds the state of a Dump Table command whose table
+**    data is written in pieces of #CFE_TBL_DUMP_CHUNK_SIZE bytes.
+*/
+typedef struct 
+{
+    boolean                   InProgress;             /**< \brief Flag indicating a table is being dumped */
+    boolean                   FileExistedPrev;        /**< \brief Flag indicating the dump file was overwritten */
+    uint8                     BufferIndex;            /**< \brief Index of the pinned table buffer being dumped */
+    int32                     FileDescriptor;         /**< \brief File descriptor of the dump file being written */
+    CFE_TBL_RegistryRec_t    *RegRecPtr;              /**< \brief Ptr to dumped table's registry record */
+    uint32                    Generation;             /**< \brief Registration generation of the table when the dump started */
+    uint8                    *BufferPtr;              /**< \brief Table buffer data address when the dump started */
+    uint32                    NextOffset;             /**< \brief Table offset of the next byte to be written */
+    uint32                    NumBytes;               /**< \brief Number of bytes of table data to be written */
+    char                      DumpFilename[OS_MAX_PATH_LEN];        /**< \brief Name of the file being written */
+    char                      TableName[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Name of Table being dumped */
+} CFE_TBL_FileDump_t;
+
+
 /*******************************************************************************/
 /**   \brief Table Registry Dump Record
 **
@@ -354,6 +423,20 @@ typedef struct
   CFE_TBL_BufParams_t         Buf;                               /**< \brief Parameters associated with Table Task's Memory Pool */
   CFE_TBL_ValidationResult_t  ValidationResults[CFE_TBL_MAX_NUM_VALIDATIONS]; /**< \brief Array of Table Validation Requests */
   CFE_TBL_DumpControl_t       DumpControlBlocks[CFE_TBL_MAX_SIMULTANEOUS_LOADS]; /**< \brief Array of Dump-Only Dump Control Blocks */
+  CFE_TBL_FileLoad_t          FileLoad;                          /**< \brief Table file load read between commands */
+  CFE_TBL_FileDump_t          FileDump;                          /**< \brief Table dump written between commands */
+  boolean                     TaskValidationPending;             /**< \brief Flag indicating validations are left for the Table Services task */
+
+  /*
+  ** Registry Indexes
+  */
+  int16                       NameHash[CFE_TBL_NAME_HASH_SIZE];  /**< \brief First Registry Index of each name hash chain */
+  int16                       NameHashLinks[CFE_TBL_MAX_NUM_TABLES]; /**< \brief Next Registry Index in the same name hash chain */
+  uint16                      NameHashSlot[CFE_TBL_MAX_NUM_TABLES];  /**< \brief Name hash chain each Registry Index is in */
+  int16                       FreeRegistryHead;                  /**< \brief First Registry Index on the free list */
+  int16                       FreeRegistryLinks[CFE_TBL_MAX_NUM_TABLES]; /**< \brief Next Registry Index on the free list */
+  CFE_TBL_Handle_t            FreeHandleHead;                    /**< \brief First Access Descriptor on the free list */
+  CFE_TBL_Handle_t            FreeHandleLinks[CFE_TBL_MAX_NUM_HANDLES]; /**< \brief Next Access Descriptor on the free list */
 
 } CFE_TBL_TaskData_t;
 
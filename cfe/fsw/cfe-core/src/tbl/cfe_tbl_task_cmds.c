@@ -225,6 +225,18 @@ void CFE_TBL_GetHkData(void)
         }
     }
 
+    /* Report the progress of a table dump written between commands */
+    if (CFE_TBL_TaskData.FileDump.InProgress)
+    {
+        CFE_TBL_TaskData.HkPacket.Payload.DumpBytesWritten = CFE_TBL_TaskData.FileDump.NextOffset;
+        CFE_TBL_TaskData.HkPacket.Payload.DumpBytesTotal = CFE_TBL_TaskData.FileDump.NumBytes;
+    }
+    else
+    {
+        CFE_TBL_TaskData.HkPacket.Payload.DumpBytesWritten = 0;
+        CFE_TBL_TaskData.HkPacket.Payload.DumpBytesTotal = 0;
+    }
+
     /* Locate a completed, but unreported, validation request */
     i=0;
     while ((i < CFE_TBL_MAX_NUM_VALIDATIONS) && (ValPtr == NULL))
@@ -410,7 +422,8 @@ CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
     CFE_TBL_RegistryRec_t      *RegRecPtr;
     CFE_TBL_LoadBuff_t         *WorkingBufferPtr;
     char                        LoadFilename[OS_MAX_PATH_LEN];
-    uint8                       ExtraByte;
+    CFE_TBL_FileLoad_t         *LoadPtr = &CFE_TBL_TaskData.FileLoad;
+    boolean                     FileTaken = FALSE;
 
     /* Make sure all strings are null terminated before attempting to process them */
     CFE_SB_MessageStringGet(LoadFilename, (char *)CmdPtr->LoadFilename, NULL,
@@ -426,7 +439,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
         if (Status == CFE_SUCCESS)
         {
             /* Locate specified table in registry */
+            CFE_TBL_LockRegistry();
             Status = CFE_TBL_FindTableInRegistry(TblFileHeader.TableName);
+            CFE_TBL_UnlockRegistry();
 
             if (Status == CFE_TBL_NOT_FOUND)
             {
@@ -454,87 +469,86 @@ CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
                                       "Attempted to load table '%s' while previous load is still pending",
                                       TblFileHeader.TableName);
                 }
+                else if (LoadPtr->InProgress)
+                {
+                    /* Only one table file is read at a time */
+                    CFE_EVS_SendEvent(CFE_TBL_LOAD_BUSY_ERR_EID,
+                                      CFE_EVS_ERROR,
+                                      "Cannot load '%s' while '%s' is being loaded from '%s'",
+                                      TblFileHeader.TableName, LoadPtr->TableName, LoadPtr->LoadFilename);
+                }
                 else
                 {
                     /* Make sure of the following:                                               */
                     /*    1) If table has not been loaded previously, then make sure the current */
-                    /*       load starts with the first byte                                     */
+                    /*       load starts with the first byte and is not a patch                  */
                     /*    2) The number of bytes to load is greater than zero                    */
                     /*    3) The offset plus the number of bytes does not exceed the table size  */
-                    if (((RegRecPtr->TableLoadedOnce) || (TblFileHeader.Offset == 0)) &&
+                    if (((RegRecPtr->TableLoadedOnce) ||
+                         ((TblFileHeader.Offset == 0) && (StdFileHeader.SubType != CFE_FS_TBL_PATCH_SUBTYPE))) &&
                         (TblFileHeader.NumBytes > 0) &&
                         ((TblFileHeader.NumBytes + TblFileHeader.Offset) <= RegRecPtr->Size))
                     {
+                        /* The buffer is claimed and the load set up under the registry lock, so the */
+                        /* owner's CFE_TBL_Load sees the load in progress and stays out of the buffer */
+                        CFE_TBL_LockRegistry();
+
                         /* Get a working buffer, either a free one or one allocated with previous load command */
                         Status = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, FALSE);
 
-                        if (Status == CFE_SUCCESS)
+                        if ((Status == CFE_SUCCESS) && (StdFileHeader.SubType == CFE_FS_TBL_PATCH_SUBTYPE))
                         {
-                            /* Copy data from file into working buffer */
-                            Status = OS_read(FileDescriptor,
-                                             &WorkingBufferPtr->BufferPtr[TblFileHeader.Offset],
-                                             TblFileHeader.NumBytes);
-                                    
-                            /* Make sure the appropriate number of bytes were read */
-                            if (Status == (int32)TblFileHeader.NumBytes)
+                            /* The image cannot be activated unless every patch has been applied */
+                            WorkingBufferPtr->Validated = FALSE;
+
+                            /* Patches only carry the bytes that change, so they are applied all at once */
+                            Status = CFE_TBL_ApplyPatches(FileDescriptor, WorkingBufferPtr, RegRecPtr, &TblFileHeader);
+
+                            if (Status == CFE_SUCCESS)
                             {
-                                /* Check to ensure the file does not have any extra data at the end */
-                                Status = OS_read(FileDescriptor, &ExtraByte, 1);
-
-                                /* If another byte was successfully read, then file contains more data than header claims */
-                                if (Status == 1)
-                                {
-                                    CFE_EVS_SendEvent(CFE_TBL_FILE_TOO_BIG_ERR_EID,
-                                                      CFE_EVS_ERROR,
-                                                      "File '%s' has more data than Tbl Hdr indicates (%d)",
-                                                      LoadFilename,
-                                                      (int)TblFileHeader.NumBytes);
-                                }
-                                else /* If error reading file or zero bytes read, assume it was the perfect size */
-                                {
-                                    CFE_EVS_SendEvent(CFE_TBL_FILE_LOADED_INF_EID,
-                                                      CFE_EVS_INFORMATION,
-                                                      "Successful load of '%s' into '%s' working buffer",
-                                                      LoadFilename,
-                                                      TblFileHeader.TableName);
-
-                                    /* Save file information statistics for later use in registry */
-                                    CFE_PSP_MemCpy(WorkingBufferPtr->DataSource, LoadFilename, OS_MAX_PATH_LEN);
-
-                                    /* Save file creation time for later storage into Registry */
-                                    WorkingBufferPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
-                                    WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
-                                    
-                                    /* Compute the CRC on the specified table buffer */
-                                    WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                                                RegRecPtr->Size,
-                                                                                0,
-                                                                                CFE_ES_DEFAULT_CRC);
-                                    
-                                    /* Initialize validation flag with TRUE if no Validation Function is required to be called */
-                                    WorkingBufferPtr->Validated = (RegRecPtr->ValidationFuncPtr == NULL);
-                            
-                                    /* Save file information statistics for housekeeping telemetry */
-                                    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastFileLoaded, LoadFilename,
-                                            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileLoaded));
-                                    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastTableLoaded, TblFileHeader.TableName,
-                                            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastTableLoaded));
-
-                                    /* Increment successful command completion counter */
-                                    ReturnCode = CFE_TBL_INC_CMD_CTR;
-                                }
+                                CFE_TBL_FinishFileLoad(RegRecPtr, WorkingBufferPtr, LoadFilename,
+                                                       StdFileHeader.TimeSeconds, StdFileHeader.TimeSubSeconds);
+
+                                /* Increment successful command completion counter */
+                                ReturnCode = CFE_TBL_INC_CMD_CTR;
                             }
                             else
                             {
-                                /* A file whose header claims has 'x' amount of data but it only has 'y' */
-                                /* is considered a fatal error during a load process                     */
-                                CFE_EVS_SendEvent(CFE_TBL_FILE_INCOMPLETE_ERR_EID,
+                                CFE_EVS_SendEvent(CFE_TBL_PATCH_ERR_EID,
                                                   CFE_EVS_ERROR,
-                                                  "Incomplete load of '%s' into '%s' working buffer",
-                                                  LoadFilename,
-                                                  TblFileHeader.TableName);
+                                                  "Unable to patch '%s' from '%s', Status = 0x%08X",
+                                                  TblFileHeader.TableName, LoadFilename, (unsigned int)Status);
                             }
                         }
+                        else if (Status == CFE_SUCCESS)
+                        {
+                            /* Set up the load, which CFE_TBL_ContinueFileLoad reads one piece at a time */
+                            LoadPtr->InProgress = TRUE;
+                            LoadPtr->FileDescriptor = FileDescriptor;
+                            LoadPtr->RegRecPtr = RegRecPtr;
+                            LoadPtr->Generation = RegRecPtr->Generation;
+                            LoadPtr->WorkingBufferPtr = WorkingBufferPtr;
+                            LoadPtr->BufferPtr = WorkingBufferPtr->BufferPtr;
+                            LoadPtr->NextOffset = TblFileHeader.Offset;
+                            LoadPtr->EndOffset = TblFileHeader.Offset + TblFileHeader.NumBytes;
+                            LoadPtr->NumBytes = TblFileHeader.NumBytes;
+                            LoadPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
+                            LoadPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
+                            CFE_PSP_MemCpy(LoadPtr->LoadFilename, LoadFilename, OS_MAX_PATH_LEN);
+                            CFE_PSP_MemCpy(LoadPtr->TableName, RegRecPtr->Name, CFE_TBL_MAX_FULL_NAME_LEN);
+
+                            /* Start the CRC with the table data that precedes the data in the file */
+                            LoadPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
+                                                               TblFileHeader.Offset,
+                                                               0,
+                                                               CFE_ES_DEFAULT_CRC);
+
+                            /* The image cannot be activated until it has been completely loaded */
+                            WorkingBufferPtr->Validated = FALSE;
+
+                            /* The load now owns the file and closes it when it completes */
+                            FileTaken = TRUE;
+                        }
                         else if (Status == CFE_TBL_ERR_NO_BUFFER_AVAIL)
                         {
                             CFE_EVS_SendEvent(CFE_TBL_NO_WORK_BUFFERS_ERR_EID,
@@ -549,6 +563,23 @@ CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
                                               "Internal Error (Status=0x%08X)",
                                               (unsigned int)Status);
                         }
+
+                        CFE_TBL_UnlockRegistry();
+
+                        if (FileTaken)
+                        {
+                            ReturnCode = CFE_TBL_ContinueFileLoad();
+
+                            if (LoadPtr->InProgress)
+                            {
+                                CFE_EVS_SendEvent(CFE_TBL_FILE_LOADING_INF_EID,
+                                                  CFE_EVS_DEBUG,
+                                                  "Loading '%s' into '%s' working buffer (%d bytes)",
+                                                  LoadFilename,
+                                                  TblFileHeader.TableName,
+                                                  (int)TblFileHeader.NumBytes);
+                            }
+                        }
                     }
                     else
                     {
@@ -580,8 +611,11 @@ CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
         }  /* No need to issue event messages in response to errors reading headers */
            /* because the function that read the headers will generate messages     */
 
-        /* Close the file now that the contents have been read */
-        OS_close(FileDescriptor);
+        /* Close the file now that the contents have been read, unless the load still needs it */
+        if (!FileTaken)
+        {
+            OS_close(FileDescriptor);
+        }
     }
     else
     {
@@ -597,6 +631,216 @@ CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
 } /* End of CFE_TBL_LoadCmd() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_ContinueFileLoad() -- Read the next piece of a table file being loaded
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+CFE_TBL_CmdProcRet_t CFE_TBL_ContinueFileLoad( void )
+{
+    CFE_TBL_CmdProcRet_t        ReturnCode = CFE_TBL_INC_ERR_CTR;        /* Assume failure */
+    CFE_TBL_FileLoad_t         *LoadPtr = &CFE_TBL_TaskData.FileLoad;
+    CFE_TBL_RegistryRec_t      *RegRecPtr = LoadPtr->RegRecPtr;
+    CFE_TBL_LoadBuff_t         *WorkingBufferPtr = LoadPtr->WorkingBufferPtr;
+    uint32                      NumBytes;
+    uint32                      BytesRead;
+    uint8                       ExtraByte;
+    boolean                     LoadDone = TRUE;
+
+    /* The registry stays locked from the check until the file data is in the buffer, */
+    /* so the buffer cannot be released or taken by another load while it is written  */
+    CFE_TBL_LockRegistry();
+
+    if (!LoadPtr->InProgress)
+    {
+        /* No table file is being loaded */
+        LoadDone = FALSE;
+        ReturnCode = CFE_TBL_DONT_INC_CTR;
+    }
+    else if ((RegRecPtr->Generation != LoadPtr->Generation) ||
+             (RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS) ||
+             (WorkingBufferPtr->BufferPtr != LoadPtr->BufferPtr) ||
+             (strcmp(RegRecPtr->Name, LoadPtr->TableName) != 0))
+    {
+        /* The buffer being loaded was released since the last piece was read, */
+        /* even if the table has since been registered again under that name  */
+        CFE_EVS_SendEvent(CFE_TBL_LOAD_STOPPED_ERR_EID,
+                          CFE_EVS_ERROR,
+                          "Load of '%s' from '%s' stopped, working buffer was released",
+                          LoadPtr->TableName,
+                          LoadPtr->LoadFilename);
+    }
+    else
+    {
+        NumBytes = LoadPtr->EndOffset - LoadPtr->NextOffset;
+        if (NumBytes > CFE_TBL_LOAD_CHUNK_SIZE)
+        {
+            NumBytes = CFE_TBL_LOAD_CHUNK_SIZE;
+        }
+
+        BytesRead = CFE_TBL_ReadTableData(LoadPtr->FileDescriptor,
+                                          &WorkingBufferPtr->BufferPtr[LoadPtr->NextOffset],
+                                          NumBytes,
+                                          &LoadPtr->Crc);
+        LoadPtr->NextOffset += BytesRead;
+
+        if (BytesRead != NumBytes)
+        {
+            /* A file whose header claims has 'x' amount of data but it only has 'y' */
+            /* is considered a fatal error during a load process                     */
+            CFE_EVS_SendEvent(CFE_TBL_FILE_INCOMPLETE_ERR_EID,
+                              CFE_EVS_ERROR,
+                              "Incomplete load of '%s' into '%s' working buffer",
+                              LoadPtr->LoadFilename,
+                              LoadPtr->TableName);
+        }
+        else if (LoadPtr->NextOffset < LoadPtr->EndOffset)
+        {
+            /* The rest of the file is read the next time the command pipe is empty */
+            LoadDone = FALSE;
+            ReturnCode = CFE_TBL_DONT_INC_CTR;
+        }
+        else
+        {
+            /* Check to ensure the file does not have any extra data at the end */
+            /* If another byte was successfully read, then file contains more data than header claims */
+            if (OS_read(LoadPtr->FileDescriptor, &ExtraByte, 1) == 1)
+            {
+                CFE_EVS_SendEvent(CFE_TBL_FILE_TOO_BIG_ERR_EID,
+                                  CFE_EVS_ERROR,
+                                  "File '%s' has more data than Tbl Hdr indicates (%d)",
+                                  LoadPtr->LoadFilename,
+                                  (int)LoadPtr->NumBytes);
+            }
+            else /* If error reading file or zero bytes read, assume it was the perfect size */
+            {
+                /* Finish the CRC with the table data that follows the data in the file */
+                WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(&WorkingBufferPtr->BufferPtr[LoadPtr->EndOffset],
+                                                            RegRecPtr->Size - LoadPtr->EndOffset,
+                                                            LoadPtr->Crc,
+                                                            CFE_ES_DEFAULT_CRC);
+
+                CFE_TBL_FinishFileLoad(RegRecPtr, WorkingBufferPtr, LoadPtr->LoadFilename,
+                                       LoadPtr->FileCreateTimeSecs, LoadPtr->FileCreateTimeSubSecs);
+
+                /* Increment successful command completion counter */
+                ReturnCode = CFE_TBL_INC_CMD_CTR;
+            }
+        }
+    }
+
+    CFE_TBL_UnlockRegistry();
+
+    if (LoadDone)
+    {
+        /* Close the file now that the contents have been read */
+        OS_close(LoadPtr->FileDescriptor);
+        LoadPtr->FileDescriptor = -1;
+        LoadPtr->InProgress = FALSE;
+    }
+
+    return ReturnCode;
+
+} /* End of CFE_TBL_ContinueFileLoad() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_FinishFileLoad() -- Record a table file completely loaded into a working buffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+void CFE_TBL_FinishFileLoad( CFE_TBL_RegistryRec_t *RegRecPtr,
+                             CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                             const char *LoadFilename,
+                             uint32 FileCreateTimeSecs,
+                             uint32 FileCreateTimeSubSecs )
+{
+    CFE_EVS_SendEvent(CFE_TBL_FILE_LOADED_INF_EID,
+                      CFE_EVS_INFORMATION,
+                      "Successful load of '%s' into '%s' working buffer",
+                      LoadFilename,
+                      RegRecPtr->Name);
+
+    /* Save file information statistics for later use in registry */
+    CFE_PSP_MemCpy(WorkingBufferPtr->DataSource, (void *)LoadFilename, OS_MAX_PATH_LEN);
+
+    /* Save file creation time for later storage into Registry */
+    WorkingBufferPtr->FileCreateTimeSecs = FileCreateTimeSecs;
+    WorkingBufferPtr->FileCreateTimeSubSecs = FileCreateTimeSubSecs;
+
+    /* Initialize validation flag with TRUE if no Validation Function is required to be called */
+    WorkingBufferPtr->Validated = (RegRecPtr->ValidationFuncPtr == NULL);
+
+    /* Save file information statistics for housekeeping telemetry */
+    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastFileLoaded, LoadFilename,
+            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileLoaded));
+    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastTableLoaded, RegRecPtr->Name,
+            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastTableLoaded));
+
+} /* End of CFE_TBL_FinishFileLoad() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ContinueValidation() -- Perform the next validation left for the Table Services task
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+void CFE_TBL_ContinueValidation( void )
+{
+    CFE_TBL_RegistryRec_t      *RegRecPtr;
+    char                        AppName[OS_MAX_API_NAME];
+    int16                       RegIndex = 0;
+    boolean                     Validated = FALSE;
+
+    /* Validate one table per call, so commands are not held up by a run of validations */
+    while ((RegIndex < CFE_TBL_MAX_NUM_TABLES) && (!Validated))
+    {
+        RegRecPtr = &CFE_TBL_TaskData.Registry[RegIndex];
+
+        /* Mark the table under the registry lock, so the owner neither unregisters */
+        /* it nor loads it while its validation function is being called            */
+        CFE_TBL_LockRegistry();
+
+        if ((RegRecPtr->OwnerAppId != CFE_TBL_NOT_OWNED) && (RegRecPtr->TaskValidation) &&
+            ((RegRecPtr->ValidateInactiveIndex != CFE_TBL_NO_VALIDATION_PENDING) ||
+             (RegRecPtr->ValidateActiveIndex != CFE_TBL_NO_VALIDATION_PENDING)))
+        {
+            RegRecPtr->TaskValidating = TRUE;
+            Validated = TRUE;
+        }
+
+        CFE_TBL_UnlockRegistry();
+
+        if (Validated)
+        {
+            /* Report the result in the name of the table's owner, as the owner would have */
+            CFE_ES_GetAppName(AppName, RegRecPtr->OwnerAppId, OS_MAX_API_NAME);
+
+            CFE_TBL_ValidateInternal(RegRecPtr, AppName);
+
+            CFE_TBL_LockRegistry();
+            RegRecPtr->TaskValidating = FALSE;
+            CFE_TBL_UnlockRegistry();
+        }
+
+        RegIndex++;
+    }
+
+    /* Once nothing is left to validate, go back to waiting for commands */
+    if (!Validated)
+    {
+        CFE_TBL_TaskData.TaskValidationPending = FALSE;
+    }
+
+} /* End of CFE_TBL_ContinueValidation() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_DumpCmd() -- Process Dump Table to File Command Message
@@ -626,7 +870,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table that is to be dumped exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -640,8 +886,16 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
         }
         else if (CmdPtr->ActiveTblFlag == CFE_TBL_INACTIVE_BUFFER)/* Dumping Inactive Buffer */
         {
+            /* An inactive buffer that is still being loaded from a file is incomplete */
+            if (CFE_TBL_TaskData.FileLoad.InProgress && (CFE_TBL_TaskData.FileLoad.RegRecPtr == RegRecPtr))
+            {
+                CFE_EVS_SendEvent(CFE_TBL_INACTIVE_LOADING_ERR_EID,
+                                  CFE_EVS_ERROR,
+                                  "Inactive buffer of '%s' is still being loaded from '%s'",
+                                  TableName, CFE_TBL_TaskData.FileLoad.LoadFilename);
+            }
             /* If this is a double buffered table, locating the inactive buffer is trivial */
-            if (RegRecPtr->DblBuffered)
+            else if (RegRecPtr->DblBuffered)
             {
                 DumpDataAddr = RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].BufferPtr;
             }
@@ -676,7 +930,17 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
             /* If this is not a dump only table, then we can perform the dump immediately */
             if (!RegRecPtr->DumpOnly)
             {
-                ReturnCode = CFE_TBL_DumpToFile(DumpFilename, TableName, DumpDataAddr, RegRecPtr->Size);
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+                /* A large active buffer is pinned and written a piece at a time between commands */
+                if ((CmdPtr->ActiveTblFlag == CFE_TBL_ACTIVE_BUFFER) && (RegRecPtr->Size > CFE_TBL_DUMP_CHUNK_SIZE))
+                {
+                    ReturnCode = CFE_TBL_StartFileDump(DumpFilename, TableName, RegRecPtr);
+                }
+                else
+#endif
+                {
+                    ReturnCode = CFE_TBL_DumpToFile(DumpFilename, TableName, DumpDataAddr, RegRecPtr->Size);
+                }
             }
             else /* Dump Only tables need to synchronize their dumps with the owner's execution */
             {
@@ -766,12 +1030,60 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
 {
     CFE_TBL_CmdProcRet_t        ReturnCode = CFE_TBL_INC_ERR_CTR;        /* Assume failure */
     boolean                     FileExistedPrev = FALSE;
+    int32                       FileDescriptor;
+    int32                       Status;
+
+    /* Create the dump file and output its headers */
+    FileDescriptor = CFE_TBL_CreateDumpFile(DumpFilename, TableName, TblSizeInBytes, &FileExistedPrev);
+
+    if (FileDescriptor >= OS_FS_SUCCESS)
+    {
+        /* Output the requested data to the dump file */
+        Status = OS_write(FileDescriptor,
+                          DumpDataAddr,
+                          TblSizeInBytes);
+
+        if (Status == (int32)TblSizeInBytes)
+        {
+            CFE_TBL_FinishFileDump(DumpFilename, TableName, FileExistedPrev);
+
+            /* Increment Successful Command Counter */
+            ReturnCode = CFE_TBL_INC_CMD_CTR;
+        }
+        else
+        {
+            CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_IMG_ERR_EID,
+                              CFE_EVS_ERROR,
+                              "Error writing Tbl image to '%s', Status=0x%08X",
+                              DumpFilename, (unsigned int)Status);
+        }
+
+        /* We are done outputting data to the dump file.  Close it. */
+        OS_close(FileDescriptor);
+    }
+    
+    return ReturnCode;
+}
+
+
+/*******************************************************************
+**
+** CFE_TBL_CreateDumpFile() -- Create a dump file and write its headers
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+int32 CFE_TBL_CreateDumpFile( const char *DumpFilename, const char *TableName, uint32 TblSizeInBytes,
+                              boolean *FileExistedPrevPtr )
+{
     CFE_FS_Header_t             StdFileHeader;
     CFE_TBL_File_Hdr_t          TblFileHeader;
     int32                       FileDescriptor;
     int32                       Status;
     int32                       EndianCheck = 0x01020304;
     
+    *FileExistedPrevPtr = FALSE;
+
     /* Clear Header of any garbage before copying content */
     CFE_PSP_MemSet(&TblFileHeader, 0, sizeof(CFE_TBL_File_Hdr_t));
 
@@ -780,7 +1092,7 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
 
     if (FileDescriptor >= 0)
     {
-        FileExistedPrev = TRUE;
+        *FileExistedPrevPtr = TRUE;
 
         OS_close(FileDescriptor);
     }
@@ -818,47 +1130,7 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
             Status = OS_write(FileDescriptor, &TblFileHeader, sizeof(CFE_TBL_File_Hdr_t));
 
             /* Make sure the header was output completely */
-            if (Status == sizeof(CFE_TBL_File_Hdr_t))
-            {
-                /* Output the requested data to the dump file */
-                /* Output the active table image data to the dump file */
-                Status = OS_write(FileDescriptor,
-                                  DumpDataAddr,
-                                  TblSizeInBytes);
-
-                if (Status == (int32)TblSizeInBytes)
-                {
-                    if (FileExistedPrev)
-                    {
-                        CFE_EVS_SendEvent(CFE_TBL_OVERWRITE_DUMP_INF_EID,
-                                          CFE_EVS_INFORMATION,
-                                          "Successfully overwrote '%s' with Table '%s'",
-                                          DumpFilename, TableName);
-                    }
-                    else
-                    {
-                        CFE_EVS_SendEvent(CFE_TBL_WRITE_DUMP_INF_EID,
-                                          CFE_EVS_INFORMATION,
-                                          "Successfully dumped Table '%s' to '%s'",
-                                          TableName, DumpFilename);
-                    }
-
-                    /* Save file information statistics for housekeeping telemetry */
-                    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped, DumpFilename,
-                            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped));
-
-                    /* Increment Successful Command Counter */
-                    ReturnCode = CFE_TBL_INC_CMD_CTR;
-                }
-                else
-                {
-                    CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_IMG_ERR_EID,
-                                      CFE_EVS_ERROR,
-                                      "Error writing Tbl image to '%s', Status=0x%08X",
-                                      DumpFilename, (unsigned int)Status);
-                }
-            }
-            else
+            if (Status != sizeof(CFE_TBL_File_Hdr_t))
             {
                 CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_HDR_ERR_EID,
                                   CFE_EVS_ERROR,
@@ -874,8 +1146,12 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
                               DumpFilename, (unsigned int)Status);
         }
 
-        /* We are done outputting data to the dump file.  Close it. */
-        OS_close(FileDescriptor);
+        /* The table data cannot follow headers that were not output completely */
+        if (Status != sizeof(CFE_TBL_File_Hdr_t))
+        {
+            OS_close(FileDescriptor);
+            FileDescriptor = OS_FS_ERROR;
+        }
     }
     else
     {
@@ -885,9 +1161,197 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *T
                           DumpFilename, (unsigned int)FileDescriptor);
     }
     
-    return ReturnCode;
+    return FileDescriptor;
 }
 
+
+/*******************************************************************
+**
+** CFE_TBL_StartFileDump() -- Begin writing a pinned active buffer to a file
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+CFE_TBL_CmdProcRet_t CFE_TBL_StartFileDump( const char *DumpFilename, const char *TableName,
+                                            CFE_TBL_RegistryRec_t *RegRecPtr )
+{
+    CFE_TBL_CmdProcRet_t        ReturnCode = CFE_TBL_INC_ERR_CTR;        /* Assume failure */
+    CFE_TBL_FileDump_t         *DumpPtr = &CFE_TBL_TaskData.FileDump;
+    int32                       FileDescriptor;
+
+    if (DumpPtr->InProgress)
+    {
+        /* Only one table is written a piece at a time */
+        CFE_EVS_SendEvent(CFE_TBL_DUMP_BUSY_ERR_EID,
+                          CFE_EVS_ERROR,
+                          "Cannot dump '%s' while '%s' is being dumped to '%s'",
+                          TableName, DumpPtr->TableName, DumpPtr->DumpFilename);
+    }
+    else
+    {
+        FileDescriptor = CFE_TBL_CreateDumpFile(DumpFilename, TableName, RegRecPtr->Size, &DumpPtr->FileExistedPrev);
+
+        if (FileDescriptor >= OS_FS_SUCCESS)
+        {
+            /* Keep table updates from overwriting the active buffer until all of it has been written */
+            DumpPtr->BufferIndex = CFE_TBL_PinActiveBuffer(RegRecPtr);
+
+            /* Set up the dump, which CFE_TBL_ContinueFileDump writes one piece at a time */
+            DumpPtr->InProgress = TRUE;
+            DumpPtr->FileDescriptor = FileDescriptor;
+            DumpPtr->RegRecPtr = RegRecPtr;
+            DumpPtr->Generation = RegRecPtr->Generation;
+            DumpPtr->BufferPtr = RegRecPtr->Buffers[DumpPtr->BufferIndex].BufferPtr;
+            DumpPtr->NextOffset = 0;
+            DumpPtr->NumBytes = RegRecPtr->Size;
+            strncpy(DumpPtr->DumpFilename, DumpFilename, OS_MAX_PATH_LEN);
+            DumpPtr->DumpFilename[OS_MAX_PATH_LEN-1] = '\0';
+            CFE_PSP_MemCpy(DumpPtr->TableName, RegRecPtr->Name, CFE_TBL_MAX_FULL_NAME_LEN);
+
+            ReturnCode = CFE_TBL_ContinueFileDump();
+
+            if (DumpPtr->InProgress)
+            {
+                CFE_EVS_SendEvent(CFE_TBL_FILE_DUMPING_INF_EID,
+                                  CFE_EVS_DEBUG,
+                                  "Dumping '%s' to '%s' (%d bytes)",
+                                  TableName,
+                                  DumpFilename,
+                                  (int)RegRecPtr->Size);
+            }
+        }
+    }
+
+    return ReturnCode;
+
+} /* End of CFE_TBL_StartFileDump() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ContinueFileDump() -- Write the next piece of a table being dumped
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+CFE_TBL_CmdProcRet_t CFE_TBL_ContinueFileDump( void )
+{
+    CFE_TBL_CmdProcRet_t        ReturnCode = CFE_TBL_INC_ERR_CTR;        /* Assume failure */
+    CFE_TBL_FileDump_t         *DumpPtr = &CFE_TBL_TaskData.FileDump;
+    CFE_TBL_RegistryRec_t      *RegRecPtr = DumpPtr->RegRecPtr;
+    uint32                      NumBytes;
+    int32                       Status;
+    boolean                     DumpDone = TRUE;
+    boolean                     BufferPinned = TRUE;
+
+    if (!DumpPtr->InProgress)
+    {
+        /* No table is being dumped */
+        DumpDone = FALSE;
+        ReturnCode = CFE_TBL_DONT_INC_CTR;
+    }
+    else if ((RegRecPtr->Generation != DumpPtr->Generation) ||
+             (RegRecPtr->Buffers[DumpPtr->BufferIndex].BufferPtr != DumpPtr->BufferPtr) ||
+             (strcmp(RegRecPtr->Name, DumpPtr->TableName) != 0))
+    {
+        /* The buffer being dumped was freed since the last piece was written, */
+        /* even if the table has since been registered again under that name,  */
+        /* so the table's registry record no longer counts the dump as a reader */
+        BufferPinned = FALSE;
+
+        CFE_EVS_SendEvent(CFE_TBL_DUMP_STOPPED_ERR_EID,
+                          CFE_EVS_ERROR,
+                          "Dump of '%s' to '%s' stopped, table buffer was released",
+                          DumpPtr->TableName,
+                          DumpPtr->DumpFilename);
+    }
+    else
+    {
+        NumBytes = DumpPtr->NumBytes - DumpPtr->NextOffset;
+        if (NumBytes > CFE_TBL_DUMP_CHUNK_SIZE)
+        {
+            NumBytes = CFE_TBL_DUMP_CHUNK_SIZE;
+        }
+
+        Status = OS_write(DumpPtr->FileDescriptor,
+                          &DumpPtr->BufferPtr[DumpPtr->NextOffset],
+                          NumBytes);
+
+        if (Status != (int32)NumBytes)
+        {
+            CFE_EVS_SendEvent(CFE_TBL_WRITE_TBL_IMG_ERR_EID,
+                              CFE_EVS_ERROR,
+                              "Error writing Tbl image to '%s', Status=0x%08X",
+                              DumpPtr->DumpFilename, (unsigned int)Status);
+        }
+        else
+        {
+            DumpPtr->NextOffset += NumBytes;
+
+            if (DumpPtr->NextOffset < DumpPtr->NumBytes)
+            {
+                /* The rest of the table is written the next time the command pipe is empty */
+                DumpDone = FALSE;
+                ReturnCode = CFE_TBL_DONT_INC_CTR;
+            }
+            else
+            {
+                CFE_TBL_FinishFileDump(DumpPtr->DumpFilename, DumpPtr->TableName, DumpPtr->FileExistedPrev);
+
+                /* Increment Successful Command Counter */
+                ReturnCode = CFE_TBL_INC_CMD_CTR;
+            }
+        }
+    }
+
+    if (DumpDone)
+    {
+        /* Let table updates reuse the buffer and close the file now that the dump is over */
+        if (BufferPinned)
+        {
+            CFE_TBL_UnpinBuffer(RegRecPtr, DumpPtr->BufferIndex);
+        }
+
+        OS_close(DumpPtr->FileDescriptor);
+        DumpPtr->FileDescriptor = -1;
+        DumpPtr->InProgress = FALSE;
+    }
+
+    return ReturnCode;
+
+} /* End of CFE_TBL_ContinueFileDump() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_FinishFileDump() -- Record a table completely written to a dump file
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_task_cmds.h'
+********************************************************************/
+
+void CFE_TBL_FinishFileDump( const char *DumpFilename, const char *TableName, boolean FileExistedPrev )
+{
+    if (FileExistedPrev)
+    {
+        CFE_EVS_SendEvent(CFE_TBL_OVERWRITE_DUMP_INF_EID,
+                          CFE_EVS_INFORMATION,
+                          "Successfully overwrote '%s' with Table '%s'",
+                          DumpFilename, TableName);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CFE_TBL_WRITE_DUMP_INF_EID,
+                          CFE_EVS_INFORMATION,
+                          "Successfully dumped Table '%s' to '%s'",
+                          TableName, DumpFilename);
+    }
+
+    /* Save file information statistics for housekeeping telemetry */
+    strncpy(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped, DumpFilename,
+            sizeof(CFE_TBL_TaskData.HkPacket.Payload.LastFileDumped));
+
+} /* End of CFE_TBL_FinishFileDump() */
+
 /*******************************************************************
 **
 ** CFE_TBL_ValidateCmd() -- Process Validate Table Command Message
@@ -911,7 +1375,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_ValidateCmd( const CFE_SB_MsgPayloadPtr_t  Payload
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table that is to be dumped exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -925,8 +1391,16 @@ CFE_TBL_CmdProcRet_t CFE_TBL_ValidateCmd( const CFE_SB_MsgPayloadPtr_t  Payload
         }
         else if (CmdPtr->ActiveTblFlag == CFE_TBL_INACTIVE_BUFFER) /* Validating Inactive Buffer */
         {
+            /* An inactive buffer that is still being loaded from a file is incomplete */
+            if (CFE_TBL_TaskData.FileLoad.InProgress && (CFE_TBL_TaskData.FileLoad.RegRecPtr == RegRecPtr))
+            {
+                CFE_EVS_SendEvent(CFE_TBL_INACTIVE_LOADING_ERR_EID,
+                                  CFE_EVS_ERROR,
+                                  "Inactive buffer of '%s' is still being loaded from '%s'",
+                                  TableName, CFE_TBL_TaskData.FileLoad.LoadFilename);
+            }
             /* If this is a double buffered table, locating the inactive buffer is trivial */
-            if (RegRecPtr->DblBuffered)
+            else if (RegRecPtr->DblBuffered)
             {
                 ValidationDataPtr = RegRecPtr->Buffers[(1U-RegRecPtr->ActiveBufferIndex)].BufferPtr;
             }
@@ -996,8 +1470,18 @@ CFE_TBL_CmdProcRet_t CFE_TBL_ValidateCmd( const CFE_SB_MsgPayloadPtr_t  Payload
                         RegRecPtr->ValidateInactiveIndex = ValIndex;
                     }
                     
+                    if (RegRecPtr->TaskValidation)
+                    {
+                        /* The validation function is called by this task once its command pipe is empty */
+                        CFE_TBL_TaskData.TaskValidationPending = TRUE;
+
+                        CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID,
+                                          CFE_EVS_DEBUG,
+                                          "Tbl Services issued validation request for '%s'",
+                                          TableName);
+                    }
                     /* If application requested notification by message, then do so */
-                    if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
+                    else if (CFE_TBL_SendNotificationMsg(RegRecPtr) == CFE_SUCCESS)
                     {
                         /* Notify ground that validation request has been made */
                         CFE_EVS_SendEvent(CFE_TBL_VAL_REQ_MADE_INF_EID,
@@ -1067,7 +1551,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_ActivateCmd( const CFE_SB_MsgPayloadPtr_t  Payload
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table that is to be dumped exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -1343,7 +1829,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_TlmRegCmd( const CFE_SB_MsgPayloadPtr_t  Payload )
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table registry entry that is to be telemetered exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -1395,7 +1883,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_DeleteCDSCmd( const CFE_SB_MsgPayloadPtr_t  Payload
     /* Before doing anything, lets make sure the table is no longer in the registry */
     /* This would imply that the owning application has been terminated and that it */
     /* is safe to delete the associated critical table image in the CDS. */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex == CFE_TBL_NOT_FOUND)
     {
@@ -1489,7 +1979,9 @@ CFE_TBL_CmdProcRet_t CFE_TBL_AbortLoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload
             CFE_TBL_MAX_FULL_NAME_LEN, sizeof(CmdPtr->TableName));
 
     /* Before doing anything, lets make sure the table registry entry that is to be telemetered exists */
+    CFE_TBL_LockRegistry();
     RegIndex = CFE_TBL_FindTableInRegistry(TableName);
+    CFE_TBL_UnlockRegistry();
 
     if (RegIndex != CFE_TBL_NOT_FOUND)
     {
@@ -1536,6 +2028,14 @@ CFE_TBL_CmdProcRet_t CFE_TBL_AbortLoadCmd( const CFE_SB_MsgPayloadPtr_t  Payload
 
 void CFE_TBL_AbortLoad(CFE_TBL_RegistryRec_t *RegRecPtr)
 {
+    /* Stop reading the table's file if it is still being loaded */
+    if (CFE_TBL_TaskData.FileLoad.InProgress && (CFE_TBL_TaskData.FileLoad.RegRecPtr == RegRecPtr))
+    {
+        OS_close(CFE_TBL_TaskData.FileLoad.FileDescriptor);
+        CFE_TBL_TaskData.FileLoad.FileDescriptor = -1;
+        CFE_TBL_TaskData.FileLoad.InProgress = FALSE;
+    }
+
     /* The ground has aborted the load, free the working buffer for another attempt */
     if (!RegRecPtr->DblBuffered)
     {
@@ -148,13 +148,87 @@ extern CFE_TBL_CmdProcRet_t CFE_TBL_ResetCmd(const CFE_SB_MsgPayloadPtr_t Messag
 ** \par Assumptions, External Events, and Notes:
 **          The message pointed to by MessagePtr has been identified as a Load Table Command Message
 **
+**          A file holding more than #CFE_TBL_LOAD_CHUNK_SIZE bytes of table data is only partly read
+**          by this function.  The rest is read by #CFE_TBL_ContinueFileLoad, and the command counters
+**          are updated when the load completes.  A table patch file (#CFE_FS_TBL_PATCH_SUBTYPE)
+**          is always applied by this function.
+**
 ** \param[in] MessagePtr points to the message received via command pipe that needs processing
 **
+** \retval #CFE_TBL_DONT_INC_CTR \copydoc CFE_TBL_DONT_INC_CTR
 ** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
 ** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
 ******************************************************************************/
 extern CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd(const CFE_SB_MsgPayloadPtr_t MessagePtr);
 
+/*****************************************************************************/
+/**
+** \brief Reads the next piece of a table file being loaded
+**
+** \par Description
+**        Reads up to #CFE_TBL_LOAD_CHUNK_SIZE more bytes of the file named by the
+**        Load Table command in progress.  When the whole file has been read, this
+**        completes the load the way the Load Table command would have.
+** 
+** \par Assumptions, External Events, and Notes:
+**          Called by the Load Table command, and whenever no command has arrived on
+**          the Table Services command pipe for #CFE_TBL_LOAD_YIELD_MSEC while a load
+**          is in progress.  A load stops if the table was unregistered since the
+**          last piece was read, even if it has been registered again.  The registry
+**          is locked while a piece is read, and the owner's #CFE_TBL_Load is refused
+**          until the load is over.
+**
+** \retval #CFE_TBL_DONT_INC_CTR \copydoc CFE_TBL_DONT_INC_CTR
+** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
+** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
+******************************************************************************/
+extern CFE_TBL_CmdProcRet_t CFE_TBL_ContinueFileLoad(void);
+
+/*****************************************************************************/
+/**
+** \brief Records a table file completely loaded into a working buffer
+**
+** \par Description
+**        Reports the successful load and records where the working buffer's
+**        contents came from, both in the buffer and in housekeeping telemetry.
+** 
+** \par Assumptions, External Events, and Notes:
+**          The CRC of the working buffer has already been computed.
+**
+** \param[in] RegRecPtr             Pointer to Table Registry Entry for the table that was loaded
+**
+** \param[in] WorkingBufferPtr      Pointer to the working buffer that was loaded
+**
+** \param[in] LoadFilename          Full path and filename of the table file that was loaded
+**
+** \param[in] FileCreateTimeSecs    File creation time, seconds, from the file's standard cFE header
+**
+** \param[in] FileCreateTimeSubSecs File creation time, subseconds, from the file's standard cFE header
+**
+******************************************************************************/
+extern void CFE_TBL_FinishFileLoad(CFE_TBL_RegistryRec_t *RegRecPtr,
+                                   CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                                   const char *LoadFilename,
+                                   uint32 FileCreateTimeSecs,
+                                   uint32 FileCreateTimeSubSecs);
+
+/*****************************************************************************/
+/**
+** \brief Performs the next validation left for the Table Services task
+**
+** \par Description
+**        Calls the validation function of one table registered with the
+**        #CFE_TBL_OPT_TASK_VALIDATE option that has a validation pending.  When
+**        no such table is found, #CFE_TBL_TaskData_t::TaskValidationPending is
+**        cleared.
+** 
+** \par Assumptions, External Events, and Notes:
+**          Called whenever no command has arrived on the Table Services command
+**          pipe for #CFE_TBL_LOAD_YIELD_MSEC while validations are pending.
+**
+******************************************************************************/
+extern void CFE_TBL_ContinueValidation(void);
+
 /*****************************************************************************/
 /**
 ** \brief Process Dump Table Command Message
@@ -166,8 +240,13 @@ extern CFE_TBL_CmdProcRet_t CFE_TBL_LoadCmd(const CFE_SB_MsgPayloadPtr_t Message
 ** \par Assumptions, External Events, and Notes:
 **          The message pointed to by MessagePtr has been identified as a Dump Table Command Message
 **
+**          When #CFE_TBL_LOCKLESS_ACCESS is TRUE, an active buffer of more than #CFE_TBL_DUMP_CHUNK_SIZE
+**          bytes is only partly written by this function.  The rest is written by #CFE_TBL_ContinueFileDump,
+**          and the command counters are updated when the dump completes.
+**
 ** \param[in] MessagePtr points to the message received via command pipe that needs processing
 **
+** \retval #CFE_TBL_DONT_INC_CTR \copydoc CFE_TBL_DONT_INC_CTR
 ** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
 ** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
 ******************************************************************************/
@@ -307,6 +386,101 @@ extern CFE_TBL_CmdProcRet_t CFE_TBL_AbortLoadCmd(const CFE_SB_MsgPayloadPtr_t Me
 extern CFE_TBL_CmdProcRet_t CFE_TBL_DumpToFile( const char *DumpFilename, const char *TableName,
                                          void *DumpDataAddr, uint32 TblSizeInBytes);
 
+/*****************************************************************************/
+/**
+** \brief Creates a dump file and writes its standard cFE Table Image Headers
+**
+** \par Description
+**        Creates the specified file, overwriting any file of the same name, and
+**        writes the standard cFE File and cFE Table Image Headers for a table
+**        image of the specified size.
+**
+** \par Assumptions, External Events, and Notes:
+**          An event message is sent for any error.  The file is closed again
+**          when its headers could not be written completely.
+**
+** \param[in]  DumpFilename        Character string containing the full path of the file
+**                                  to which the contents of the table are to be written
+**
+** \param[in]  TableName           Name of table being dumped to a file
+**
+** \param[in]  TblSizeInBytes      Size of block of data to be written to the file
+**
+** \param[out] FileExistedPrevPtr  Set to TRUE when a file of the same name was overwritten
+**
+** \return The file descriptor of the file, positioned after its headers, or a negative
+**         value when the file could not be created or its headers could not be written
+******************************************************************************/
+extern int32 CFE_TBL_CreateDumpFile( const char *DumpFilename, const char *TableName,
+                                     uint32 TblSizeInBytes, boolean *FileExistedPrevPtr );
+
+/*****************************************************************************/
+/**
+** \brief Begins writing the active buffer of a table to a dump file
+**
+** \par Description
+**        Creates the dump file, pins the active buffer of the table so that
+**        updates cannot overwrite it, and writes the first piece of its data.
+**        The rest is written by #CFE_TBL_ContinueFileDump.
+**
+** \par Assumptions, External Events, and Notes:
+**          Only one table is written a piece at a time.  The buffer stays pinned
+**          until the dump completes or fails.
+**
+** \param[in] DumpFilename    Character string containing the full path of the file
+**                            to which the contents of the table are to be written
+**
+** \param[in] TableName       Name of table being dumped to a file
+**
+** \param[in] RegRecPtr       Pointer to Table Registry Entry for the table being dumped
+**
+** \retval #CFE_TBL_DONT_INC_CTR \copydoc CFE_TBL_DONT_INC_CTR
+** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
+** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
+******************************************************************************/
+extern CFE_TBL_CmdProcRet_t CFE_TBL_StartFileDump( const char *DumpFilename, const char *TableName,
+                                                   CFE_TBL_RegistryRec_t *RegRecPtr );
+
+/*****************************************************************************/
+/**
+** \brief Writes the next piece of a table being dumped
+**
+** \par Description
+**        Writes up to #CFE_TBL_DUMP_CHUNK_SIZE more bytes of the table named by
+**        the Dump Table command in progress.  When the whole table has been
+**        written, this completes the dump the way the Dump Table command would
+**        have and releases the table's buffer.
+** 
+** \par Assumptions, External Events, and Notes:
+**          Called by the Dump Table command, and every #CFE_TBL_LOAD_YIELD_MSEC
+**          while the Table Services command pipe is empty and a dump is in progress.
+**
+** \retval #CFE_TBL_DONT_INC_CTR \copydoc CFE_TBL_DONT_INC_CTR
+** \retval #CFE_TBL_INC_ERR_CTR  \copydoc CFE_TBL_INC_ERR_CTR
+** \retval #CFE_TBL_INC_CMD_CTR  \copydoc CFE_TBL_INC_CMD_CTR
+******************************************************************************/
+extern CFE_TBL_CmdProcRet_t CFE_TBL_ContinueFileDump(void);
+
+/*****************************************************************************/
+/**
+** \brief Records a table completely written to a dump file
+**
+** \par Description
+**        Reports the successful dump and records the name of the dump file in
+**        housekeeping telemetry.
+** 
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \param[in] DumpFilename    Full path and filename of the dump file that was written
+**
+** \param[in] TableName       Name of table that was dumped
+**
+** \param[in] FileExistedPrev TRUE when the dump overwrote a file of the same name
+**
+******************************************************************************/
+extern void CFE_TBL_FinishFileDump( const char *DumpFilename, const char *TableName, boolean FileExistedPrev );
+
 
 /*****************************************************************************/
 /**
@@ -61,6 +61,34 @@
     #error CFE_TBL_MAX_CRITICAL_TABLES cannot be greater than CFE_ES_CDS_MAX_NUM_ENTRIES!
 #endif
 
+#if CFE_TBL_LOAD_CHUNK_SIZE < 1
+    #error CFE_TBL_LOAD_CHUNK_SIZE must be greater than zero!
+#endif
+
+#if CFE_TBL_LOAD_YIELD_MSEC < 1
+    #error CFE_TBL_LOAD_YIELD_MSEC must be greater than zero!
+#endif
+
+#if (CFE_TBL_LOCKLESS_ACCESS != TRUE) && (CFE_TBL_LOCKLESS_ACCESS != FALSE)
+    #error CFE_TBL_LOCKLESS_ACCESS must be either TRUE or FALSE!
+#endif
+
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE) && !defined(__GNUC__)
+    #error CFE_TBL_LOCKLESS_ACCESS requires a toolchain with the GCC atomic builtins!
+#endif
+
+#if (CFE_TBL_TASK_VALIDATION != TRUE) && (CFE_TBL_TASK_VALIDATION != FALSE)
+    #error CFE_TBL_TASK_VALIDATION must be either TRUE or FALSE!
+#endif
+
+#if (CFE_TBL_TASK_VALIDATION == TRUE) && (CFE_TBL_LOCKLESS_ACCESS != TRUE)
+    #error CFE_TBL_TASK_VALIDATION requires CFE_TBL_LOCKLESS_ACCESS to be TRUE!
+#endif
+
+#if CFE_TBL_DUMP_CHUNK_SIZE < 1
+    #error CFE_TBL_DUMP_CHUNK_SIZE must be greater than zero!
+#endif
+
 /*
 ** Any modifications to the "_VALID_" limits defined below must match
 ** source code changes made to the function CFE_TBL_ReadHeaders() in
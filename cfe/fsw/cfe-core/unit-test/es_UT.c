@@ -173,10 +173,13 @@ void OS_Application_Startup(void)
     UT_ADD_TEST(TestShell);
     UT_ADD_TEST(TestTask);
     UT_ADD_TEST(TestPerf);
+    UT_ADD_TEST(TestPerfRings);
+    UT_ADD_TEST(TestPerfHist);
     UT_ADD_TEST(TestAPI);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
+    UT_ADD_TEST(TestDump);
 
 #ifdef CFE_ARINC653
     UT_ADD_TEST(TestStaticApp);
@@ -3228,7 +3231,7 @@ void TestTask(void)
 
     /* Test the command pipe message process with an invalid command */
     ES_ResetUnitTest();
-    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_DUMP_CDS_REG_CC + 2);
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC + 1);
     UT_Report(__FILE__, __LINE__,
               SendMsgEventIDRtn.value == CFE_ES_CC1_ERR_EID,
               "CFE_ES_TaskPipe",
@@ -3799,11 +3802,13 @@ void TestPerf(void)
               "CFE_ES_PerfLogDump",
               "Performance log dump; metadata write failed");
 
-    /* Test performance log dump with a data write failure */
+    /* Test performance log dump with a data write failure; the metadata
+     * and data fit in the dump buffer so they go out in a single write
+     */
     ES_ResetUnitTest();
     CFE_ES_PerfLogDumpStatus.DataFileDescriptor = OS_open(NULL, 0, 0);
     Perf->MetaData.DataCount = 7;
-    UT_SetRtnCode(&FileWriteRtn, sizeof(CFE_ES_PerfDataEntry_t) + 1, 4);
+    UT_SetRtnCode(&FileWriteRtn, sizeof(CFE_ES_PerfDataEntry_t) + 1, 1);
     CFE_ES_PerfLogDump();
     UT_GetStubRetcodeAndCount(UT_KEY(OS_close), &OSCloseRtn.value,
                               &OSCloseRtn.count);
@@ -3899,7 +3904,13 @@ void TestPerf(void)
     Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.DataCount = 0;
     Perf->MetaData.FilterMask[0] = 0xffff;
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+    memset(Perf->Ring, 0, sizeof(Perf->Ring));
+    CFE_ES_PerfLogAdd(0x1, 0);
+    CFE_ES_PerfRingSummary();
+#else
     CFE_ES_PerfLogAdd(0x1, 0);
+#endif
     UT_Report(__FILE__, __LINE__,
               Perf->MetaData.DataCount == 1,
               "CFE_ES_PerfLogAdd",
@@ -3999,6 +4010,287 @@ void TestPerf(void)
               "Invalid message length");
 }
 
+void TestPerfRings(void)
+{
+#if (CFE_ES_PERF_TASK_RINGS == TRUE)
+    uint32                  RingIdx;
+    uint32                  Count;
+    uint32                  i;
+    boolean                 InOrder = TRUE;
+    CFE_SB_MsgPtr_t         msgptr;
+    CFE_ES_PerfStartCmd_t   PerfStartCmd;
+    CFE_ES_PerfDataEntry_t *EntryPtr;
+    CFE_ES_PerfDataEntry_t *DumpPtr;
+
+    extern CFE_ES_PerfLogDump_t CFE_ES_PerfLogDumpStatus;
+    extern uint8                UT_FileWriteData[];
+    extern uint32               UT_FileWriteSize;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Performance Rings\n");
+#endif
+
+    /* The OS_TaskGetId stub always returns task 1 */
+    RingIdx = 1 % CFE_ES_PERF_RING_COUNT;
+    EntryPtr = &Perf->DataBuffer[RingIdx * CFE_ES_PERF_RING_SIZE];
+
+    /* Test that starting data collection empties the rings */
+    ES_ResetUnitTest();
+    Perf->Ring[RingIdx].Next = 5;
+    PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_TRIGGER_START;
+    UT_SetSBTotalMsgLen(sizeof(CFE_ES_PerfStartCmd_t));
+    msgptr = (CFE_SB_MsgPtr_t) &PerfStartCmd;
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_PERF_STARTDATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_PERF_STARTCMD_EID &&
+              Perf->Ring[RingIdx].Next == 0 &&
+              Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER,
+              "CFE_ES_PerfStartDataCmd",
+              "Start collecting performance data; rings emptied");
+
+    /* Test that a marker is added to the ring of the calling task and
+     * fires the trigger
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    Perf->MetaData.TriggerMask[0] = 0x2;
+    CFE_ES_PerfLogAdd(1, 0);
+    UT_Report(__FILE__, __LINE__,
+              Perf->Ring[RingIdx].Next == 1 && EntryPtr[0].Data == 1 &&
+              Perf->MetaData.State == CFE_ES_PERF_TRIGGERED &&
+              Perf->MetaData.TriggerCount == 1,
+              "CFE_ES_PerfRingAdd",
+              "Marker added to the task ring; triggered");
+
+    /* Test a ring overflow; the newest entries overwrite the oldest and the
+     * ring only counts for a ring's worth of entries
+     */
+    ES_ResetUnitTest();
+
+    for (i = 1; i < CFE_ES_PERF_RING_SIZE + 3; i++)
+    {
+        CFE_ES_PerfLogAdd(1, 0);
+    }
+
+    CFE_ES_PerfLogAdd(1, 1);
+    CFE_ES_PerfRingSummary();
+    UT_Report(__FILE__, __LINE__,
+              Perf->Ring[RingIdx].Next == CFE_ES_PERF_RING_SIZE + 4 &&
+              EntryPtr[3].Data == (1 | (1 << CFE_ES_PERF_EXIT_BIT)) &&
+              Perf->MetaData.DataCount == CFE_ES_PERF_RING_SIZE &&
+              Perf->MetaData.DataStart == 0 &&
+              Perf->MetaData.DataEnd ==
+                  CFE_ES_PERF_RING_SIZE % CFE_ES_PERF_DATA_BUFFER_SIZE,
+              "CFE_ES_PerfRingSummary",
+              "Ring overflow");
+
+    /* Test that collection stops a buffer's worth of entries after the
+     * trigger in START mode
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.TriggerCount = CFE_ES_PERF_DATA_BUFFER_SIZE - 1;
+    CFE_ES_PerfLogAdd(1, 0);
+    UT_Report(__FILE__, __LINE__,
+              Perf->MetaData.State == CFE_ES_PERF_IDLE,
+              "CFE_ES_PerfRingAdd",
+              "Triggered; START");
+
+#if (CFE_ES_PERF_RING_COUNT > 1)
+    /* Test merging the rings into the performance data file, oldest time
+     * stamp first.  The first ring holds three entries, the second newest
+     * with a rolled over timer; the last ring wrapped once, so its oldest
+     * entry is at position 1.
+     */
+    ES_ResetUnitTest();
+    memset(Perf->Ring, 0, sizeof(Perf->Ring));
+    memset(Perf->DataBuffer, 0, sizeof(Perf->DataBuffer));
+    EntryPtr = &Perf->DataBuffer[0];
+    EntryPtr[0].Data = 0x10;
+    EntryPtr[0].TimerLower32 = 50;
+    EntryPtr[1].Data = 0x11;
+    EntryPtr[1].TimerLower32 = 201 + CFE_ES_PERF_RING_SIZE;
+    EntryPtr[2].Data = 0x12;
+    EntryPtr[2].TimerUpper32 = 1;
+    Perf->Ring[0].Next = 3;
+    EntryPtr = &Perf->DataBuffer[(CFE_ES_PERF_RING_COUNT - 1) * CFE_ES_PERF_RING_SIZE];
+
+    for (i = 0; i < CFE_ES_PERF_RING_SIZE; i++)
+    {
+        EntryPtr[i].Data = 0x20;
+        EntryPtr[i].TimerLower32 = 200 + (2 * i);
+    }
+
+    EntryPtr[0].TimerLower32 = 200 + (2 * CFE_ES_PERF_RING_SIZE);
+    Perf->Ring[CFE_ES_PERF_RING_COUNT - 1].Next = CFE_ES_PERF_RING_SIZE + 1;
+    CFE_ES_PerfRingSummary();
+    Count = Perf->MetaData.DataCount;
+    CFE_ES_PerfLogDumpStatus.DataFileDescriptor = OS_open(NULL, 0, 0);
+    CFE_ES_PerfLogDump();
+    DumpPtr = (CFE_ES_PerfDataEntry_t *)
+        &UT_FileWriteData[sizeof(CFE_ES_PerfMetaData_t)];
+
+    for (i = 1; i < Count; i++)
+    {
+        if ((DumpPtr[i].TimerUpper32 < DumpPtr[i - 1].TimerUpper32) ||
+            ((DumpPtr[i].TimerUpper32 == DumpPtr[i - 1].TimerUpper32) &&
+             (DumpPtr[i].TimerLower32 <= DumpPtr[i - 1].TimerLower32)))
+        {
+            InOrder = FALSE;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_PERF_DATAWRITTEN_EID &&
+              Count == CFE_ES_PERF_RING_SIZE + 3 &&
+              UT_FileWriteSize == sizeof(CFE_ES_PerfMetaData_t) +
+                  (Count * sizeof(CFE_ES_PerfDataEntry_t)) &&
+              InOrder == TRUE &&
+              DumpPtr[0].Data == 0x10 && DumpPtr[1].TimerLower32 == 202 &&
+              DumpPtr[Count - 1].Data == 0x12 &&
+              CFE_ES_PerfLogDumpStatus.DataToWrite == 0,
+              "CFE_ES_PerfLogDump",
+              "Rings merged in time order");
+
+    /* Test a write failure while merging the rings */
+    ES_ResetUnitTest();
+    CFE_ES_PerfLogDumpStatus.DataFileDescriptor = OS_open(NULL, 0, 0);
+    UT_SetRtnCode(&FileWriteRtn, OS_FS_ERROR, 1);
+    CFE_ES_PerfLogDump();
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_FILEWRITE_ERR_EID &&
+              CFE_ES_PerfLogDumpStatus.DataToWrite == 0,
+              "CFE_ES_PerfLogDump",
+              "Rings merge; data write failed");
+#endif
+#endif
+}
+
+void TestPerfHist(void)
+{
+#if (CFE_ES_PERF_HISTOGRAMS == TRUE)
+    CFE_SB_MsgPtr_t           msgptr;
+    CFE_ES_WritePerfHistCmd_t WritePerfHistCmd;
+    CFE_ES_PerfHistRecord_t   Record[2];
+
+    extern uint8  UT_FileWriteData[];
+    extern uint32 UT_FileWriteSize;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Performance Histograms\n");
+#endif
+
+    /* Time a 500 tick entry/exit pair of marker 1 and a 3 tick pair of
+     * marker 2, nested inside it
+     */
+    ES_ResetUnitTest();
+    CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_POWERON);
+    Perf->MetaData.TimerLow32Rollover = 1000000;
+    UT_SetBSP_Time(0, 100);
+    CFE_ES_PerfLogAdd(1, 0);
+    UT_SetBSP_Time(0, 200);
+    CFE_ES_PerfLogAdd(2, 0);
+    UT_SetBSP_Time(0, 203);
+    CFE_ES_PerfLogAdd(2, 1);
+    UT_SetBSP_Time(0, 600);
+    CFE_ES_PerfLogAdd(1, 1);
+    UT_SetBSP_Time(0, 0);
+    msgptr = (CFE_SB_MsgPtr_t) &WritePerfHistCmd;
+
+    /* Test the write performance histograms command with an invalid
+     * message length
+     */
+    ES_ResetUnitTest();
+    UT_SetSBTotalMsgLen(sizeof(CFE_ES_WritePerfHistCmd_t) + 1);
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_LEN_ERR_EID &&
+              UT_FileWriteSize == 0,
+              "CFE_ES_WritePerfHistCmd",
+              "Invalid message length");
+
+    /* Test successfully writing the performance histograms */
+    ES_ResetUnitTest();
+    CFE_ES_TaskData.CmdCounter = 0;
+    WritePerfHistCmd.Payload.HistFileName[0] = '\0';
+    WritePerfHistCmd.Payload.ClearHistograms = FALSE;
+    UT_SetSBTotalMsgLen(sizeof(CFE_ES_WritePerfHistCmd_t));
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    memcpy(Record, UT_FileWriteData, sizeof(Record));
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_PERF_HIST_EID &&
+              CFE_ES_TaskData.CmdCounter == 1 &&
+              UT_FileWriteSize == sizeof(Record) &&
+              Record[0].PerfId == 1 && Record[0].Count == 1 &&
+              Record[0].MinTicks == 500 && Record[0].MaxTicks == 500 &&
+              Record[0].SumTicksUpper32 == 0 &&
+              Record[0].SumTicksLower32 == 500 &&
+              Record[0].Bucket[8] == 1 && Record[0].P50Bucket == 8 &&
+              Record[0].P99Bucket == 8 &&
+              Record[1].PerfId == 2 && Record[1].Count == 1 &&
+              Record[1].MinTicks == 3 && Record[1].Bucket[1] == 1,
+              "CFE_ES_WritePerfHistCmd",
+              "Write performance histograms; successful");
+
+    /* Test writing the performance histograms with a file create failure */
+    ES_ResetUnitTest();
+    CFE_ES_TaskData.ErrCounter = 0;
+    UT_SetOSFail(OS_CREAT_FAIL);
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_PERF_HIST_ERR_EID &&
+              CFE_ES_TaskData.ErrCounter == 1,
+              "CFE_ES_WritePerfHistCmd",
+              "Write performance histograms; file create failed");
+
+    /* Test writing the performance histograms with a cFE header write
+     * failure
+     */
+    ES_ResetUnitTest();
+    CFE_ES_TaskData.ErrCounter = 0;
+    UT_SetRtnCode(&FSWriteHdrRtn, -1, 1);
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_FILEWRITE_ERR_EID &&
+              CFE_ES_TaskData.ErrCounter == 1 && UT_FileWriteSize == 0,
+              "CFE_ES_WritePerfHistCmd",
+              "Write performance histograms; cFE header write failed");
+
+    /* Test writing the performance histograms with a record write failure;
+     * the histograms are kept even though clearing was requested
+     */
+    ES_ResetUnitTest();
+    CFE_ES_TaskData.ErrCounter = 0;
+    WritePerfHistCmd.Payload.ClearHistograms = TRUE;
+    UT_SetRtnCode(&FileWriteRtn, OS_FS_ERROR, 1);
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_FILEWRITE_ERR_EID &&
+              CFE_ES_TaskData.ErrCounter == 1,
+              "CFE_ES_WritePerfHistCmd",
+              "Write performance histograms; record write failed");
+
+    /* Test successfully writing and clearing the performance histograms */
+    ES_ResetUnitTest();
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_PERF_HIST_EID &&
+              UT_FileWriteSize == sizeof(Record),
+              "CFE_ES_WritePerfHistCmd",
+              "Write and clear performance histograms");
+
+    /* Test that cleared histograms write no records */
+    ES_ResetUnitTest();
+    WritePerfHistCmd.Payload.ClearHistograms = FALSE;
+    UT_SendMsg(msgptr, CFE_ES_CMD_MID, CFE_ES_WRITE_PERF_HIST_CC);
+    UT_Report(__FILE__, __LINE__,
+              SendMsgEventIDRtn.value == CFE_ES_PERF_HIST_EID &&
+              UT_FileWriteSize == 0,
+              "CFE_ES_WritePerfHistCmd",
+              "Write cleared performance histograms");
+#endif
+}
+
 void TestAPI(void)
 {
     uint32 Id, Id2;
@@ -4010,6 +4302,7 @@ void TestAPI(void)
     uint32 ExceptionContext = 0;
     int32 Return;
     uint8 Data[12];
+    uint32 Crc;
     uint32 ResetType;
     uint32 *ResetTypePtr;
     uint32 AppId;
@@ -4284,6 +4577,28 @@ void TestAPI(void)
               "CFE_ES_GetAppID",
               "Get application ID by name successful");
 
+    /* Test getting the application ID from the caller's own task record */
+    ES_ResetUnitTest();
+    CFE_ES_Global.TaskTable[1].RecordUsed = TRUE;
+    CFE_ES_Global.TaskTable[1].TaskId = 1;
+    CFE_ES_Global.TaskTable[1].AppId = 3;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppID(&AppId) == CFE_SUCCESS &&
+              AppId == 3,
+              "CFE_ES_GetAppID",
+              "Get application ID without the shared data lock");
+
+    /* Test getting the application ID while ES changes the task record */
+    CFE_ES_BeginTaskRecordUpdate(1);
+    CFE_ES_Global.TaskTable[1].AppId = 5;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppID(&AppId) == CFE_SUCCESS &&
+              AppId == 5 &&
+              (CFE_ES_Global.TaskTable[1].Generation & 1) == 1,
+              "CFE_ES_GetAppID",
+              "Get application ID while the task record is changed");
+    CFE_ES_EndTaskRecordUpdate(1);
+
     /* Test getting the app name with a bad app ID */
     CFE_ES_Global.AppTable[4].RecordUsed = FALSE;
     ES_ResetUnitTest();
@@ -4625,14 +4940,34 @@ void TestAPI(void)
               "CFE_ES_CalculateCRC",
               "CRC-16 algorithm - memory read failure");
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CRC_32) == 1314624383,
+              "CFE_ES_CalculateCRC",
+              "CRC-32 algorithm - memory read successful");
+
+    /* Test calculating a CRC-16 on memory that is not EEPROM, which is read
+     * directly instead of through the PSP
+     */
+    ES_ResetUnitTest();
+    UT_SetRtnCode(&PSPMemValRangeRtn, CFE_PSP_INVALID_MEM_RANGE, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CRC_16) == 0xFFFFBB3D,
+              "CFE_ES_CalculateCRC",
+              "CRC-16 algorithm - direct memory read");
+
+    /* Test calculating a CRC-32 on memory that is not EEPROM, continuing
+     * the CRC of the first part of the data
      */
     ES_ResetUnitTest();
+    UT_SetRtnCode(&PSPMemValRangeRtn, CFE_PSP_INVALID_MEM_RANGE, 1);
+    Crc = CFE_ES_CalculateCRC("1234", 4, 0, CFE_ES_CRC_32);
+    UT_SetRtnCode(&PSPMemValRangeRtn, CFE_PSP_INVALID_MEM_RANGE, 1);
     UT_Report(__FILE__, __LINE__,
-              CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CRC_32) == 0,
+              CFE_ES_CalculateCRC("56789", 5, Crc, CFE_ES_CRC_32) == 0xCBF43926,
               "CFE_ES_CalculateCRC",
-              "*Not implemented* CRC-32 algorithm");
+              "CRC-32 algorithm - direct memory read");
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -4642,6 +4977,38 @@ void TestAPI(void)
               "CFE_ES_CalculateCRC",
               "Invalid CRC type");
 
+    /* Test updating a CRC-16 for a change to a range of the data */
+    ES_ResetUnitTest();
+    UT_SetPSPMemValRangeFail(TRUE);
+    Crc = CFE_ES_UpdateCRC(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CRC_16),
+                           CFE_ES_CalculateCRC("456", 3, 0, CFE_ES_CRC_16),
+                           CFE_ES_CalculateCRC("abc", 3, 0, CFE_ES_CRC_16),
+                           3, CFE_ES_CRC_16);
+    UT_Report(__FILE__, __LINE__,
+              Crc == CFE_ES_CalculateCRC("123abc789", 9, 0, CFE_ES_CRC_16),
+              "CFE_ES_UpdateCRC",
+              "CRC-16 algorithm");
+
+    /* Test updating a CRC-32 for a change to a range of the data */
+    ES_ResetUnitTest();
+    UT_SetPSPMemValRangeFail(TRUE);
+    Crc = CFE_ES_UpdateCRC(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CRC_32),
+                           CFE_ES_CalculateCRC("45", 2, 0, CFE_ES_CRC_32),
+                           CFE_ES_CalculateCRC("ab", 2, 0, CFE_ES_CRC_32),
+                           4, CFE_ES_CRC_32);
+    UT_Report(__FILE__, __LINE__,
+              Crc == CFE_ES_CalculateCRC("123ab6789", 9, 0, CFE_ES_CRC_32),
+              "CFE_ES_UpdateCRC",
+              "CRC-32 algorithm");
+
+    /* Test updating a CRC using a CRC type that is not implemented */
+    ES_ResetUnitTest();
+    UT_SetPSPMemValRangeFail(FALSE);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_UpdateCRC(345353, 1, 2, 3, CFE_ES_CRC_8) == 0,
+              "CFE_ES_UpdateCRC",
+              "*Not implemented* CRC-8 algorithm");
+
     /* Test CDS registering with a write CDS failure */
     ES_ResetUnitTest();
     OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
@@ -4798,6 +5165,14 @@ void TestAPI(void)
               "CFE_ES_CopyToCDS",
               "Copy to CDS successful");
 
+    /* Test successfully copying part of a block to CDS */
+    ES_ResetUnitTest();
+    UT_SetRtnCode(&BSPReadCDSRtn, OS_SUCCESS, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CopyToCDSRange(CDSHandle, 0, 2, &TempSize) == CFE_SUCCESS,
+              "CFE_ES_CopyToCDSRange",
+              "Copy range to CDS successful");
+
     /* Test successfully restoring from a CDS */
     ES_ResetUnitTest();
     UT_Report(__FILE__, __LINE__,
@@ -5600,6 +5975,7 @@ void TestCDSMempool(void)
                                          sizeof(CFE_ES_CDSBlockDesc_t);
     CFE_ES_CDSBlockHandle_t BlockHandle;
     int                     Data;
+    uint8                   Block[CFE_ES_CDS_CRC_CHUNK_SIZE + 300];
     uint32                  i;
 
     extern uint32 CFE_ES_CDSMemPoolDefSize[];
@@ -5854,6 +6230,126 @@ void TestCDSMempool(void)
               "CFE_ES_CDSBlockWrite",
               "Error reading CDS");
 
+    /* Test CDS block range write using an invalid memory handle */
+    ES_ResetUnitTest();
+    BlockHandle = 7;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == CFE_ES_ERR_MEM_HANDLE,
+              "CFE_ES_CDSBlockWriteRange",
+              "Invalid memory handle");
+    BlockHandle = 10;
+
+    /* Test CDS block range write with a CDS read error (block descriptor) */
+    ES_ResetUnitTest();
+    UT_SetBSPFail(BSP_READCDS_FAIL);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == OS_ERROR,
+              "CFE_ES_CDSBlockWriteRange",
+              "Error reading block descriptor from CDS");
+
+    /* Test CDS block range write using an invalid (unused) block */
+    ES_ResetUnitTest();
+    CFE_ES_CDSBlockDesc.AllocatedFlag = CFE_ES_CDS_BLOCK_UNUSED;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == CFE_ES_ERR_MEM_HANDLE,
+              "CFE_ES_CDSBlockWriteRange",
+              "Invalid CDS block");
+    CFE_ES_CDSBlockDesc.AllocatedFlag = CFE_ES_CDS_BLOCK_USED;
+
+    /* Test CDS block range write with the block size too large */
+    ES_ResetUnitTest();
+    CFE_ES_CDSBlockDesc.ActualSize  = CFE_ES_CDS_MAX_BLOCK_SIZE + 1;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == CFE_ES_ERR_MEM_HANDLE,
+              "CFE_ES_CDSBlockWriteRange",
+              "Actual size too large");
+    CFE_ES_CDSBlockDesc.ActualSize  = 452;
+
+    /* Test CDS block range write with a range past the end of the block */
+    ES_ResetUnitTest();
+    CFE_ES_CDSBlockDesc.SizeUsed = CFE_ES_CDS_CRC_CHUNK_SIZE + sizeof(Data);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle,
+                                        CFE_ES_CDS_CRC_CHUNK_SIZE + 1,
+                                        sizeof(Data),
+                                        &Data) == CFE_ES_BAD_ARGUMENT,
+              "CFE_ES_CDSBlockWriteRange",
+              "Range exceeds block size");
+
+    /* Test CDS block range write with a CDS read error (old data) */
+    ES_ResetUnitTest();
+    UT_SetRtnCode(&BSPReadCDSRtn, OS_ERROR, 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == OS_ERROR,
+              "CFE_ES_CDSBlockWriteRange",
+              "Error reading old data from CDS");
+
+    /* Test CDS block range write with a CDS write error (block descriptor) */
+    ES_ResetUnitTest();
+    UT_SetBSPFail(BSP_WRITECDS_FAIL);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == OS_ERROR,
+              "CFE_ES_CDSBlockWriteRange",
+              "Error writing block descriptor to CDS");
+
+    /* Test CDS block range write with a CDS write error (new data) */
+    ES_ResetUnitTest();
+    UT_SetBSPFail(BSP_WRITECDS_FAIL);
+    UT_SetRtnCode(&BSPWriteCDSRtn, OS_SUCCESS, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 0, sizeof(Data),
+                                        &Data) == OS_ERROR,
+              "CFE_ES_CDSBlockWriteRange",
+              "Error writing new data to CDS");
+
+    /* Test successful CDS block range write spanning two CRC chunks */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle,
+                                        CFE_ES_CDS_CRC_CHUNK_SIZE - 2,
+                                        sizeof(Data),
+                                        &Data) == CFE_SUCCESS,
+              "CFE_ES_CDSBlockWriteRange",
+              "Write range spanning two chunks successful");
+
+    /* Test that CDS block range writes keep the CRC of the whole block.  The
+     * stub CDS holds no data, so both writes read back the same old contents;
+     * the first writes the data the CRC was computed over, and the second
+     * must then leave the CRC of the block holding its own data
+     */
+    ES_ResetUnitTest();
+    UT_SetPSPMemValRangeFail(TRUE);
+    memset(Block, 0x5a, sizeof(Block));
+    memset(&Block[100], 0xa5, CFE_ES_CDS_CRC_CHUNK_SIZE + 88);
+    CFE_ES_CDSBlockDesc.SizeUsed = sizeof(Block);
+    CFE_ES_CDSBlockDesc.CRC = CFE_ES_CalculateCRC(Block, sizeof(Block),
+                                                  0, CFE_ES_DEFAULT_CRC);
+    CFE_ES_CDSBlockWriteRange(BlockHandle, 100, CFE_ES_CDS_CRC_CHUNK_SIZE + 88,
+                              &Block[100]);
+
+    for (i = 100; i < CFE_ES_CDS_CRC_CHUNK_SIZE + 188; i++)
+    {
+        Block[i] = (uint8) i;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_CDSBlockWriteRange(BlockHandle, 100,
+                                        CFE_ES_CDS_CRC_CHUNK_SIZE + 88,
+                                        &Block[100]) == CFE_SUCCESS &&
+              CFE_ES_CDSBlockDesc.CRC == CFE_ES_CalculateCRC(Block,
+                                                             sizeof(Block),
+                                                             0,
+                                                             CFE_ES_DEFAULT_CRC),
+              "CFE_ES_CDSBlockWriteRange",
+              "Range write keeps whole block CRC");
+    CFE_ES_CDSBlockDesc.SizeUsed = 512;
+
     /* Test CDS block read with an invalid memory handle */
     ES_ResetUnitTest();
     BlockHandle = 7;
@@ -6023,6 +6519,8 @@ void TestESMempool(void)
     BD_t                  *BdPtr;
     CFE_ES_MemHandle_t    HandlePtr2;
     CFE_ES_MemHandle_t    HandlePtrSave;
+    uint32                MaxFree;
+    uint32                FreeBytes;
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test ES memory pool\n");
@@ -6548,6 +7046,306 @@ void TestESMempool(void)
                                         CFE_ES_ERR_MEM_HANDLE,
               "CFE_ES_PutPoolBuf",
               "Invalid memory handle");
+
+    /* Test that the statistics of a fixed size pool report the largest
+     * block that can still be allocated
+     */
+    ES_ResetUnitTest();
+    CFE_ES_PoolCreate(&HandlePtr, Buffer, CFE_ES_MAX_BLOCK_SIZE);
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    UT_Report(__FILE__, __LINE__,
+              Stats.MaxFreeBlockSize == CFE_ES_MEM_BLOCK_SIZE_16,
+              "CFE_ES_GetMemPoolStats",
+              "Largest free block of a fixed size pool");
+
+    /* Test that a returned block is handed out again for the next request of
+     * its size (the 256 byte blocks are the ninth default size)
+     */
+    ES_ResetUnitTest();
+    CFE_ES_GetPoolBuf((uint32 **) &address, HandlePtr, 256);
+    CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address);
+    CFE_ES_GetPoolBuf((uint32 **) &address2, HandlePtr, 256);
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    UT_Report(__FILE__, __LINE__,
+              address2 == address &&
+              Stats.BlockStats[8].NumCreated == 1 &&
+              Stats.BlockStats[8].NumFree == 0,
+              "CFE_ES_GetPoolBuf",
+              "Reuse returned pool buffer; successful");
+
+    /* Test returning a pool buffer whose descriptor size exceeds the
+     * largest block size
+     */
+    ES_ResetUnitTest();
+    BdPtr = (BD_t *) (address2 - sizeof(BD_t));
+    BdPtr->Size = CFE_ES_MAX_BLOCK_SIZE + 1;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address2) ==
+                  CFE_ES_ERR_MEM_HANDLE &&
+              ((Pool_t *) HandlePtr)->CheckErrCntr == 1,
+              "CFE_ES_PutPoolBuf",
+              "Invalid pool buffer size");
+
+    /* Test creating a buddy memory pool with the pool size too small */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PoolCreateBuddy(&HandlePtr,
+                                     Buffer,
+                                     sizeof(Pool_t),
+                                     0,
+                                     CFE_ES_USE_MUTEX) == CFE_ES_BAD_ARGUMENT,
+              "CFE_ES_PoolCreateBuddy",
+              "Pool size too small");
+
+    /* Test creating a buddy memory pool with a smallest block size that
+     * would make the largest block size overflow
+     */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PoolCreateBuddy(&HandlePtr,
+                                     Buffer,
+                                     CFE_ES_MAX_BLOCK_SIZE,
+                                     0x10000,
+                                     CFE_ES_USE_MUTEX) == CFE_ES_BAD_ARGUMENT,
+              "CFE_ES_PoolCreateBuddy",
+              "Minimum block size too large");
+
+    /* Test creating a buddy memory pool with an invalid mutex option */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PoolCreateBuddy(&HandlePtr,
+                                     Buffer,
+                                     CFE_ES_MAX_BLOCK_SIZE,
+                                     0,
+                                     2) == CFE_ES_BAD_ARGUMENT,
+              "CFE_ES_PoolCreateBuddy",
+              "Invalid mutex option");
+
+    /* Test successfully creating a buddy memory pool */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PoolCreateBuddy(&HandlePtr,
+                                     Buffer,
+                                     CFE_ES_MAX_BLOCK_SIZE,
+                                     0,
+                                     CFE_ES_USE_MUTEX) == CFE_SUCCESS,
+              "CFE_ES_PoolCreateBuddy",
+              "Create buddy memory pool; successful");
+
+    /* Recreate the pool so that its blocks start as a single 4096 byte
+     * block, which makes the addresses of the split blocks known
+     */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PoolCreateBuddy(&HandlePtr,
+                                     Buffer,
+                                     (((Pool_t *) HandlePtr)->Arena -
+                                         HandlePtr) + 4096,
+                                     0,
+                                     CFE_ES_USE_MUTEX) == CFE_SUCCESS,
+              "CFE_ES_PoolCreateBuddy",
+              "Create buddy memory pool of one block; successful");
+
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    MaxFree = Stats.MaxFreeBlockSize;
+    FreeBytes = Stats.NumFreeBytes;
+    UT_Report(__FILE__, __LINE__,
+              MaxFree == 4096 - sizeof(BD_t) && FreeBytes == 4096,
+              "CFE_ES_GetMemPoolStats",
+              "Buddy pool statistics");
+
+    /* Test allocating a buddy pool buffer; the block is the smallest power
+     * of two that holds the request and its descriptor
+     */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBuf((uint32 **) &address, HandlePtr, 100) ==
+                  128 - sizeof(BD_t),
+              "CFE_ES_GetPoolBuf",
+              "Allocate buddy pool buffer [1]; successful");
+
+    /* Test allocating a second buddy pool buffer from the block split off
+     * the first one
+     */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBuf((uint32 **) &address2, HandlePtr, 100) ==
+                  128 - sizeof(BD_t) &&
+              address2 == address + 128,
+              "CFE_ES_GetPoolBuf",
+              "Allocate buddy pool buffer [2]; successful");
+
+    /* Test getting the size of a buddy pool buffer */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBufInfo(HandlePtr, (uint32 *) address2) ==
+                  128 - sizeof(BD_t),
+              "CFE_ES_GetPoolBufInfo",
+              "Get buddy pool buffer size; successful");
+
+    /* Test that returning both buffers merges all blocks back together */
+    ES_ResetUnitTest();
+    CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address);
+    ((Pool_t *) HandlePtr)->UseMutex = CFE_ES_NO_MUTEX;
+    CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address2);
+    ((Pool_t *) HandlePtr)->UseMutex = CFE_ES_USE_MUTEX;
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    UT_Report(__FILE__, __LINE__,
+              Stats.MaxFreeBlockSize == MaxFree &&
+              Stats.NumFreeBytes == FreeBytes &&
+              Stats.NumBlocksRequested == 2,
+              "CFE_ES_PutPoolBuf",
+              "Return buffers to the buddy pool; blocks merged");
+
+    /* Test returning a buddy pool buffer that is already free */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address2) ==
+                  CFE_ES_ERR_MEM_HANDLE,
+              "CFE_ES_PutPoolBuf",
+              "Deallocate unallocated buddy pool buffer");
+
+    /* Test that memory used for the largest block is reused for small
+     * blocks once it is returned
+     */
+    ES_ResetUnitTest();
+    CFE_ES_GetPoolBuf((uint32 **) &address, HandlePtr, MaxFree);
+    CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBuf((uint32 **) &address2, HandlePtr, 8) > 0 &&
+              address2 == address,
+              "CFE_ES_GetPoolBuf",
+              "Reuse large buddy pool block for a small one");
+
+    /* Test returning a buddy pool buffer whose descriptor size was
+     * corrupted
+     */
+    ES_ResetUnitTest();
+    BdPtr = (BD_t *) (address2 - sizeof(BD_t));
+    BdPtr->Size++;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address2) ==
+                  CFE_ES_ERR_MEM_HANDLE,
+              "CFE_ES_PutPoolBuf",
+              "Invalid buddy pool block size");
+    BdPtr->Size--;
+
+    /* Test allocating a buddy pool buffer larger than the largest free
+     * block.  Use no mutex in order to get branch path coverage
+     */
+    ES_ResetUnitTest();
+    ((Pool_t *) HandlePtr)->UseMutex = CFE_ES_NO_MUTEX;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBuf((uint32 **) &address,
+                                HandlePtr,
+                                MaxFree + 1) == CFE_ES_ERR_MEM_BLOCK_SIZE,
+              "CFE_ES_GetPoolBuf",
+              "Buddy pool request won't fit in remaining memory (no mutex)");
+    ((Pool_t *) HandlePtr)->UseMutex = CFE_ES_USE_MUTEX;
+
+    /* Test allocating a buddy pool buffer larger than the largest block
+     * size
+     */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBuf((uint32 **) &address,
+                                HandlePtr,
+                                0xFFFFFFFF) == CFE_ES_ERR_MEM_BLOCK_SIZE,
+              "CFE_ES_GetPoolBuf",
+              "Buddy pool buffer size exceeds maximum");
+}
+
+void TestDump(void)
+{
+    static CFE_ES_DumpWriter_t Writer;
+    static uint8               Data[CFE_ES_DUMP_BUFFER_SIZE * 2];
+    uint8                      Ring[16];
+    OS_time_t                  Start;
+    OS_time_t                  Stop;
+    uint32                     i;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Dump Writer\n");
+#endif
+
+    for (i = 0; i < sizeof(Ring); i++)
+    {
+        Ring[i] = (uint8) i;
+    }
+
+    /* Test a dump mixing buffered and full block writes */
+    ES_ResetUnitTest();
+    UT_SetBSP_Time(0, 0);
+    CFE_ES_DumpInit(&Writer, 1);
+    CFE_ES_DumpWrite(&Writer, Data, 3);
+    CFE_ES_DumpWrite(&Writer, Data, sizeof(Data));
+    UT_SetBSP_Time(1, 0);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_DumpFinish(&Writer) == CFE_SUCCESS &&
+              Writer.FileSize == sizeof(Data) + 3 &&
+              Writer.BufferUsed == 0 &&
+              Writer.ElapsedMsec == 1000 &&
+              Writer.BytesPerSec == sizeof(Data) + 3,
+              "CFE_ES_DumpWrite",
+              "Buffered dump; success");
+
+    /* Test that a dump yields once it has run for its time slice */
+    ES_ResetUnitTest();
+    UT_SetBSP_Time(0, 0);
+    CFE_ES_DumpInit(&Writer, 1);
+    UT_SetBSP_Time(0, CFE_ES_DUMP_RUN_MSEC * 1000);
+    CFE_ES_DumpWrite(&Writer, Data, CFE_ES_DUMP_BUFFER_SIZE);
+    UT_Report(__FILE__, __LINE__,
+              Writer.RunStartTime.microsecs == CFE_ES_DUMP_RUN_MSEC * 1000 &&
+              Writer.StartTime.microsecs == 0,
+              "CFE_ES_DumpWrite",
+              "Buffered dump; yield after run time");
+
+    /* Test a ring buffer dump that wraps to the start of the ring */
+    ES_ResetUnitTest();
+    CFE_ES_DumpInit(&Writer, 1);
+    CFE_ES_DumpWriteRing(&Writer, Ring, sizeof(Ring), 12, 8);
+    UT_Report(__FILE__, __LINE__,
+              Writer.BufferUsed == 8 &&
+              Writer.Buffer[0] == 12 && Writer.Buffer[3] == 15 &&
+              Writer.Buffer[4] == 0 && Writer.Buffer[7] == 3 &&
+              CFE_ES_DumpFinish(&Writer) == CFE_SUCCESS &&
+              Writer.FileSize == 8,
+              "CFE_ES_DumpWriteRing",
+              "Ring buffer dump; wrap around");
+
+    /* Test a dump with a write failure */
+    ES_ResetUnitTest();
+    CFE_ES_DumpInit(&Writer, 1);
+    UT_SetRtnCode(&FileWriteRtn, -1, 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_DumpWrite(&Writer, Data, sizeof(Data)) ==
+                  CFE_ES_FILE_IO_ERR &&
+              CFE_ES_DumpWrite(&Writer, Data, 3) == CFE_ES_FILE_IO_ERR &&
+              CFE_ES_DumpFinish(&Writer) == CFE_ES_FILE_IO_ERR &&
+              Writer.FileSize == CFE_ES_DUMP_BUFFER_SIZE &&
+              Writer.WriteSize == CFE_ES_DUMP_BUFFER_SIZE &&
+              Writer.WriteStatus == -1,
+              "CFE_ES_DumpWrite",
+              "Buffered dump; write failure");
+
+    /* Test elapsed time across a second boundary */
+    ES_ResetUnitTest();
+    Start.seconds = 5;
+    Start.microsecs = 900000;
+    Stop.seconds = 7;
+    Stop.microsecs = 100000;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_ElapsedMsec(&Start, &Stop) == 1200,
+              "CFE_ES_ElapsedMsec",
+              "Elapsed time; borrow from seconds");
+
+    /* Test elapsed time when the clock went backwards */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_ElapsedMsec(&Stop, &Start) == 0,
+              "CFE_ES_ElapsedMsec",
+              "Elapsed time; clock went backwards");
 }
 
 #ifdef CFE_ARINC653
@@ -229,6 +229,51 @@ void TestTask(void);
 ******************************************************************************/
 void TestPerf(void);
 
+/*****************************************************************************/
+/**
+** \brief Performs tests on the per-task performance data rings contained in
+**        cfe_es_perf.c
+**
+** \par Description
+**        This function tests adding markers to the rings, a ring overflow
+**        and merging the rings into the performance data file.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only runs if #CFE_ES_PERF_TASK_RINGS is TRUE.  The merge tests need
+**        more than one ring.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_Report, #UT_SetRtnCode, #UT_SetSBTotalMsgLen, #UT_SendMsg
+** \sa #CFE_ES_PerfStartDataCmd, #CFE_ES_PerfLogAdd, #CFE_ES_PerfRingSummary
+** \sa #CFE_ES_PerfLogDump
+**
+******************************************************************************/
+void TestPerfRings(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the performance latency histograms contained in
+**        cfe_es_perf.c
+**
+** \par Description
+**        This function tests timing marker entry/exit pairs and the write
+**        performance histograms command.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only runs if #CFE_ES_PERF_HISTOGRAMS is TRUE.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_Report, #UT_SetRtnCode, #UT_SetOSFail, #UT_SetBSP_Time
+** \sa #UT_SetSBTotalMsgLen, #UT_SendMsg, #CFE_ES_SetupPerfVariables
+** \sa #CFE_ES_PerfLogAdd, #CFE_ES_WritePerfHistCmd
+**
+******************************************************************************/
+void TestPerfHist(void);
+
 /*****************************************************************************/
 /**
 ** \brief Perform tests on the ES API functions contained in cfe_es_api.c
@@ -249,6 +294,7 @@ void TestPerf(void);
 ** \sa #CFE_ES_GetTaskInfo, #CFE_ES_CreateChildTask, #CFE_ES_DeleteChildTask
 ** \sa #CFE_ES_ExitChildTask, #CFE_ES_RegisterChildTask, #CFE_ES_WriteToSysLog
 ** \sa #CFE_ES_RegisterDriver, #CFE_ES_UnloadDriver, #CFE_ES_CalculateCRC
+** \sa #CFE_ES_UpdateCRC
 ** \sa #UT_SetBSPFail, #CFE_ES_RegisterCDS, #CFE_ES_CopyToCDS
 ** \sa #CFE_ES_RestoreFromCDS, #CFE_ES_LockSharedData, #CFE_ES_UnlockSharedData
 ** \sa #CFE_ES_RegisterGenCounter, #CFE_ES_GetGenCounterIDByName
@@ -328,6 +374,27 @@ void TestCDSMempool(void);
 ******************************************************************************/
 void TestESMempool(void);
 
+/*****************************************************************************/
+/**
+** \brief Perform tests on the ES buffered dump writer
+**
+** \par Description
+**        This function tests the buffered writer used to dump the ES and
+**        EVS logs to files.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.  
+**
+** \sa #UT_Text, #UT_InitData, #UT_Report, #UT_SetBSP_Time, #UT_SetRtnCode
+** \sa #CFE_ES_DumpInit, #CFE_ES_DumpWrite, #CFE_ES_DumpWriteRing
+** \sa #CFE_ES_DumpFinish, #CFE_ES_ElapsedMsec
+**
+******************************************************************************/
+void TestDump(void);
+
 #ifdef CFE_ARINC653
 /*****************************************************************************/
 /**
@@ -44,6 +44,7 @@ extern UT_SetRtn_t WriteSysLogRtn;
 extern UT_SetRtn_t SendMsgEventIDRtn;
 extern UT_SetRtn_t OSPrintRtn;
 extern UT_SetRtn_t FSWriteHdrRtn;
+extern UT_SetRtn_t FileWriteRtn;
 
 /*
 ** Functions
@@ -69,6 +70,8 @@ void OS_Application_Startup(void)
     UT_ADD_TEST(Test_FilterCmd);
     UT_ADD_TEST(Test_InvalidCmd);
     UT_ADD_TEST(Test_Misc);
+    UT_ADD_TEST(Test_DeferredSend);
+    UT_ADD_TEST(Test_CompactLog);
 }
 
 /*
@@ -170,7 +173,11 @@ void Test_Init(void)
     UT_SetRtnCode(&GetResetTypeRtn, -1, 1);
     CFE_EVS_GlobalData.EVS_LogPtr->LogMode = CFE_EVS_LOG_OVERWRITE;
     CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag = TRUE;
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+    CFE_EVS_GlobalData.EVS_LogPtr->Next = CFE_EVS_LOG_DATA_SIZE;
+#else
     CFE_EVS_GlobalData.EVS_LogPtr->Next = CFE_EVS_LOG_MAX;
+#endif
     CFE_EVS_EarlyInit();
     UT_Report(__FILE__, __LINE__,
               WriteSysLogRtn.value == EVS_SYSLOG_OFFSET + 5,
@@ -455,6 +462,7 @@ void Test_FilterRegistration(void)
     CFE_EVS_BinFilter_t filter[CFE_EVS_MAX_EVENT_FILTERS + 1];
     EVS_BinFilter_t     *FilterPtr = NULL;
     uint32              AppID;
+    uint32              HashIdx;
     CFE_TIME_SysTime_t  time = {0, 0};
 
 #ifdef UT_VERBOSE
@@ -545,8 +553,7 @@ void Test_FilterRegistration(void)
     /* Send last information message, which should cause filtering to lock */
     UT_InitData();
     CFE_ES_GetAppID(&AppID);
-    FilterPtr = EVS_FindEventID(0,
-        (EVS_BinFilter_t *) CFE_EVS_GlobalData.AppData[AppID].BinFilters);
+    FilterPtr = EVS_FindEventID(0, &CFE_EVS_GlobalData.AppData[AppID]);
     FilterPtr->Count = CFE_EVS_MAX_FILTER_COUNT - 1;
     UT_Report(__FILE__, __LINE__,
               CFE_EVS_SendEvent(0,
@@ -573,6 +580,37 @@ void Test_FilterRegistration(void)
               "CFE_EVS_SendEvent",
               "Locked info message should still be filtered");
 
+    /* Test filter lookup of event IDs that share a hash entry */
+    UT_InitData();
+    filter[0].EventID = 1;
+    filter[0].Mask = 0x0001;
+    filter[1].EventID = 1 + CFE_EVS_FILTER_HASH_SIZE;
+    filter[1].Mask = 0x0002;
+    CFE_EVS_Register(filter, 2, CFE_EVS_BINARY_FILTER);
+    FilterPtr = EVS_FindEventID(1 + CFE_EVS_FILTER_HASH_SIZE,
+                                &CFE_EVS_GlobalData.AppData[AppID]);
+    UT_Report(__FILE__, __LINE__,
+              FilterPtr != NULL && FilterPtr->Mask == 0x0002 &&
+              EVS_FindEventID(2, &CFE_EVS_GlobalData.AppData[AppID]) == NULL,
+              "EVS_FindEventID",
+              "Find filter with shared hash entry");
+
+    /* Test filter lookup after the filter ahead of it has been removed,
+     * with the new hash built beside the one lookups were using
+     */
+    UT_InitData();
+    HashIdx = CFE_EVS_GlobalData.AppData[AppID].FilterHashIdx;
+    CFE_EVS_GlobalData.AppData[AppID].BinFilters[0].EventID = CFE_EVS_FREE_SLOT;
+    EVS_IndexFilters(&CFE_EVS_GlobalData.AppData[AppID]);
+    UT_Report(__FILE__, __LINE__,
+              EVS_FindEventID(1 + CFE_EVS_FILTER_HASH_SIZE,
+                              &CFE_EVS_GlobalData.AppData[AppID]) == FilterPtr &&
+              EVS_FindEventID(1, &CFE_EVS_GlobalData.AppData[AppID]) == NULL &&
+              CFE_EVS_GlobalData.AppData[AppID].FilterHashIdx != HashIdx &&
+              CFE_EVS_GlobalData.AppData[AppID].FilterHash[HashIdx][1] == 1,
+              "EVS_IndexFilters",
+              "Find filter after removal of colliding filter");
+
     /* Return application to original state: re-register application */
     UT_InitData();
     UT_Report(__FILE__, __LINE__,
@@ -725,6 +763,7 @@ void Test_Format(void)
     /* Test event short format mode command was successful */
     UT_InitData();
     CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "Short format check *FAILED*");
+    UT_EVS_SendDeferredEvents();
     UT_Report(__FILE__, __LINE__,
               SendMsgEventIDRtn.value == 0 && SendMsgEventIDRtn.count == 0,
               "CFE_EVS_SetEventFormatModeCmd",
@@ -747,14 +786,17 @@ void Test_Format(void)
      */
     UT_InitData();
     CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "Long format check (SendEvent)");
+    UT_EVS_SendDeferredEvents();
     EventID[0] = SendMsgEventIDRtn.value;
     UT_SetRtnCode(&SendMsgEventIDRtn, -1, 0);
     CFE_EVS_SendTimedEvent(time, 0, CFE_EVS_INFORMATION,
                            "Long format check (SendTimedEvent)");
+    UT_EVS_SendDeferredEvents();
     EventID[1] = SendMsgEventIDRtn.value;
     UT_SetRtnCode(&SendMsgEventIDRtn, -1, 0);
     CFE_EVS_SendEventWithAppID(0, CFE_EVS_INFORMATION, 0,
                                "Long format check (SendEventWithAppID)");
+    UT_EVS_SendDeferredEvents();
     UT_Report(__FILE__, __LINE__,
               EventID[0] == 0 && EventID[1] == 0 &&
               SendMsgEventIDRtn.value == 0,
@@ -832,6 +874,7 @@ void Test_Ports(void)
     UT_InitData();
     UT_SetRtnCode(&OSPrintRtn, 0, 0);
     CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "Test ports message");
+    UT_EVS_SendDeferredEvents();
     UT_Report(__FILE__, __LINE__,
               SendMsgEventIDRtn.value == 0 &&
               OSPrintRtn.value == 4 * OS_PRINT_INCR &&
@@ -999,9 +1042,21 @@ void Test_Logging(void)
     {
         snprintf(tmpString, 100, "Log fill event %d", i);
         CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "%s", tmpString);
+        UT_EVS_SendDeferredEvents();
+    }
+
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+    /* Short events take less room in the compact log, keep adding them */
+    while (CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag == FALSE && i < 1000)
+    {
+        snprintf(tmpString, 100, "Log fill event %d", i++);
+        CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "%s", tmpString);
+        UT_EVS_SendDeferredEvents();
     }
+#endif
 
     CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "Log overfill event discard");
+    UT_EVS_SendDeferredEvents();
     UT_Report(__FILE__, __LINE__,
               CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag == TRUE &&
               CFE_EVS_GlobalData.EVS_LogPtr->LogMode == CFE_EVS_LOG_DISCARD,
@@ -1014,6 +1069,7 @@ void Test_Logging(void)
     UT_SendMsg((CFE_SB_MsgPtr_t) &modecmd, CFE_EVS_CMD_MID,
                CFE_EVS_SET_LOG_MODE_CC);
     CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "Log overfill event overwrite");
+    UT_EVS_SendDeferredEvents();
     UT_Report(__FILE__, __LINE__,
               CFE_EVS_GlobalData.EVS_LogPtr->LogFullFlag == TRUE &&
               CFE_EVS_GlobalData.EVS_LogPtr->LogMode == CFE_EVS_LOG_OVERWRITE,
@@ -1100,7 +1156,17 @@ void Test_Logging(void)
     /* Test successfully writing all log entries */
     UT_InitData();
     UT_SetRtnCode(&MutSemCreateRtn, OS_SUCCESS, 1);
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+    /* Fill the compact log with real entries, it has no fixed entry count */
+    for (i = 0; i < CFE_EVS_LOG_MAX; i++)
+    {
+        snprintf(tmpString, 100, "Log fill event %d", i);
+        CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "%s", tmpString);
+        UT_EVS_SendDeferredEvents();
+    }
+#else
     CFE_EVS_GlobalData.EVS_LogPtr->LogCount = CFE_EVS_LOG_MAX;
+#endif
     UT_Report(__FILE__, __LINE__,
               CFE_EVS_WriteLogFileCmd((CFE_SB_MsgPayloadPtr_t) &logfilecmd.Payload) == TRUE,
               "CFE_EVS_WriteLogFileCmd",
@@ -1110,7 +1176,9 @@ void Test_Logging(void)
     UT_InitData();
     UT_SetRtnCode(&MutSemCreateRtn, OS_SUCCESS, 1);
     UT_SetOSFail(OS_WRITE_FAIL);
+#if (CFE_EVS_COMPACT_LOG != TRUE)
     CFE_EVS_GlobalData.EVS_LogPtr->LogCount = CFE_EVS_LOG_MAX;
+#endif
     UT_Report(__FILE__, __LINE__,
               CFE_EVS_WriteLogFileCmd((CFE_SB_MsgPayloadPtr_t) &logfilecmd.Payload) == FALSE,
               "CFE_EVS_WriteLogFileCmd",
@@ -1646,15 +1714,19 @@ void Test_EventCmd(void)
     EventID[0] = SendMsgEventIDRtn.value;
     UT_SetRtnCode(&SendMsgEventIDRtn, -1, 0);
     CFE_EVS_SendEvent(0, CFE_EVS_DEBUG, "Debug message enabled");
+    UT_EVS_SendDeferredEvents();
     EventID[1] = SendMsgEventIDRtn.value;
     UT_SetRtnCode(&SendMsgEventIDRtn, -1, 0);
     CFE_EVS_SendEvent(0, CFE_EVS_INFORMATION, "Info message enabled");
+    UT_EVS_SendDeferredEvents();
     EventID[2] = SendMsgEventIDRtn.value;
     UT_SetRtnCode(&SendMsgEventIDRtn, -1, 0);
     CFE_EVS_SendEvent(0, CFE_EVS_ERROR, "Error message enabled");
+    UT_EVS_SendDeferredEvents();
     EventID[3] = SendMsgEventIDRtn.value;
     UT_SetRtnCode(&SendMsgEventIDRtn, -1, 0);
     CFE_EVS_SendEvent(0, CFE_EVS_CRITICAL, "Critical message enabled");
+    UT_EVS_SendDeferredEvents();
     UT_Report(__FILE__, __LINE__,
               EventID[0] == CFE_EVS_ENAAPPEVTTYPE_EID &&
               EventID[1] == 0 && EventID[2] == 0 && EventID[3] == 0 &&
@@ -2436,6 +2508,367 @@ void Test_Misc(void)
               "Maximum message length exceeded");
 }
 
+/*
+** Send the events waiting in the deferred event queue, as the EVS task would
+*/
+void UT_EVS_SendDeferredEvents(void)
+{
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+    EVS_SendDeferredEvents();
+#endif
+}
+
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+/*
+** Empty the deferred event queue and enable events from application 0
+*/
+void UT_EVS_ResetDeferredQueue(void)
+{
+    uint32 i;
+
+    CFE_EVS_GlobalData.DeferredQueue.Tail = 0;
+    CFE_EVS_GlobalData.DeferredQueue.Head = 0;
+    CFE_EVS_GlobalData.DeferredQueue.DropCounter = 0;
+
+    for (i = 0; i < CFE_EVS_DEFERRED_QUEUE_DEPTH; i++)
+    {
+        CFE_EVS_GlobalData.DeferredQueue.Event[i].Seq = i;
+    }
+
+    CFE_EVS_GlobalData.AppData[0].RegisterFlag = TRUE;
+    CFE_EVS_GlobalData.AppData[0].ActiveFlag = TRUE;
+    CFE_EVS_GlobalData.AppData[0].EventTypesActiveFlag =
+        CFE_EVS_DEBUG_BIT | CFE_EVS_INFORMATION_BIT |
+        CFE_EVS_ERROR_BIT | CFE_EVS_CRITICAL_BIT;
+}
+#endif
+
+/*
+** Test events queued for the EVS task to format and send
+*/
+void Test_DeferredSend(void)
+{
+#if (CFE_EVS_DEFERRED_SEND == TRUE)
+    EVS_DeferredQueue_t *QueuePtr = &CFE_EVS_GlobalData.DeferredQueue;
+    CFE_EVS_Packet_t     EVS_Pkt;
+    uint32               i;
+    char                 Spec[CFE_EVS_MAX_MESSAGE_LENGTH + 2];
+    char                 Str[CFE_EVS_MAX_MESSAGE_LENGTH + 2];
+    char                 Expected[CFE_EVS_MAX_MESSAGE_LENGTH];
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Deferred Send\n");
+#endif
+
+    /* Test that a queued event keeps a copy of its format string */
+    UT_InitData();
+    UT_EVS_ResetDeferredQueue();
+    strcpy(Spec, "Deferred %s %d");
+    CFE_EVS_SendEventWithAppID(1, CFE_EVS_INFORMATION, 0, Spec, "copy", 5);
+    strcpy(Spec, "Format string reused *FAILED*");
+    EVS_FormatDeferredEvent(&QueuePtr->Event[0], &EVS_Pkt);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 1 && SendMsgEventIDRtn.value == -1 &&
+              strcmp((char *) EVS_Pkt.Payload.Message, "Deferred copy 5") == 0,
+              "EVS_DeferEvent",
+              "Queued event keeps a copy of its format string");
+
+    /* Test that an event is discarded and counted when the queue is full,
+     * and that the count is reported when the queue is emptied
+     */
+    UT_InitData();
+    UT_EVS_ResetDeferredQueue();
+
+    for (i = 0; i <= CFE_EVS_DEFERRED_QUEUE_DEPTH; i++)
+    {
+        CFE_EVS_SendEventWithAppID(2, CFE_EVS_INFORMATION, 0, "Event %u",
+                                   (unsigned int) i);
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == CFE_EVS_DEFERRED_QUEUE_DEPTH &&
+              QueuePtr->DropCounter == 1,
+              "EVS_DeferEvent",
+              "Event discarded when the deferred queue is full");
+
+    EVS_SendDeferredEvents();
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Head == CFE_EVS_DEFERRED_QUEUE_DEPTH &&
+              QueuePtr->DropCounter == 0 &&
+              SendMsgEventIDRtn.value == CFE_EVS_DEFERRED_DROP_EID,
+              "EVS_SendDeferredEvents",
+              "Send queued events and report discarded events");
+
+    /* Test that the queue slots are reused once the queue has wrapped */
+    UT_InitData();
+    CFE_EVS_SendEventWithAppID(3, CFE_EVS_INFORMATION, 0, "Wrapped %u",
+                               (unsigned int) CFE_EVS_DEFERRED_QUEUE_DEPTH);
+    EVS_FormatDeferredEvent(&QueuePtr->Event[0], &EVS_Pkt);
+    snprintf(Expected, sizeof(Expected), "Wrapped %u",
+             (unsigned int) CFE_EVS_DEFERRED_QUEUE_DEPTH);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == CFE_EVS_DEFERRED_QUEUE_DEPTH + 1 &&
+              QueuePtr->Event[0].Seq == CFE_EVS_DEFERRED_QUEUE_DEPTH + 1 &&
+              strcmp((char *) EVS_Pkt.Payload.Message, Expected) == 0,
+              "EVS_DeferEvent",
+              "Queue slot reused after the queue wraps");
+
+    EVS_SendDeferredEvents();
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Head == CFE_EVS_DEFERRED_QUEUE_DEPTH + 1 &&
+              SendMsgEventIDRtn.value == 3,
+              "EVS_SendDeferredEvents",
+              "Send event from a wrapped queue");
+
+    /* Test that events the queue cannot carry are sent at once */
+    UT_InitData();
+    UT_EVS_ResetDeferredQueue();
+    CFE_EVS_SendEventWithAppID(4, CFE_EVS_INFORMATION, 0, "Width %*d", 4, 2);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 0 && SendMsgEventIDRtn.value == 4,
+              "EVS_DeferEvent",
+              "Unsupported conversion sent by the caller");
+
+    UT_InitData();
+    CFE_EVS_SendEventWithAppID(5, CFE_EVS_INFORMATION, 0,
+                               "%d %d %d %d %d %d %d %d %d",
+                               1, 2, 3, 4, 5, 6, 7, 8, 9);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 0 && SendMsgEventIDRtn.value == 5,
+              "EVS_DeferEvent",
+              "Too many arguments sent by the caller");
+
+    UT_InitData();
+    memset(Str, 'a', CFE_EVS_MAX_MESSAGE_LENGTH);
+    Str[CFE_EVS_MAX_MESSAGE_LENGTH] = '\0';
+    CFE_EVS_SendEventWithAppID(6, CFE_EVS_INFORMATION, 0, "%s", Str);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 0 && SendMsgEventIDRtn.value == 6,
+              "EVS_DeferEvent",
+              "Too much string data sent by the caller");
+
+    UT_InitData();
+    memset(Spec, 'b', CFE_EVS_MAX_MESSAGE_LENGTH);
+    Spec[CFE_EVS_MAX_MESSAGE_LENGTH] = '\0';
+    CFE_EVS_SendEventWithAppID(7, CFE_EVS_INFORMATION, 0, Spec);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 0 && SendMsgEventIDRtn.value == 7,
+              "EVS_DeferEvent",
+              "Format string too long to copy sent by the caller");
+
+    /* Test that a string precision limits the copy of the argument */
+    UT_InitData();
+    UT_EVS_ResetDeferredQueue();
+    CFE_EVS_SendEventWithAppID(8, CFE_EVS_INFORMATION, 0, "Prefix %.3s|",
+                               "abcdef");
+    EVS_FormatDeferredEvent(&QueuePtr->Event[0], &EVS_Pkt);
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 1 &&
+              strcmp(QueuePtr->Event[0].Strings, "abc") == 0 &&
+              strcmp((char *) EVS_Pkt.Payload.Message, "Prefix abc|") == 0,
+              "EVS_DeferEvent",
+              "String argument copied up to its precision");
+
+    /* Test that a deferred message too long for the packet is truncated
+     * the way vsnprintf truncates it
+     */
+    UT_InitData();
+    UT_EVS_ResetDeferredQueue();
+    memset(Str, 'c', 60);
+    Str[60] = '\0';
+    CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter = 0;
+    CFE_EVS_SendEventWithAppID(9, CFE_EVS_INFORMATION, 0, "%s%100d", Str, 9);
+    EVS_FormatDeferredEvent(&QueuePtr->Event[0], &EVS_Pkt);
+    snprintf(Expected, sizeof(Expected), "%s%100d", Str, 9);
+    Expected[sizeof(Expected) - 2] = CFE_EVS_MSG_TRUNCATED;
+    UT_Report(__FILE__, __LINE__,
+              QueuePtr->Tail == 1 &&
+              memcmp(EVS_Pkt.Payload.Message, Expected, sizeof(Expected)) == 0 &&
+              CFE_EVS_GlobalData.EVS_TlmPkt.Payload.MessageTruncCounter == 1,
+              "EVS_FormatDeferredEvent",
+              "Deferred message truncated");
+#endif
+}
+
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+/*
+** Add an event from application "UT_EVS" straight to the event log
+*/
+void UT_EVS_AddLogEvent(uint16 EventID, const char *Text)
+{
+    CFE_EVS_Packet_t EVS_Pkt;
+
+    memset(&EVS_Pkt, 0, sizeof(EVS_Pkt));
+    strncpy(EVS_Pkt.Payload.PacketID.AppName, "UT_EVS", OS_MAX_API_NAME);
+    EVS_Pkt.Payload.PacketID.EventID = EventID;
+    EVS_Pkt.Payload.PacketID.EventType = CFE_EVS_INFORMATION;
+    strncpy(EVS_Pkt.Payload.Message, Text, CFE_EVS_MAX_MESSAGE_LENGTH);
+    EVS_AddLog(&EVS_Pkt);
+}
+#endif
+
+/*
+** Test the compact event log
+*/
+void Test_CompactLog(void)
+{
+#if (CFE_EVS_COMPACT_LOG == TRUE)
+    CFE_EVS_Log_t         *LogPtr;
+    CFE_EVS_LogEntryHdr_t EntryHdr;
+    CFE_EVS_LogFileCmd_t  logfilecmd;
+    CFE_ES_ResetData_t    *CFE_EVS_ResetDataPtr;
+    cpuaddr               TempAddr;
+    uint32                resetAreaSize = 0;
+    uint32                LogCount;
+    uint32                i;
+    uint16                Overflow;
+    boolean               Straddled = FALSE;
+    char                  Text[CFE_EVS_MAX_MESSAGE_LENGTH];
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Compact Log\n");
+#endif
+
+    /* Start from an empty log in overwrite mode */
+    UT_SetSizeofESResetArea(sizeof(CFE_ES_ResetData_t));
+    CFE_PSP_GetResetArea(&TempAddr, &resetAreaSize);
+    CFE_EVS_ResetDataPtr = (CFE_ES_ResetData_t *)TempAddr;
+    CFE_EVS_GlobalData.EVS_LogPtr = &CFE_EVS_ResetDataPtr->EVS_Log;
+    CFE_EVS_GlobalData.EVS_TlmPkt.Payload.LogEnabled = TRUE;
+    LogPtr = CFE_EVS_GlobalData.EVS_LogPtr;
+    EVS_ClearLog();
+    LogPtr->LogMode = CFE_EVS_LOG_OVERWRITE;
+    logfilecmd.Payload.LogFilename[0] = '\0';
+
+    /* Test that identical events in a row share one log entry */
+    UT_InitData();
+    UT_EVS_AddLogEvent(1, "Repeated event");
+    UT_EVS_AddLogEvent(1, "Repeated event");
+    UT_EVS_AddLogEvent(1, "Repeated event");
+    memcpy(&EntryHdr, &LogPtr->LogData[LogPtr->Last], sizeof(EntryHdr));
+    UT_Report(__FILE__, __LINE__,
+              LogPtr->LogCount == 1 && EntryHdr.RepeatCount == 3 &&
+              EntryHdr.TextLength == strlen("Repeated event") &&
+              LogPtr->Used == EntryHdr.EntrySize &&
+              LogPtr->Next == EntryHdr.EntrySize,
+              "EVS_AddLog",
+              "Repeated events collapsed into one entry");
+
+    /* Test that an event with the same ID but other text gets its own entry */
+    UT_InitData();
+    UT_EVS_AddLogEvent(1, "Repeated evenT");
+    UT_Report(__FILE__, __LINE__,
+              LogPtr->LogCount == 2 && LogPtr->Last == EntryHdr.EntrySize &&
+              EVS_IsLogValid() == TRUE,
+              "EVS_AddLog",
+              "Different event text starts a new entry");
+
+    /* Test that the log file gets the first and the last event of a
+     * repeated entry (three packets for the two entries)
+     */
+    UT_InitData();
+    UT_SetRtnCode(&FileWriteRtn, OS_ERROR, 4);
+    UT_Report(__FILE__, __LINE__,
+              CFE_EVS_WriteLogFileCmd((CFE_SB_MsgPayloadPtr_t) &logfilecmd.Payload) == TRUE &&
+              FileWriteRtn.count == 1,
+              "CFE_EVS_WriteLogFileCmd",
+              "Write compact log with a repeated entry");
+
+    /* Test a write failure on the packet carrying the repeat count */
+    UT_InitData();
+    UT_SetRtnCode(&FileWriteRtn, OS_ERROR, 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_EVS_WriteLogFileCmd((CFE_SB_MsgPayloadPtr_t) &logfilecmd.Payload) == FALSE &&
+              FileWriteRtn.count == 0,
+              "CFE_EVS_WriteLogFileCmd",
+              "Write compact log - write of repeated event failed");
+
+    /* Test that the log wraps in overwrite mode, dropping the oldest entries
+     * until an entry runs across the end of the log data
+     */
+    UT_InitData();
+
+    for (i = 0; (LogPtr->LogFullFlag == FALSE || Straddled == FALSE) && i < 1000; i++)
+    {
+        snprintf(Text, sizeof(Text), "Wrap event %lu%.*s", (unsigned long) i,
+                 (int) (i % 7), "xxxxxxx");
+        UT_EVS_AddLogEvent(2, Text);
+        Straddled = (LogPtr->Next < LogPtr->Last && LogPtr->Next != 0);
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              LogPtr->LogFullFlag == TRUE && Straddled == TRUE &&
+              LogPtr->LogOverflowCounter > 0 && LogPtr->First != 0 &&
+              LogPtr->Used <= CFE_EVS_LOG_DATA_SIZE &&
+              EVS_IsLogValid() == TRUE,
+              "EVS_AddLog",
+              "Log wrapped in overwrite mode");
+
+    /* Test that a repeat of an entry across the end of the log data is
+     * counted in that entry, without an overflow
+     */
+    UT_InitData();
+    LogCount = LogPtr->LogCount;
+    Overflow = LogPtr->LogOverflowCounter;
+    UT_EVS_AddLogEvent(2, Text);
+    UT_Report(__FILE__, __LINE__,
+              LogPtr->LogCount == LogCount &&
+              LogPtr->LogOverflowCounter == Overflow &&
+              EVS_IsLogValid() == TRUE,
+              "EVS_AddLog",
+              "Repeat of a wrapped entry collapsed");
+
+    /* Test writing a wrapped log, one packet per entry plus the repeat */
+    UT_InitData();
+    UT_SetRtnCode(&FileWriteRtn, OS_ERROR, LogCount + 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_EVS_WriteLogFileCmd((CFE_SB_MsgPayloadPtr_t) &logfilecmd.Payload) == TRUE &&
+              FileWriteRtn.count == 1,
+              "CFE_EVS_WriteLogFileCmd",
+              "Write wrapped compact log");
+
+    /* Test that a new event is counted and discarded in discard mode */
+    UT_InitData();
+    LogPtr->LogMode = CFE_EVS_LOG_DISCARD;
+    LogCount = LogPtr->LogCount;
+    Overflow = LogPtr->LogOverflowCounter;
+    UT_EVS_AddLogEvent(3, "Discarded event");
+    UT_Report(__FILE__, __LINE__,
+              LogPtr->LogCount == LogCount &&
+              LogPtr->LogOverflowCounter == Overflow + 1 &&
+              EVS_IsLogValid() == TRUE,
+              "EVS_AddLog",
+              "Event discarded from a full log");
+
+    /* Test clearing the log */
+    UT_InitData();
+    UT_SetSBTotalMsgLen(sizeof(CFE_SB_CmdHdr_t));
+    UT_SendMsg((CFE_SB_MsgPtr_t) &logfilecmd, CFE_EVS_CMD_MID,
+               CFE_EVS_CLEAR_LOG_CC);
+    UT_Report(__FILE__, __LINE__,
+              LogPtr->LogCount == 0 && LogPtr->Used == 0 &&
+              LogPtr->First == 0 && LogPtr->Next == 0 &&
+              LogPtr->LogFullFlag == FALSE && LogPtr->LogOverflowCounter == 0 &&
+              LogPtr->LogMode == CFE_EVS_LOG_DISCARD &&
+              EVS_IsLogValid() == TRUE,
+              "EVS_ClearLog",
+              "Clear compact log");
+
+    /* Test that a log with a bad entry is cleared after a processor reset */
+    UT_InitData();
+    LogPtr->LogMode = CFE_EVS_LOG_OVERWRITE;
+    UT_EVS_AddLogEvent(4, "Corrupted event");
+    LogPtr->LogData[0]++;
+    UT_SetRtnCode(&GetResetTypeRtn, -1, 1);
+    CFE_EVS_EarlyInit();
+    UT_Report(__FILE__, __LINE__,
+              WriteSysLogRtn.value == EVS_SYSLOG_OFFSET + 5 &&
+              CFE_EVS_GlobalData.EVS_LogPtr->LogCount == 0,
+              "CFE_EVS_EarlyInit",
+              "Compact log with a bad entry cleared");
+#endif
+}
+
 /* Unit test specific call to process SB messages */
 void UT_ProcessSBMsg(CFE_SB_Msg_t *MsgPtr)
 {
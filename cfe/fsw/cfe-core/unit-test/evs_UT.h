@@ -348,6 +348,106 @@ void Test_InvalidCmd(void);
 ******************************************************************************/
 void Test_Misc(void);
 
+/*****************************************************************************/
+/**
+** \brief Send the events waiting in the deferred event queue
+**
+** \par Description
+**        This function sends the queued events the way the EVS task would, so
+**        that tests of event output give the same results whether or not
+**        events are deferred.
+**
+** \par Assumptions, External Events, and Notes:
+**        Does nothing if #CFE_EVS_DEFERRED_SEND is FALSE.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #EVS_SendDeferredEvents
+**
+******************************************************************************/
+void UT_EVS_SendDeferredEvents(void);
+
+/*****************************************************************************/
+/**
+** \brief Empty the deferred event queue
+**
+** \par Description
+**        This function empties the deferred event queue and enables all
+**        event types for application 0.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only defined if #CFE_EVS_DEFERRED_SEND is TRUE.
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void UT_EVS_ResetDeferredQueue(void);
+
+/*****************************************************************************/
+/**
+** \brief Test deferred event formatting
+**
+** \par Description
+**        This function tests events queued for the EVS task: the copy of the
+**        format string, a full and a wrapped queue, events sent at once
+**        because the queue cannot carry them, and truncation.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only runs if #CFE_EVS_DEFERRED_SEND is TRUE.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_Report, #UT_EVS_ResetDeferredQueue
+** \sa #CFE_EVS_SendEventWithAppID, #EVS_FormatDeferredEvent
+** \sa #EVS_SendDeferredEvents
+**
+******************************************************************************/
+void Test_DeferredSend(void);
+
+/*****************************************************************************/
+/**
+** \brief Add an event to the event log
+**
+** \par Description
+**        This function builds an informational event packet from application
+**        "UT_EVS" with the given event ID and text and adds it to the event
+**        log.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only defined if #CFE_EVS_COMPACT_LOG is TRUE.
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void UT_EVS_AddLogEvent(uint16 EventID, const char *Text);
+
+/*****************************************************************************/
+/**
+** \brief Test the compact event log
+**
+** \par Description
+**        This function tests the compact event log: repeated events kept in
+**        one entry, a log wrapping across the end of its data, discard mode,
+**        clearing the log, writing it to a file and a bad log found after a
+**        processor reset.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only runs if #CFE_EVS_COMPACT_LOG is TRUE.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_Report, #UT_EVS_AddLogEvent, #EVS_AddLog
+** \sa #EVS_ClearLog, #EVS_IsLogValid, #CFE_EVS_WriteLogFileCmd
+** \sa #CFE_EVS_EarlyInit
+**
+******************************************************************************/
+void Test_CompactLog(void);
+
 /*****************************************************************************/
 /**
 ** \brief Unit test specific call to process SB messages
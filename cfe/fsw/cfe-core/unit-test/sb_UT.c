@@ -52,6 +52,11 @@ extern UT_SetRtn_t EVS_SendEventRtn;
 extern UT_SetRtn_t FSWriteHdrRtn;
 extern UT_SetRtn_t FileWriteRtn;
 extern UT_SetRtn_t ES_GetTaskInfoRtn;
+extern UT_SetRtn_t BinSemTimedWaitRtn;
+extern UT_SetRtn_t OSBinSemTimedWaitRtn;
+extern UT_SetRtn_t OS_BinSemCreateRtn;
+extern uint32      UT_BinSemTimedWaitMsecs;
+extern uint32      UT_BinSemTimedWaitUsecs;
 
 /*
 ** Functions
@@ -88,6 +93,57 @@ void SB_ResetUnitTest(void)
     CFE_SB_EarlyInit();
 } /* end SB_ResetUnitTest */
 
+/*
+** Force the next pipe queue creation to return Status, in whichever pipe
+** backend is built
+*/
+void SB_UT_SetPipeCreateRtn(int32 Status)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+    UT_SetRtnCode(&OS_BinSemCreateRtn, Status, 1);
+#else
+    UT_SetRtnCode(&QueueCreateRtn, Status, 1);
+#endif
+} /* end SB_UT_SetPipeCreateRtn */
+
+/*
+** Force the next read of an empty pipe with the given timeout to return
+** Status, in whichever pipe backend is built
+*/
+void SB_UT_SetPipeGetRtn(int32 Status, int32 TimeOut)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+    /* An empty ring is read by waiting on its semaphore */
+    if (TimeOut == CFE_SB_PEND_FOREVER)
+    {
+        UT_SetBinSemFail(1);
+    }
+    else if (Status == OS_QUEUE_TIMEOUT)
+    {
+        UT_SetRtnCode(&BinSemTimedWaitRtn, OS_SEM_TIMEOUT, 1);
+    }
+    else
+    {
+        UT_SetRtnCode(&BinSemTimedWaitRtn, Status, 1);
+    }
+#else
+    UT_SetRtnCode(&QueueGetRtn, Status, 1);
+#endif
+} /* end SB_UT_SetPipeGetRtn */
+
+/*
+** Make the next write to a pipe find it full, in whichever pipe backend is
+** built.  A ring pipe is shrunk to the messages already on it.
+*/
+void SB_UT_SetPipeFull(CFE_SB_PipeId_t PipeId)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+    CFE_SB.PipeRing[PipeId].Depth = CFE_SB.PipeRing[PipeId].Count;
+#else
+    UT_SetRtnCode(&QueuePutRtn, OS_QUEUE_FULL, 1);
+#endif
+} /* end SB_UT_SetPipeFull */
+
 /*
 ** Function for calling SB application initialization
 ** test functions
@@ -265,10 +321,10 @@ void Test_SB_AppInit_CrPipeFail(void)
 
     SB_ResetUnitTest();
 
-    /* To fail the pipe create, force the OS_QueueCreate call to return some
-     * type of error code.
+    /* To fail the pipe create, force the OS_QueueCreate (or, for a ring pipe,
+     * OS_BinSemCreate) call to return some type of error code.
      */
-    UT_SetRtnCode(&QueueCreateRtn, OS_ERROR, 1);
+    SB_UT_SetPipeCreateRtn(OS_ERROR);
     ExpRtn = CFE_SB_PIPE_CR_ERR;
     ActRtn = CFE_SB_AppInit();
 
@@ -535,7 +591,7 @@ void Test_SB_Main_RcvErr(void)
 #endif
 
     SB_ResetUnitTest();
-    UT_SetRtnCode(&QueueGetRtn, -1, 1);
+    SB_UT_SetPipeGetRtn(-1, CFE_SB_PEND_FOREVER);
     CFE_SB_TaskMain();
     ExpRtn = 5;
     ActRtn = UT_GetNumEventsSent();
@@ -2592,6 +2648,14 @@ void Test_SB_EarlyInit_SemCreateError(void)
     UT_Report(__FILE__, __LINE__,
               CFE_SB_EarlyInit() == OS_ERR_NO_FREE_IDS,
               "CFE_SB_EarlyInit", "Sem Create error logic");
+
+#if (CFE_SB_LOCKLESS_SEND == TRUE)
+    SB_ResetUnitTest();
+    UT_SetRtnCode(&MutSemCreateRtn, OS_ERR_NO_FREE_IDS, 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_SB_EarlyInit() == OS_ERR_NO_FREE_IDS,
+              "CFE_SB_EarlyInit", "Sender sync sem create error logic");
+#endif
 } /* end Test_SB_EarlyInit_SemCreateError */
 
 /*
@@ -4149,6 +4213,7 @@ void Test_Unsubscribe_API(void)
     Test_Unsubscribe_FirstDestWithMany();
     Test_Unsubscribe_MiddleDestWithMany();
     Test_Unsubscribe_GetDestPtr();
+    Test_Unsubscribe_SendAfterRemove();
 
 #ifdef UT_VERBOSE
     UT_Text("End Test_Unsubscribe_API\n");
@@ -4871,6 +4936,84 @@ void Test_Unsubscribe_GetDestPtr(void)
               "Get destination pointer");
 } /* end Test_Unsubscribe_GetDestPtr */
 
+/*
+** Test that a message sent after a destination is removed reaches the
+** remaining destinations and leaves no sender registered
+*/
+void Test_Unsubscribe_SendAfterRemove(void)
+{
+    CFE_SB_MsgId_t         MsgId = 0x0805;
+    CFE_SB_PipeId_t        TestPipe1;
+    CFE_SB_PipeId_t        TestPipe2;
+    CFE_SB_PipeId_t        TestPipe3;
+    CFE_SB_DestinationD_t  *DestPtr;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_MsgPtr_t        TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint16                 PipeDepth = 50;
+    int32                  ExpRtn;
+    int32                  ActRtn;
+    int32                  TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for Unsubscribe, Send After Remove");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_CreatePipe(&TestPipe1, PipeDepth, "TestPipe1");
+    CFE_SB_CreatePipe(&TestPipe2, PipeDepth, "TestPipe2");
+    CFE_SB_CreatePipe(&TestPipe3, PipeDepth, "TestPipe3");
+    CFE_SB_Subscribe(MsgId, TestPipe1);
+    CFE_SB_Subscribe(MsgId, TestPipe2);
+    CFE_SB_Subscribe(MsgId, TestPipe3);
+    CFE_SB_Unsubscribe(MsgId, TestPipe2);
+
+    ExpRtn = CFE_SUCCESS;
+    ActRtn = CFE_SB_SendMsg(TlmPktPtr);
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return in send after remove, exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    DestPtr = CFE_SB_GetDestPtr(MsgId, TestPipe1);
+
+    if (DestPtr == NULL || DestPtr->BuffCount != 1)
+    {
+        UT_Text("Message not delivered to first destination after remove");
+        TestStat = CFE_FAIL;
+    }
+
+    DestPtr = CFE_SB_GetDestPtr(MsgId, TestPipe3);
+
+    if (DestPtr == NULL || DestPtr->BuffCount != 1)
+    {
+        UT_Text("Message not delivered to last destination after remove");
+        TestStat = CFE_FAIL;
+    }
+
+    if (CFE_SB.SendersActive[0] != 0 || CFE_SB.SendersActive[1] != 0)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Senders still registered after send, exp=0/0, act=%lu/%lu",
+                 (unsigned long) CFE_SB.SendersActive[0],
+                 (unsigned long) CFE_SB.SendersActive[1]);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(TestPipe1);
+    CFE_SB_DeletePipe(TestPipe2);
+    CFE_SB_DeletePipe(TestPipe3);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_Unsubscribe_API",
+              "Send after remove");
+} /* end Test_Unsubscribe_SendAfterRemove */
+
 /*
 ** Function for calling SB send message API test functions
 */
@@ -4888,6 +5031,7 @@ void Test_SendMsg_API(void)
     Test_SendMsg_SequenceCount();
     Test_SendMsg_QueuePutError();
     Test_SendMsg_PipeFull();
+    Test_SendMsg_PipeFullCountsRestored();
     Test_SendMsg_MsgLimitExceeded();
     Test_SendMsg_GetPoolBufErr();
     Test_SendMsg_ZeroCopyGetPtr();
@@ -4899,6 +5043,8 @@ void Test_SendMsg_API(void)
     Test_SendMsg_InvalidMsgId_ZeroCopy();
     Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy();
     Test_SendMsg_NoSubscribers_ZeroCopy();
+    Test_SendMsg_Batch();
+    Test_SendMsg_SenderCache();
 
 #ifdef UT_VERBOSE
     UT_Text("End Test_SendMsg_API\n");
@@ -5337,6 +5483,8 @@ void Test_SendMsg_SequenceCount(void)
 */
 void Test_SendMsg_QueuePutError(void)
 {
+    /* A write to a ring pipe only fails when the ring is full */
+#if (CFE_SB_RING_PIPES == FALSE)
     CFE_SB_PipeId_t  PipeId4Error;
     CFE_SB_MsgId_t   MsgId = 0x0818;
     SB_UT_Test_Tlm_t TlmPkt;
@@ -5389,6 +5537,7 @@ void Test_SendMsg_QueuePutError(void)
     CFE_SB_DeletePipe(PipeId4Error);
     UT_Report(__FILE__, __LINE__,
               TestStat, "Test_SendMsg_API", "QueuePut error test");
+#endif
 } /* end Test_SendMsg_QueuePutError */
 
 /*
@@ -5427,8 +5576,8 @@ void Test_SendMsg_PipeFull(void)
         TestStat = CFE_FAIL;
     }
 
-    /* Tell the QueuePut stub to return OS_QUEUE_FULL on its next call */
-    UT_SetRtnCode(&QueuePutRtn, OS_QUEUE_FULL, 1);
+    /* Make the next write to the pipe find it full */
+    SB_UT_SetPipeFull(PipeId);
     ActRtn = CFE_SB_SendMsg(TlmPktPtr);
 
     /* Pipe overflow causes SendMsg to return CFE_SUCCESS */
@@ -5466,6 +5615,78 @@ void Test_SendMsg_PipeFull(void)
               TestStat, "Test_SendMsg_API", "Pipe full test");
 } /* end Test_SendMsg_PipeFull */
 
+/*
+** Test that the message limit and pipe depth counts taken for a destination
+** are given back when the message cannot be put on the pipe
+*/
+void Test_SendMsg_PipeFullCountsRestored(void)
+{
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_MsgId_t         MsgId = 0x0812;
+    CFE_SB_DestinationD_t  *DestPtr;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_MsgPtr_t        TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    int32                  PipeDepth = 2;
+    int32                  ExpRtn;
+    int32                  ActRtn;
+    int32                  TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for Pipe Full Counts Restored");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "PipeFullTestPipe");
+    CFE_SB_Subscribe(MsgId, PipeId);
+    CFE_SB_SendMsg(TlmPktPtr);
+
+    /* Make the next write to the pipe find it full */
+    SB_UT_SetPipeFull(PipeId);
+    CFE_SB_SendMsg(TlmPktPtr);
+
+    DestPtr = CFE_SB_GetDestPtr(MsgId, PipeId);
+    ExpRtn = 1;
+    ActRtn = (DestPtr == NULL) ? -1 : DestPtr->BuffCount;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected destination buffer count, exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ActRtn = CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected pipe depth in use, exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Only the buffer on the pipe should still be allocated */
+    CFE_SB_CollectBufStats();
+    ActRtn = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected SB buffers in use, exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_SendMsg_API", "Pipe full counts restored test");
+} /* end Test_SendMsg_PipeFullCountsRestored */
+
 /*
 ** Test send message response to too many messages sent to the pipe
 */
@@ -6482,6 +6703,176 @@ void Test_SendMsg_NoSubscribers_ZeroCopy(void)
               "No subscribers test (ZeroCopy)");
 } /* end Test_SendMsg_NoSubscribers_ZeroCopy */
 
+/*
+** Test sending several messages in one batch, including one that is rejected
+*/
+void Test_SendMsg_Batch(void)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = 0x0818;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  MsgPtrs[3];
+    int32            Status[3];
+    uint32           PipeDepth = 10;
+    int32            ExpRtn;
+    int32            ActRtn;
+    int32            TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for Batch Send");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "BatchTestPipe");
+    CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt = 0;
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_Subscribe(MsgId, PipeId);
+    MsgPtrs[0] = TlmPktPtr;
+    MsgPtrs[1] = NULL;
+    MsgPtrs[2] = TlmPktPtr;
+    ActRtn = CFE_SB_SendMsgBatch(MsgPtrs, 3, Status);
+    ExpRtn = CFE_SB_BAD_ARGUMENT;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return in batch send test, exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    if (Status[0] != CFE_SUCCESS || Status[1] != CFE_SB_BAD_ARGUMENT ||
+        Status[2] != CFE_SUCCESS)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected per message status in batch send test, "
+                   "act=0x%lx,0x%lx,0x%lx",
+                 (unsigned long) Status[0], (unsigned long) Status[1],
+                 (unsigned long) Status[2]);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Both valid messages are on the pipe */
+    ExpRtn = 2;
+    ActRtn = CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected pipe depth in use, exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ExpRtn = 1;
+    ActRtn = CFE_SB.HKTlmMsg.Payload.MsgSendErrCnt;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected send error count, exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    if (UT_EventIsInHistory(CFE_SB_SEND_BAD_ARG_EID) == FALSE)
+    {
+        UT_Text("CFE_SB_SEND_BAD_ARG_EID not sent");
+        TestStat = CFE_FAIL;
+    }
+
+    /* A NULL array is rejected */
+    ActRtn = CFE_SB_SendMsgBatch(NULL, 3, NULL);
+    ExpRtn = CFE_SB_BAD_ARGUMENT;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return in batch send null array test, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_SendMsg_API", "Batch send test");
+} /* end Test_SendMsg_Batch */
+
+/*
+** Test that the sender identity is cached per task and dropped by ES
+*/
+void Test_SendMsg_SenderCache(void)
+{
+    CFE_SB_MsgPtr_t   PtrToMsg;
+    CFE_SB_MsgId_t    MsgId = 0x0809;
+    CFE_SB_PipeId_t   PipeId;
+    CFE_SB_SenderId_t *GLSPtr;
+    SB_UT_Test_Tlm_t  TlmPkt;
+    CFE_SB_MsgPtr_t   TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32            PipeDepth = 10;
+    uint32            TskIdx;
+    int32             TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for Sender Identity Cache");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB.SenderReporting = 1;
+    OS_ConvertToArrayIndex(OS_TaskGetId(), &TskIdx);
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe");
+    CFE_SB_Subscribe(MsgId, PipeId);
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_SendMsg(TlmPktPtr);
+
+    if (CFE_SB.SenderCache[TskIdx].Valid != TRUE)
+    {
+        UT_Text("Sender identity not cached by send");
+        TestStat = CFE_FAIL;
+    }
+
+    /* The message carries the cached identity */
+    CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL);
+
+    if (CFE_SB_GetLastSenderId(&GLSPtr, PipeId) != CFE_SUCCESS ||
+        strncmp(GLSPtr->AppName, CFE_SB.SenderCache[TskIdx].Sender.AppName,
+                OS_MAX_API_NAME) != 0)
+    {
+        UT_Text("Unexpected sender identity in received message");
+        TestStat = CFE_FAIL;
+    }
+
+    /* ES drops the entry when the task slot is reused */
+    CFE_SB_InvalidateSenderCache(OS_TaskGetId());
+
+    if (CFE_SB.SenderCache[TskIdx].Valid != FALSE)
+    {
+        UT_Text("Sender identity not invalidated");
+        TestStat = CFE_FAIL;
+    }
+
+    /* A task that ES does not know is not cached */
+    UT_SetRtnCode(&ES_GetTaskInfoRtn, CFE_ES_ERR_APPID, 1);
+    CFE_SB_SendMsg(TlmPktPtr);
+
+    if (CFE_SB.SenderCache[TskIdx].Valid != FALSE)
+    {
+        UT_Text("Sender identity of an unknown task was cached");
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_SendMsg_API", "Sender identity cache test");
+} /* end Test_SendMsg_SenderCache */
+
 /*
 ** Function for calling SB receive message API test functions
 */
@@ -6501,6 +6892,8 @@ void Test_RcvMsg_API(void)
     Test_RcvMsg_Timeout();
     Test_RcvMsg_PipeReadError();
     Test_RcvMsg_PendForever();
+    Test_RcvMsg_Batch();
+    Test_RcvMsg_MakeWritable();
     Test_RcvMsg_InvalidBufferPtr();
 
 #ifdef UT_VERBOSE
@@ -6911,7 +7304,7 @@ void Test_RcvMsg_Timeout(void)
     SB_ResetUnitTest();
     CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe");
 
-    UT_SetRtnCode(&QueueGetRtn, OS_QUEUE_TIMEOUT, 1);
+    SB_UT_SetPipeGetRtn(OS_QUEUE_TIMEOUT, TimeOut);
 
     ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, TimeOut);
     ExpRtn = CFE_SB_TIME_OUT;
@@ -6966,7 +7359,7 @@ void Test_RcvMsg_PipeReadError(void)
 
     SB_ResetUnitTest();
     CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe");
-    UT_SetRtnCode(&QueueGetRtn, OS_ERROR, 1);
+    SB_UT_SetPipeGetRtn(OS_ERROR, CFE_SB_PEND_FOREVER);
     ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER);
     ExpRtn = CFE_SB_PIPE_RD_ERR;
 
@@ -7089,23 +7482,264 @@ void Test_RcvMsg_PendForever(void)
 } /* end Test_RcvMsg_PendForever */
 
 /*
-** Test releasing zero copy buffers for all pipes owned by a given app ID
+** Test receiving several messages from a pipe with one call
 */
-void Test_CleanupApp_API(void)
+void Test_RcvMsg_Batch(void)
 {
-    CFE_SB_PipeId_t         PipeId;
-    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
-    uint16                  PipeDepth = 50;
-    int32                   ExpRtn;
-    int32                   ActRtn;
-    int32                   TestStat = CFE_PASS;
-
-#ifdef UT_VERBOSE
-    UT_Text("Begin Test for CleanupApp");
-#endif
-
-    SB_ResetUnitTest();
-    CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe");
+    CFE_SB_MsgPtr_t  PtrsToMsg[2];
+    CFE_SB_MsgId_t   MsgId = 0x0809;
+    CFE_SB_PipeId_t  PipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32           PipeDepth = 10;
+    uint32           NumMsgs;
+    uint32           i;
+    int32            ExpRtn;
+    int32            ActRtn;
+    int32            TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for Batch Receive");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe");
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_Subscribe(MsgId, PipeId);
+
+    for (i = 0; i < 3; i++)
+    {
+        CFE_SB_SendMsg(TlmPktPtr);
+    }
+
+    /* First call is limited by MaxMsgs */
+    ActRtn = CFE_SB_RcvMsgBatch(PtrsToMsg, 2, &NumMsgs, PipeId, CFE_SB_POLL);
+    ExpRtn = CFE_SUCCESS;
+
+    if (ActRtn != ExpRtn || NumMsgs != 2 ||
+        CFE_SB_GetMsgId(PtrsToMsg[0]) != MsgId ||
+        CFE_SB_GetMsgId(PtrsToMsg[1]) != MsgId)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from first batch receive, "
+                   "exp=0x%lx/2, act=0x%lx/%lu",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn,
+                 (unsigned long) NumMsgs);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Second call takes what is left on the pipe */
+    ActRtn = CFE_SB_RcvMsgBatch(PtrsToMsg, 2, &NumMsgs, PipeId, CFE_SB_POLL);
+
+    if (ActRtn != ExpRtn || NumMsgs != 1)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from second batch receive, "
+                   "exp=0x%lx/1, act=0x%lx/%lu",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn,
+                 (unsigned long) NumMsgs);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Pipe is now empty */
+    ActRtn = CFE_SB_RcvMsgBatch(PtrsToMsg, 2, &NumMsgs, PipeId, CFE_SB_POLL);
+    ExpRtn = CFE_SB_NO_MESSAGE;
+
+    if (ActRtn != ExpRtn || NumMsgs != 0)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from empty batch receive, "
+                   "exp=0x%lx/0, act=0x%lx/%lu",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn,
+                 (unsigned long) NumMsgs);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    if (CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse != 0)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected pipe depth in use after batch receive, "
+                   "exp=0, act=%lu",
+                 (unsigned long) CFE_SB.StatTlmMsg.Payload.PipeDepthStats[PipeId].InUse);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Every buffer taken by the batches has been released */
+    CFE_SB_CollectBufStats();
+
+    if (CFE_SB.StatTlmMsg.Payload.SBBuffersInUse != 0)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected buffers in use after batch receive, "
+                   "exp=0, act=%lu",
+                 (unsigned long) CFE_SB.StatTlmMsg.Payload.SBBuffersInUse);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Null message count */
+    ActRtn = CFE_SB_RcvMsgBatch(PtrsToMsg, 2, NULL, PipeId, CFE_SB_POLL);
+    ExpRtn = CFE_SB_BAD_ARGUMENT;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from batch receive with null count, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    if (UT_EventIsInHistory(CFE_SB_RCV_BAD_ARG_EID) == FALSE)
+    {
+        UT_Text("CFE_SB_RCV_BAD_ARG_EID not sent");
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_RcvMsg_API", "Batch receive test");
+} /* end Test_RcvMsg_Batch */
+
+/*
+** Test taking ownership of received messages with CFE_SB_MakeWritable
+*/
+void Test_RcvMsg_MakeWritable(void)
+{
+    CFE_SB_MsgPtr_t         PtrToMsg1;
+    CFE_SB_MsgPtr_t         PtrToMsg2;
+    CFE_SB_MsgPtr_t         RcvdPtr;
+    CFE_SB_MsgId_t          MsgId = 0x0809;
+    CFE_SB_PipeId_t         PipeId1;
+    CFE_SB_PipeId_t         PipeId2;
+    CFE_SB_ZeroCopyHandle_t Handle1 = 0;
+    CFE_SB_ZeroCopyHandle_t Handle2 = 0;
+    SB_UT_Test_Tlm_t        TlmPkt;
+    CFE_SB_MsgPtr_t         TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    uint32                  PipeDepth = 10;
+    int32                   ExpRtn;
+    int32                   ActRtn;
+    int32                   TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for MakeWritable");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1");
+    CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2");
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_Subscribe(MsgId, PipeId1);
+    CFE_SB_Subscribe(MsgId, PipeId2);
+    TlmPkt.Tlm32Param1 = 0x11223344;
+    CFE_SB_SendMsg(TlmPktPtr);
+
+    /* Buffer is shared with the second pipe, so a copy is made */
+    CFE_SB_RcvMsg(&PtrToMsg1, PipeId1, CFE_SB_POLL);
+    RcvdPtr = PtrToMsg1;
+    ActRtn = CFE_SB_MakeWritable(&PtrToMsg1, PipeId1, &Handle1);
+    ExpRtn = CFE_SUCCESS;
+
+    if (ActRtn != ExpRtn || PtrToMsg1 == RcvdPtr || Handle1 == 0 ||
+        ((SB_UT_Test_Tlm_t *) PtrToMsg1)->Tlm32Param1 != 0x11223344)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from MakeWritable of shared buffer, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ((SB_UT_Test_Tlm_t *) PtrToMsg1)->Tlm32Param1 = 0x55667788;
+
+    /* Second pipe sees the original data and now holds the only reference */
+    CFE_SB_RcvMsg(&PtrToMsg2, PipeId2, CFE_SB_POLL);
+    RcvdPtr = PtrToMsg2;
+
+    if (((SB_UT_Test_Tlm_t *) PtrToMsg2)->Tlm32Param1 != 0x11223344)
+    {
+        UT_Text("Shared buffer modified through a writable copy");
+        TestStat = CFE_FAIL;
+    }
+
+    ActRtn = CFE_SB_MakeWritable(&PtrToMsg2, PipeId2, &Handle2);
+
+    if (ActRtn != ExpRtn || PtrToMsg2 != RcvdPtr || Handle2 == 0 ||
+        CFE_SB.PipeTbl[PipeId2].CurrentBuff != NULL)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from MakeWritable of unshared buffer, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Message is no longer on the pipe */
+    ActRtn = CFE_SB_MakeWritable(&RcvdPtr, PipeId2, &Handle2);
+    ExpRtn = CFE_SB_BUFFER_INVALID;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from MakeWritable of released buffer, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ActRtn = CFE_SB_MakeWritable(NULL, PipeId2, &Handle2);
+    ExpRtn = CFE_SB_BAD_ARGUMENT;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from MakeWritable with null pointer, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* Both buffers are now ordinary zero copy buffers */
+    if (CFE_SB_ZeroCopyReleasePtr(PtrToMsg1, Handle1) != CFE_SUCCESS ||
+        CFE_SB_ZeroCopyReleasePtr(PtrToMsg2, Handle2) != CFE_SUCCESS)
+    {
+        UT_Text("Unexpected return from ZeroCopyReleasePtr of writable buffer");
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId1);
+    CFE_SB_DeletePipe(PipeId2);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_RcvMsg_API", "MakeWritable test");
+} /* end Test_RcvMsg_MakeWritable */
+
+/*
+** Test releasing zero copy buffers for all pipes owned by a given app ID
+*/
+void Test_CleanupApp_API(void)
+{
+    CFE_SB_PipeId_t         PipeId;
+    CFE_SB_ZeroCopyHandle_t ZeroCpyBufHndl = 0;
+    uint16                  PipeDepth = 50;
+    int32                   ExpRtn;
+    int32                   ActRtn;
+    int32                   TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for CleanupApp");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe");
     CFE_SB_ZeroCopyGetPtr(PipeDepth, &ZeroCpyBufHndl);
     CFE_SB_ZeroCopyGetPtr(PipeDepth, &ZeroCpyBufHndl);
 
@@ -8493,6 +9127,8 @@ void Test_SB_SpecialCases(void)
     Test_PutDestBlk_ErrLogic();
     Test_CFE_SB_GetPipeIdx();
     Test_CFE_SB_Buffers();
+    Test_CFE_SB_BufCache();
+    Test_CFE_SB_RingPipes();
     Test_CFE_SB_BadPipeInfo();
     Test_SB_SendMsgPaths();
     Test_RcvMsg_UnsubResubPath();
@@ -8897,6 +9533,435 @@ void Test_CFE_SB_Buffers(void)
               "PutDestinationBlk branch path coverage test");
 } /* end Test_CFE_SB_Buffers */
 
+/*
+** Test the per-task SB buffer cache
+*/
+void Test_CFE_SB_BufCache(void)
+{
+#if (CFE_SB_BUF_CACHE_DEPTH > 0)
+    int32 ExpRtn;
+    int32 ActRtn;
+    int32 TestStat = CFE_PASS;
+    CFE_SB_BufferD_t *bd;
+    CFE_SB_BufferD_t *bd2;
+    CFE_SB_BufferD_t CachedBuf;
+    CFE_SB_BufMagazine_t SavedMags[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
+    uint32 TskIdx;
+    uint32 OtherIdx;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test SB Buffer Cache");
+#endif
+
+    SB_ResetUnitTest();
+    bd = CFE_SB_GetBufferFromPool(0, 10);
+    CFE_SB_ReturnBufferToPool(bd);
+
+    /* A buffer of the same size must now come from the cache without
+     * a call to the memory pool
+     */
+    UT_SetRtnCode(&GetPoolRtn, CFE_ES_ERR_MEM_BLOCK_SIZE, 1);
+    bd2 = CFE_SB_GetBufferFromPool(0, 12);
+
+    if (bd2 != bd)
+    {
+        UT_Text("Released buffer was not reused from the cache");
+        TestStat = CFE_FAIL;
+    }
+
+    if (GetPoolRtn.count != 1)
+    {
+        UT_Text("Cached buffer allocation called CFE_ES_GetPoolBuf");
+        TestStat = CFE_FAIL;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_GetBufferFromPool",
+              "Buffer cache reuse test");
+
+    /* The statistics only change when the SB task collects them */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    CFE_SB.StatTlmMsg.Payload.SBBuffersInUse = 0;
+    CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse = 0;
+    bd = CFE_SB_GetBufferFromPool(0, 10);
+    ExpRtn = 0;
+    ActRtn = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected SBBuffersInUse before collection, "
+                   "exp=%lx, act=%lx",
+                (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_CollectBufStats();
+    ExpRtn = 1;
+    ActRtn = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected SBBuffersInUse after collection, "
+                   "exp=%lx, act=%lx",
+                (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ActRtn = CFE_SB.StatTlmMsg.Payload.PeakSBBuffersInUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected PeakSBBuffersInUse after collection, "
+                   "exp=%lx, act=%lx",
+                (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_ReturnBufferToPool(bd);
+    CFE_SB_CollectBufStats();
+    ExpRtn = 0;
+    ActRtn = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected SBBuffersInUse after release, exp=%lx, act=%lx",
+                (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_CollectBufStats",
+              "Buffer cache statistics test");
+
+    /* Buffers cached by a deleted task go back to the memory pool */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    bd = CFE_SB_GetBufferFromPool(0, 10);
+    bd2 = CFE_SB_GetBufferFromPool(0, 10);
+    CFE_SB_ReturnBufferToPool(bd);
+    CFE_SB_ReturnBufferToPool(bd2);
+    CFE_SB_ReleaseTaskBufCache(OS_TaskGetId());
+    UT_SetRtnCode(&GetPoolRtn, CFE_ES_ERR_MEM_BLOCK_SIZE, 1);
+    bd = CFE_SB_GetBufferFromPool(0, 10);
+
+    if (bd != NULL)
+    {
+        UT_Text("Buffer was taken from the cache of a deleted task");
+        TestStat = CFE_FAIL;
+    }
+
+    if (GetPoolRtn.count != 0)
+    {
+        UT_Text("Empty cache did not refill from CFE_ES_GetPoolBuf");
+        TestStat = CFE_FAIL;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_ReleaseTaskBufCache",
+              "Release deleted task buffer cache test");
+
+    /* A cache in use is left alone and bypassed by allocations */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    OS_ConvertToArrayIndex(OS_TaskGetId(), &TskIdx);
+    bd = CFE_SB_GetBufferFromPool(0, 10);
+    CFE_SB_ReturnBufferToPool(bd);
+    memcpy(SavedMags, CFE_SB.Mem.Cache[TskIdx].Magazine, sizeof(SavedMags));
+    CFE_SB.Mem.Cache[TskIdx].Busy = 1;
+    CFE_SB_ReleaseTaskBufCache(OS_TaskGetId());
+    bd2 = CFE_SB_GetBufferFromPool(0, 10);
+
+    if (memcmp(SavedMags, CFE_SB.Mem.Cache[TskIdx].Magazine,
+               sizeof(SavedMags)) != 0)
+    {
+        UT_Text("Buffers were taken from a busy cache");
+        TestStat = CFE_FAIL;
+    }
+
+    if (bd2 == NULL || bd2 == bd)
+    {
+        UT_Text("Allocation did not bypass a busy cache");
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB.Mem.Cache[TskIdx].Busy = 0;
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_ReleaseTaskBufCache",
+              "Busy buffer cache test");
+
+    /* Buffers cached by other tasks are reclaimed when the pool runs out */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    OS_ConvertToArrayIndex(OS_TaskGetId(), &TskIdx);
+    OtherIdx = (TskIdx + 1) % OS_MAX_TASKS;
+    CFE_SB.Mem.Cache[OtherIdx].Magazine[0].Buffers[0] = &CachedBuf;
+    CFE_SB.Mem.Cache[OtherIdx].Magazine[0].Count = 1;
+    UT_SetRtnCode(&GetPoolRtn, CFE_ES_ERR_MEM_BLOCK_SIZE, 1);
+    bd = CFE_SB_GetBufferFromPool(0, 10);
+
+    if (CFE_SB.Mem.Cache[OtherIdx].Magazine[0].Count != 0)
+    {
+        UT_Text("Other task's buffer cache was not reclaimed");
+        TestStat = CFE_FAIL;
+    }
+
+    if (bd == NULL || GetPoolRtn.count != 0)
+    {
+        UT_Text("Allocation was not retried after the reclaim");
+        TestStat = CFE_FAIL;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_GetBufferFromPool",
+              "Reclaim buffer caches test");
+#endif
+} /* end Test_CFE_SB_BufCache */
+
+/*
+** Test the pipe rings used when SB pipes are not OS queues
+*/
+void Test_CFE_SB_RingPipes(void)
+{
+#if (CFE_SB_RING_PIPES == TRUE)
+    CFE_SB_PipeId_t  PipeId;
+    CFE_SB_MsgId_t   MsgId = 0x0812;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_MsgPtr_t  TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_MsgPtr_t  PtrToMsg;
+    uint32           PipeDepth = 2;
+    uint32           WaitCount;
+    uint32           i;
+    int32            ExpRtn;
+    int32            ActRtn;
+    int32            TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test SB Ring Pipes");
+#endif
+
+    /* A send to a full ring is reported and dropped */
+    SB_ResetUnitTest();
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingFullTestPipe");
+    CFE_SB_Subscribe(MsgId, PipeId);
+
+    for (i = 0; i <= PipeDepth; i++)
+    {
+        ActRtn = CFE_SB_SendMsg(TlmPktPtr);
+        ExpRtn = CFE_SUCCESS;
+
+        if (ActRtn != ExpRtn)
+        {
+            snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                     "Unexpected return in ring full test, exp=0x%lx, act=0x%lx",
+                     (unsigned long) ExpRtn, (unsigned long) ActRtn);
+            UT_Text(cMsg);
+            TestStat = CFE_FAIL;
+        }
+    }
+
+    if (UT_EventIsInHistory(CFE_SB_Q_FULL_ERR_EID) == FALSE)
+    {
+        UT_Text("CFE_SB_Q_FULL_ERR_EID not sent");
+        TestStat = CFE_FAIL;
+    }
+
+    ExpRtn = PipeDepth;
+    ActRtn = CFE_SB.PipeRing[PipeId].Count;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected ring count in ring full test, exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_PutPipeQueue", "Ring full test");
+
+    /* Messages keep their order as the ring indexes wrap */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingWrapTestPipe");
+    CFE_SB_Subscribe(MsgId, PipeId);
+
+    for (i = 0; i < (2 * CFE_SB_MAX_PIPE_DEPTH) + 1; i++)
+    {
+        TlmPkt.Tlm32Param1 = i;
+        CFE_SB_SendMsg(TlmPktPtr);
+        TlmPkt.Tlm32Param1 = i + 1;
+        CFE_SB_SendMsg(TlmPktPtr);
+
+        ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL);
+
+        if ((ActRtn != CFE_SUCCESS) ||
+            (((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1 != i))
+        {
+            snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                     "Unexpected first receive in ring wrap test, pass %lu",
+                     (unsigned long) i);
+            UT_Text(cMsg);
+            TestStat = CFE_FAIL;
+            break;
+        }
+
+        ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL);
+
+        if ((ActRtn != CFE_SUCCESS) ||
+            (((SB_UT_Test_Tlm_t *) PtrToMsg)->Tlm32Param1 != i + 1))
+        {
+            snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                     "Unexpected second receive in ring wrap test, pass %lu",
+                     (unsigned long) i);
+            UT_Text(cMsg);
+            TestStat = CFE_FAIL;
+            break;
+        }
+    }
+
+    ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL);
+    ExpRtn = CFE_SB_NO_MESSAGE;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from empty ring, exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_GetPipeQueue", "Ring wrap test");
+
+    /* A wake with nothing on the ring only waits out the rest of the
+     * timeout
+     */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    UT_SetBSP_Time(0, 0);
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingTimeoutTestPipe");
+    UT_BinSemTimedWaitUsecs = 60000;
+    UT_SetRtnCode(&BinSemTimedWaitRtn, OS_SEM_TIMEOUT, 2);
+    WaitCount = OSBinSemTimedWaitRtn.count;
+    ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, 100);
+    ExpRtn = CFE_SB_TIME_OUT;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return in ring timeout test, exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ExpRtn = 2;
+    ActRtn = OSBinSemTimedWaitRtn.count - WaitCount;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected number of waits in ring timeout test, "
+                   "exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    ExpRtn = 40;
+    ActRtn = UT_BinSemTimedWaitMsecs;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected second wait in ring timeout test, "
+                   "exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* A wake after the whole timeout has passed does not wait again */
+    UT_BinSemTimedWaitUsecs = 100000;
+    UT_SetRtnCode(&BinSemTimedWaitRtn, OS_SEM_TIMEOUT, 2);
+    WaitCount = OSBinSemTimedWaitRtn.count;
+    ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, 100);
+    ExpRtn = CFE_SB_TIME_OUT;
+
+    if ((ActRtn != ExpRtn) || (OSBinSemTimedWaitRtn.count - WaitCount != 1))
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return in ring expired timeout test, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_GetPipeQueue", "Ring timeout test");
+
+    /* Deleting a pipe releases the messages left on its ring, and a new
+     * pipe in the same slot starts with an empty ring
+     */
+    TestStat = CFE_PASS;
+    SB_ResetUnitTest();
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(SB_UT_Test_Tlm_t), TRUE);
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingDeleteTestPipe");
+    CFE_SB_Subscribe(MsgId, PipeId);
+    CFE_SB_SendMsg(TlmPktPtr);
+    CFE_SB_SendMsg(TlmPktPtr);
+    CFE_SB_DeletePipe(PipeId);
+    CFE_SB_CollectBufStats();
+    ExpRtn = 0;
+    ActRtn = CFE_SB.StatTlmMsg.Payload.SBBuffersInUse;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected SBBuffersInUse after ring pipe delete, "
+                   "exp=%ld, act=%ld",
+                 (long) ExpRtn, (long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RingDeleteTestPipe");
+    ActRtn = CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_POLL);
+    ExpRtn = CFE_SB_NO_MESSAGE;
+
+    if (ActRtn != ExpRtn)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Unexpected return from recreated ring pipe, "
+                   "exp=0x%lx, act=0x%lx",
+                 (unsigned long) ExpRtn, (unsigned long) ActRtn);
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_DeletePipeQueue", "Ring pipe delete test");
+#endif
+} /* end Test_CFE_SB_RingPipes */
+
 /*
 ** Test internal function to get the pipe table index for the given pipe ID
 */
@@ -9158,8 +10223,8 @@ void Test_SB_SendMsgPaths(void)
         TestStat = CFE_FAIL;
     }
 
-    /* Tell the QueuePut stub to return OS_QUEUE_FULL on its next call */
-    UT_SetRtnCode(&QueuePutRtn, OS_QUEUE_FULL, 1);
+    /* Make the next write to the pipe find it full */
+    SB_UT_SetPipeFull(PipeId);
     CFE_SB.StopRecurseFlags[1] |= CFE_BIT(CFE_SB_Q_FULL_ERR_EID_BIT);
     ActRtn = CFE_SB_SendMsg(TlmPktPtr);
     CFE_SB.StopRecurseFlags[1] = 0;
@@ -9196,7 +10261,10 @@ void Test_SB_SendMsgPaths(void)
 
     CFE_SB_DeletePipe(PipeId);
 
-    /* Test inhibiting sending a "pipe write error" message */
+#if (CFE_SB_RING_PIPES == FALSE)
+    /* Test inhibiting sending a "pipe write error" message (a write to a
+     * ring pipe only fails when the ring is full)
+     */
     SB_ResetUnitTest();
     CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe");
     CFE_SB_Subscribe(MsgId, PipeId);
@@ -9238,6 +10306,7 @@ void Test_SB_SendMsgPaths(void)
     }
 
     CFE_SB_DeletePipe(PipeId);
+#endif
     UT_Report(__FILE__, __LINE__,
               TestStat, "CFE_SB_SendMsgFull",
               "Send message paths test");
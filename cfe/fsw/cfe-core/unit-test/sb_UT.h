@@ -104,6 +104,74 @@ extern char cMsg[];
 ******************************************************************************/
 void SB_ResetUnitTest(void);
 
+/*****************************************************************************/
+/**
+** \brief Force a pipe queue creation error
+**
+** \par Description
+**        This function sets the return code of the next OS call that
+**        creates a pipe queue: OS_QueueCreate, or OS_BinSemCreate if
+**        #CFE_SB_RING_PIPES is TRUE.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in] Status  The OSAL status the call is to return.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_SetRtnCode
+**
+******************************************************************************/
+void SB_UT_SetPipeCreateRtn(int32 Status);
+
+/*****************************************************************************/
+/**
+** \brief Force a pipe queue read error
+**
+** \par Description
+**        This function sets the return code of the next OS call that
+**        reads an empty pipe queue with the given timeout: OS_QueueGet, or
+**        OS_BinSemTake or OS_BinSemTimedWait if #CFE_SB_RING_PIPES is TRUE.
+**
+** \par Assumptions, External Events, and Notes:
+**        OS_BinSemTake can only be made to return -1.
+**
+** \param[in] Status   The OSAL status the read is to return.
+**
+** \param[in] TimeOut  The timeout the pipe will be read with.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_SetRtnCode, #UT_SetBinSemFail
+**
+******************************************************************************/
+void SB_UT_SetPipeGetRtn(int32 Status, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Make the next write to a pipe find it full
+**
+** \par Description
+**        This function forces the next OS_QueuePut call to return
+**        OS_QUEUE_FULL or, if #CFE_SB_RING_PIPES is TRUE, shrinks the ring
+**        of the pipe to the messages already on it.
+**
+** \par Assumptions, External Events, and Notes:
+**        A ring pipe keeps the smaller depth until it is created again.
+**
+** \param[in] PipeId  The pipe to be found full.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_SetRtnCode
+**
+******************************************************************************/
+void SB_UT_SetPipeFull(CFE_SB_PipeId_t PipeId);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB application test functions
@@ -1811,7 +1879,8 @@ void Test_Subscribe_InvalidPipeOwner(void);
 ** \sa #Test_Unsubscribe_InvalParam, #Test_Unsubscribe_NoMatch,
 ** \sa #Test_Unsubscribe_SubscriptionReporting, #Test_Unsubscribe_InvalidPipe,
 ** \sa #Test_Unsubscribe_InvalidPipeOwner, #Test_Unsubscribe_FirstDestWithMany,
-** \sa #Test_Unsubscribe_MiddleDestWithMany, #Test_Unsubscribe_GetDestPtr
+** \sa #Test_Unsubscribe_MiddleDestWithMany, #Test_Unsubscribe_GetDestPtr,
+** \sa #Test_Unsubscribe_SendAfterRemove
 **
 ******************************************************************************/
 void Test_Unsubscribe_API(void);
@@ -2032,6 +2101,29 @@ void Test_Unsubscribe_MiddleDestWithMany(void);
 ******************************************************************************/
 void Test_Unsubscribe_GetDestPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test that a message sent after a destination is removed reaches the
+**        remaining destinations
+**
+** \par Description
+**        This function tests that a message sent after the middle destination
+**        of a message is unsubscribed is delivered to the other destinations,
+**        and that no sender remains registered once the send completes.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_InitMsg, #CFE_SB_CreatePipe,
+** \sa #CFE_SB_Subscribe, #CFE_SB_Unsubscribe, #CFE_SB_SendMsg,
+** \sa #CFE_SB_GetDestPtr, #CFE_SB_DeletePipe, #UT_Report
+**
+******************************************************************************/
+void Test_Unsubscribe_SendAfterRemove(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB send message API test functions
@@ -2049,10 +2141,12 @@ void Test_Unsubscribe_GetDestPtr(void);
 ** \sa #Test_SendMsg_NoSubscribers, #Test_SendMsg_MaxMsgSizePlusOne,
 ** \sa #Test_SendMsg_BasicSend, #Test_SendMsg_SequenceCount,
 ** \sa #Test_SendMsg_QueuePutError, #Test_SendMsg_PipeFull,
+** \sa #Test_SendMsg_PipeFullCountsRestored,
 ** \sa #Test_SendMsg_MsgLimitExceeded, #Test_SendMsg_GetPoolBufErr,
 ** \sa #Test_SendMsg_ZeroCopyGetPtr, #Test_SendMsg_ZeroCopySend,
 ** \sa #Test_SendMsg_ZeroCopyPass, #Test_SendMsg_ZeroCopyReleasePtr,
-** \sa #Test_SendMsg_DisabledDestination, #Test_SendMsg_SendWithMetadata
+** \sa #Test_SendMsg_DisabledDestination, #Test_SendMsg_SendWithMetadata,
+** \sa #Test_SendMsg_Batch, #Test_SendMsg_SenderCache
 **
 ******************************************************************************/
 void Test_SendMsg_API(void);
@@ -2190,7 +2284,7 @@ void Test_SendMsg_SequenceCount(void);
 **        error.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        Only runs if #CFE_SB_RING_PIPES is FALSE.
 **
 ** \returns
 **        This function does not return a value.
@@ -2223,6 +2317,28 @@ void Test_SendMsg_QueuePutError(void);
 ******************************************************************************/
 void Test_SendMsg_PipeFull(void);
 
+/*****************************************************************************/
+/**
+** \brief Test that destination counts are restored when the pipe is full
+**
+** \par Description
+**        This function tests that the message limit count, the pipe depth
+**        statistic and the buffer use count taken for a destination are
+**        given back when the message cannot be written to the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_InitMsg, #CFE_SB_CreatePipe,
+** \sa #CFE_SB_Subscribe, #CFE_SB_SendMsg, #UT_SetRtnCode,
+** \sa #CFE_SB_GetDestPtr, #CFE_SB_DeletePipe, #UT_Report
+**
+******************************************************************************/
+void Test_SendMsg_PipeFullCountsRestored(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response to too many messages sent to the pipe
@@ -2439,6 +2555,50 @@ void Test_SendMsg_InvalidMsgId_ZeroCopy(void);
 ******************************************************************************/
 void Test_SendMsg_NoSubscribers_ZeroCopy(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending several messages in one batch
+**
+** \par Description
+**        This function tests sending a batch of messages where one of the
+**        messages is rejected, and sending a NULL batch.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_InitMsg,
+** \sa #CFE_SB_Subscribe, #CFE_SB_SendMsgBatch, #UT_EventIsInHistory,
+** \sa #CFE_SB_DeletePipe, #UT_Report
+**
+******************************************************************************/
+void Test_SendMsg_Batch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the per-task sender identity cache
+**
+** \par Description
+**        This function tests that a send caches the sender identity of the
+**        task, that the received message carries it, that ES invalidation
+**        clears it, and that an identity ES cannot look up is not cached.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_Subscribe,
+** \sa #CFE_SB_InitMsg, #CFE_SB_SendMsg, #CFE_SB_RcvMsg,
+** \sa #CFE_SB_GetLastSenderId, #CFE_SB_InvalidateSenderCache,
+** \sa #UT_SetRtnCode, #CFE_SB_DeletePipe, #UT_Report
+**
+******************************************************************************/
+void Test_SendMsg_SenderCache(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test response to sending a message with the message size larger
@@ -2478,7 +2638,8 @@ void Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy(void);
 ** \sa #Test_RcvMsg_GetLastSenderInvalidPipe,
 ** \sa #Test_RcvMsg_GetLastSenderInvalidCaller,
 ** \sa #Test_RcvMsg_GetLastSenderSuccess, #Test_RcvMsg_Timeout,
-** \sa #Test_RcvMsg_PipeReadError, #Test_RcvMsg_PendForever
+** \sa #Test_RcvMsg_PipeReadError, #Test_RcvMsg_PendForever,
+** \sa #Test_RcvMsg_Batch, #Test_RcvMsg_MakeWritable
 **
 ******************************************************************************/
 void Test_RcvMsg_API(void);
@@ -2693,6 +2854,51 @@ void Test_RcvMsg_PipeReadError(void);
 ******************************************************************************/
 void Test_RcvMsg_PendForever(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving several messages from a pipe with one call
+**
+** \par Description
+**        This function tests receiving a batch of messages, a partial
+**        batch, an empty pipe, and a null message count.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_InitMsg,
+** \sa #CFE_SB_Subscribe, #CFE_SB_SendMsg, #CFE_SB_RcvMsgBatch,
+** \sa #CFE_SB_CollectBufStats, #UT_EventIsInHistory, #CFE_SB_DeletePipe,
+** \sa #UT_Report
+**
+******************************************************************************/
+void Test_RcvMsg_Batch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test taking ownership of received messages
+**
+** \par Description
+**        This function tests that CFE_SB_MakeWritable copies a message still
+**        held by another pipe, loans an unshared buffer without copying it,
+**        and rejects buffers that are not on the pipe.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_InitMsg,
+** \sa #CFE_SB_Subscribe, #CFE_SB_SendMsg, #CFE_SB_RcvMsg,
+** \sa #CFE_SB_MakeWritable, #CFE_SB_ZeroCopyReleasePtr, #CFE_SB_DeletePipe,
+** \sa #UT_Report
+**
+******************************************************************************/
+void Test_RcvMsg_MakeWritable(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message response to an invalid buffer pointer (null)
@@ -3007,7 +3213,9 @@ void Test_CFE_SB_ChecksumUtils(void);
 **        This function does not return a value.
 **
 ** \sa #UT_Text, #Test_OS_MutSem_ErrLogic, #Test_GetPipeName_ErrLogic,
-** \sa #Test_ReqToSendEvent_ErrLogic, #Test_PutDestBlk_ErrLogic
+** \sa #Test_ReqToSendEvent_ErrLogic, #Test_PutDestBlk_ErrLogic,
+** \sa #Test_CFE_SB_Buffers, #Test_CFE_SB_BufCache,
+** \sa #Test_CFE_SB_RingPipes
 **
 ******************************************************************************/
 void Test_SB_SpecialCases(void);
@@ -3135,6 +3343,51 @@ void Test_CFE_SB_GetPipeIdx(void);
 ******************************************************************************/
 void Test_CFE_SB_Buffers(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the per-task SB buffer cache
+**
+** \par Description
+**        This function tests that released buffers are reused from the
+**        calling task's cache, that the cached buffers are added into the
+**        SB statistics when they are collected, that a busy cache is left
+**        alone, and that other tasks' caches are given back to the memory
+**        pool when it runs out.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only runs if #CFE_SB_BUF_CACHE_DEPTH is greater than 0.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_GetBufferFromPool,
+** \sa #CFE_SB_ReturnBufferToPool, #CFE_SB_CollectBufStats,
+** \sa #CFE_SB_ReleaseTaskBufCache, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_SB_BufCache(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the SB pipe rings
+**
+** \par Description
+**        This function tests sending to a full ring, message order as the
+**        ring indexes wrap, timed receives woken with nothing on the ring,
+**        and deleting a pipe with messages left on its ring.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only runs if #CFE_SB_RING_PIPES is TRUE.
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_SendMsg,
+** \sa #CFE_SB_RcvMsg, #CFE_SB_DeletePipe, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_SB_RingPipes(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test functions that involve bad pipe information
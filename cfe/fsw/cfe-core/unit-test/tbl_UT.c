@@ -37,6 +37,7 @@
 extern uint32 UT_OS_Fail;
 extern uint8  UT_CDS[UT_CDS_SIZE];
 extern uint8  UT_Endianess;
+extern int32  UT_RcvMsgTimeOut;
 
 extern UT_CDS_Map_t       UT_CDS_Map;
 extern CFE_TBL_TaskData_t CFE_TBL_TaskData;
@@ -160,6 +161,8 @@ void UT_InitializeTableRegistryNames()
                  CFE_TBL_MAX_FULL_NAME_LEN, "%d", i);
         CFE_TBL_TaskData.Registry[i].OwnerAppId = 0;
     }
+
+    CFE_TBL_IndexRegistry();
 }
 
 /*
@@ -187,6 +190,8 @@ void UT_ResetTableRegistry(void)
         CFE_TBL_TaskData.Handles[i].BufferIndex = 0;
     }
 
+    CFE_TBL_IndexRegistry();
+
     /* Initialize the table validation results records */
     for (i = 0; i < CFE_TBL_MAX_NUM_VALIDATIONS; i++)
     {
@@ -910,6 +915,27 @@ void Test_CFE_TBL_ValidateCmd(void)
               "Active buffer with data: validation function pointer and "
                 "active table flag");
 
+#if (CFE_TBL_TASK_VALIDATION == TRUE)
+    /* Test where the validation function is called by the Table Services
+     * task
+     */
+    UT_InitData();
+    CFE_TBL_TaskData.ValidationResults[0].State = CFE_TBL_VALIDATION_FREE;
+    CFE_TBL_TaskData.Registry[0].TaskValidation = TRUE;
+    CFE_TBL_TaskData.TaskValidationPending = FALSE;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ValidateCmd((CFE_SB_MsgPayloadPtr_t) &ValidateCmd.Payload) ==
+                CFE_TBL_INC_CMD_CTR &&
+              CFE_TBL_TaskData.TaskValidationPending == TRUE &&
+              UT_EventIsInHistory(CFE_TBL_VAL_REQ_MADE_INF_EID) == TRUE,
+              "CFE_TBL_ValidateCmd",
+              "Active buffer with data: validation by the Table Services "
+                "task");
+
+    CFE_TBL_TaskData.Registry[0].TaskValidation = FALSE;
+    CFE_TBL_TaskData.TaskValidationPending = FALSE;
+#endif
+
     /* Test with the buffer inactive, the table is double-buffered, and the
      * validation function pointer exists
      */
@@ -1246,6 +1272,10 @@ void Test_CFE_TBL_DumpCmd(void)
     uint8              *BuffPtr = &Buff;
     CFE_TBL_LoadBuff_t Load = {0};
     CFE_TBL_DumpCmd_t  DumpCmd;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    CFE_TBL_RegistryRec_t *RegRecPtr = &CFE_TBL_TaskData.Registry[2];
+    static uint8       DumpData[2 * CFE_TBL_DUMP_CHUNK_SIZE + 1];
+#endif
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Dump Command\n");
@@ -1270,6 +1300,7 @@ void Test_CFE_TBL_DumpCmd(void)
             CFE_TBL_MAX_FULL_NAME_LEN);
     CFE_TBL_TaskData.Registry[2].Name[CFE_TBL_MAX_FULL_NAME_LEN - 1] = '\0';
     CFE_TBL_TaskData.Registry[2].OwnerAppId = 0;
+    CFE_TBL_AddToNameIndex(2);
     strncpy(DumpCmd.Payload.TableName, CFE_TBL_TaskData.Registry[2].Name,
             sizeof(DumpCmd.Payload.TableName));
     DumpCmd.Payload.ActiveTblFlag = CFE_TBL_ACTIVE_BUFFER;
@@ -1408,6 +1439,104 @@ void Test_CFE_TBL_DumpCmd(void)
                 CFE_TBL_INC_ERR_CTR,
               "CFE_TBL_DumpCmd",
               "Illegal buffer parameter");
+
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    /* Test a dump of an active buffer that takes more than one piece to write */
+    UT_InitData();
+    DumpCmd.Payload.ActiveTblFlag = CFE_TBL_ACTIVE_BUFFER;
+    RegRecPtr->Size = CFE_TBL_DUMP_CHUNK_SIZE + 1;
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr = DumpData;
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpCmd((CFE_SB_MsgPayloadPtr_t) &DumpCmd.Payload) ==
+                CFE_TBL_DONT_INC_CTR &&
+              CFE_TBL_TaskData.FileDump.InProgress == TRUE &&
+              CFE_TBL_TaskData.FileDump.NextOffset == CFE_TBL_DUMP_CHUNK_SIZE &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers == 1 &&
+              UT_EventIsInHistory(CFE_TBL_FILE_DUMPING_INF_EID) == TRUE,
+              "CFE_TBL_DumpCmd",
+              "First piece of active buffer written");
+
+    /* Test that housekeeping reports the progress of the dump */
+    UT_InitData();
+    CFE_TBL_GetHkData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_TaskData.HkPacket.Payload.DumpBytesWritten == CFE_TBL_DUMP_CHUNK_SIZE &&
+              CFE_TBL_TaskData.HkPacket.Payload.DumpBytesTotal == CFE_TBL_DUMP_CHUNK_SIZE + 1,
+              "CFE_TBL_GetHkData",
+              "Dump progress reported");
+
+    /* Test attempt to dump a large table while another is being dumped */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_DumpCmd((CFE_SB_MsgPayloadPtr_t) &DumpCmd.Payload) ==
+                CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_DUMP_BUSY_ERR_EID) == TRUE,
+              "CFE_TBL_DumpCmd",
+              "Another table is being dumped");
+
+    /* Test writing the last piece of the dump */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileDump() == CFE_TBL_INC_CMD_CTR &&
+              CFE_TBL_TaskData.FileDump.InProgress == FALSE &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers == 0 &&
+              (UT_EventIsInHistory(CFE_TBL_WRITE_DUMP_INF_EID) == TRUE ||
+               UT_EventIsInHistory(CFE_TBL_OVERWRITE_DUMP_INF_EID) == TRUE),
+              "CFE_TBL_ContinueFileDump",
+              "Last piece of active buffer written");
+
+    /* Test continuing a dump when none is in progress */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileDump() == CFE_TBL_DONT_INC_CTR,
+              "CFE_TBL_ContinueFileDump",
+              "No dump in progress");
+
+    /* Test that the table services task pends for a while between the
+     * pieces of a dump, and writes the next piece when it times out
+     */
+    UT_InitData();
+    RegRecPtr->Size = 2 * CFE_TBL_DUMP_CHUNK_SIZE + 1;
+    CFE_TBL_DumpCmd((CFE_SB_MsgPayloadPtr_t) &DumpCmd.Payload);
+    CFE_TBL_TaskMain();
+    UT_Report(__FILE__, __LINE__,
+              UT_RcvMsgTimeOut == CFE_TBL_LOAD_YIELD_MSEC &&
+              CFE_TBL_TaskData.FileDump.InProgress == TRUE &&
+              CFE_TBL_TaskData.FileDump.NextOffset == 2 * CFE_TBL_DUMP_CHUNK_SIZE,
+              "CFE_TBL_TaskMain",
+              "Pend between pieces of a dump");
+    CFE_TBL_ContinueFileDump();
+    RegRecPtr->Size = CFE_TBL_DUMP_CHUNK_SIZE + 1;
+
+    /* Test a dump whose table buffer was released */
+    UT_InitData();
+    CFE_TBL_DumpCmd((CFE_SB_MsgPayloadPtr_t) &DumpCmd.Payload);
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr = NULL;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileDump() == CFE_TBL_INC_ERR_CTR &&
+              CFE_TBL_TaskData.FileDump.InProgress == FALSE &&
+              UT_EventIsInHistory(CFE_TBL_DUMP_STOPPED_ERR_EID) == TRUE,
+              "CFE_TBL_ContinueFileDump",
+              "Table buffer released during dump");
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers = 0;
+
+    /* Test a dump whose table was unregistered and registered again,
+     * getting the same table buffer back
+     */
+    UT_InitData();
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr = DumpData;
+    CFE_TBL_DumpCmd((CFE_SB_MsgPayloadPtr_t) &DumpCmd.Payload);
+    RegRecPtr->Generation++;
+    RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileDump() == CFE_TBL_INC_ERR_CTR &&
+              CFE_TBL_TaskData.FileDump.InProgress == FALSE &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers == 0 &&
+              UT_EventIsInHistory(CFE_TBL_DUMP_STOPPED_ERR_EID) == TRUE,
+              "CFE_TBL_ContinueFileDump",
+              "Table registered again during dump");
+#endif
 }
 
 /*
@@ -1421,6 +1550,10 @@ void Test_CFE_TBL_LoadCmd(void)
     CFE_FS_Header_t    StdFileHeader;
     CFE_TBL_LoadBuff_t BufferPtr = CFE_TBL_TaskData.LoadBuffs[0];
     CFE_TBL_LoadCmd_t  LoadCmd;
+    static uint8       LoadData[CFE_TBL_LOAD_CHUNK_SIZE + 1];
+    static uint8       FileData[CFE_TBL_LOAD_CHUNK_SIZE + 1];
+    static uint8       ActiveData[sizeof(UT_Table1_t)];
+    UT_PatchFile_t     PatchFile;
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Load Command\n");
@@ -1686,6 +1819,264 @@ void Test_CFE_TBL_LoadCmd(void)
                 CFE_TBL_INC_ERR_CTR,
               "CFE_TBL_LoadCmd",
               "Unable to read file header");
+
+    /* Test attempt to load a table while another table file is being loaded */
+    UT_InitData();
+    strncpy(CFE_TBL_TaskData.FileLoad.TableName, "loadingtable",
+            sizeof(CFE_TBL_TaskData.FileLoad.TableName));
+    CFE_TBL_TaskData.FileLoad.InProgress = TRUE;
+    CFE_TBL_TaskData.Registry[0].DumpOnly = FALSE;
+    CFE_TBL_TaskData.Registry[0].LoadPending = FALSE;
+    CFE_TBL_TaskData.Registry[0].Size = sizeof(CFE_TBL_File_Hdr_t);
+    TblFileHeader.NumBytes = sizeof(CFE_TBL_File_Hdr_t);
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.NumBytes);
+    }
+
+    strncpy((char *)TblFileHeader.TableName, CFE_TBL_TaskData.Registry[0].Name,
+            sizeof(TblFileHeader.TableName));
+    UT_SetReadBuffer(&TblFileHeader, sizeof(CFE_TBL_File_Hdr_t));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_LoadCmd((CFE_SB_MsgPayloadPtr_t) &LoadCmd.Payload) ==
+                CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_LOAD_BUSY_ERR_EID) == TRUE,
+              "CFE_TBL_LoadCmd",
+              "Another table file is being loaded");
+    CFE_TBL_TaskData.FileLoad.InProgress = FALSE;
+
+    /* Test continuing a file load when none is in progress */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileLoad() == CFE_TBL_DONT_INC_CTR,
+              "CFE_TBL_ContinueFileLoad",
+              "No file load in progress");
+
+    /* Test a file load that takes more than one piece to read */
+    UT_InitData();
+    CFE_TBL_TaskData.Registry[0].Size = CFE_TBL_LOAD_CHUNK_SIZE + 1;
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = 0;
+    CFE_TBL_TaskData.Registry[0].ValidationFuncPtr = NULL;
+    CFE_TBL_TaskData.LoadBuffs[0].BufferPtr = LoadData;
+    CFE_TBL_TaskData.LoadBuffs[0].Validated = FALSE;
+    CFE_TBL_TaskData.FileLoad.InProgress = TRUE;
+    CFE_TBL_TaskData.FileLoad.RegRecPtr = &CFE_TBL_TaskData.Registry[0];
+    CFE_TBL_TaskData.FileLoad.Generation = CFE_TBL_TaskData.Registry[0].Generation;
+    CFE_TBL_TaskData.FileLoad.WorkingBufferPtr = &CFE_TBL_TaskData.LoadBuffs[0];
+    CFE_TBL_TaskData.FileLoad.BufferPtr = LoadData;
+    CFE_TBL_TaskData.FileLoad.NextOffset = 0;
+    CFE_TBL_TaskData.FileLoad.EndOffset = CFE_TBL_LOAD_CHUNK_SIZE + 1;
+    CFE_TBL_TaskData.FileLoad.NumBytes = CFE_TBL_LOAD_CHUNK_SIZE + 1;
+    strncpy(CFE_TBL_TaskData.FileLoad.TableName, CFE_TBL_TaskData.Registry[0].Name,
+            sizeof(CFE_TBL_TaskData.FileLoad.TableName));
+    memset(FileData, 0x5A, sizeof(FileData));
+    UT_SetReadBuffer(FileData, sizeof(FileData));
+    UT_SetRtnCode(&OSReadRtn, 0, 3);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileLoad() == CFE_TBL_DONT_INC_CTR &&
+              CFE_TBL_TaskData.FileLoad.InProgress == TRUE &&
+              CFE_TBL_TaskData.FileLoad.NextOffset == CFE_TBL_LOAD_CHUNK_SIZE,
+              "CFE_TBL_ContinueFileLoad",
+              "First piece of file read");
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileLoad() == CFE_TBL_INC_CMD_CTR &&
+              CFE_TBL_TaskData.FileLoad.InProgress == FALSE &&
+              CFE_TBL_TaskData.LoadBuffs[0].Validated == TRUE &&
+              UT_EventIsInHistory(CFE_TBL_FILE_LOADED_INF_EID) == TRUE,
+              "CFE_TBL_ContinueFileLoad",
+              "Last piece of file read");
+
+    /* Test a file load whose working buffer was released */
+    UT_InitData();
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.FileLoad.InProgress = TRUE;
+    CFE_TBL_TaskData.FileLoad.NextOffset = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileLoad() == CFE_TBL_INC_ERR_CTR &&
+              CFE_TBL_TaskData.FileLoad.InProgress == FALSE &&
+              UT_EventIsInHistory(CFE_TBL_LOAD_STOPPED_ERR_EID) == TRUE,
+              "CFE_TBL_ContinueFileLoad",
+              "Working buffer released during load");
+
+    /* Test a file load whose table was unregistered and registered again,
+     * getting the same working buffer back
+     */
+    UT_InitData();
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = 0;
+    CFE_TBL_TaskData.Registry[0].Generation++;
+    CFE_TBL_TaskData.FileLoad.InProgress = TRUE;
+    CFE_TBL_TaskData.FileLoad.NextOffset = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_ContinueFileLoad() == CFE_TBL_INC_ERR_CTR &&
+              CFE_TBL_TaskData.FileLoad.InProgress == FALSE &&
+              CFE_TBL_TaskData.FileLoad.NextOffset == 0 &&
+              UT_EventIsInHistory(CFE_TBL_LOAD_STOPPED_ERR_EID) == TRUE,
+              "CFE_TBL_ContinueFileLoad",
+              "Table registered again during load");
+
+    /* Test that the table services task pends for a while between the
+     * pieces of a file load, and reads the next piece when it times out
+     */
+    UT_InitData();
+    CFE_TBL_TaskData.FileLoad.Generation = CFE_TBL_TaskData.Registry[0].Generation;
+    CFE_TBL_TaskData.FileLoad.InProgress = TRUE;
+    CFE_TBL_TaskData.FileLoad.NextOffset = 0;
+    UT_SetReadBuffer(FileData, sizeof(FileData));
+    CFE_TBL_TaskMain();
+    UT_Report(__FILE__, __LINE__,
+              UT_RcvMsgTimeOut == CFE_TBL_LOAD_YIELD_MSEC &&
+              CFE_TBL_TaskData.FileLoad.InProgress == TRUE &&
+              CFE_TBL_TaskData.FileLoad.NextOffset == CFE_TBL_LOAD_CHUNK_SIZE,
+              "CFE_TBL_TaskMain",
+              "Pend between pieces of a file load");
+    CFE_TBL_TaskData.FileLoad.InProgress = FALSE;
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+
+    /* Test a successful load of a table patch file */
+    UT_InitData();
+    CFE_TBL_TaskData.FileLoad.InProgress = FALSE;
+    CFE_TBL_TaskData.Registry[0].Size = sizeof(UT_Table1_t);
+    CFE_TBL_TaskData.Registry[0].TableLoadedOnce = TRUE;
+    CFE_TBL_TaskData.Registry[0].DblBuffered = FALSE;
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.Registry[0].ActiveBufferIndex = 0;
+    CFE_TBL_TaskData.Registry[0].Buffers[0].BufferPtr = ActiveData;
+
+    for (j = 0; j < CFE_TBL_MAX_SIMULTANEOUS_LOADS; j++)
+    {
+        CFE_TBL_TaskData.LoadBuffs[j].Taken = FALSE;
+    }
+
+    CFE_TBL_TaskData.LoadBuffs[0].BufferPtr = LoadData;
+    CFE_TBL_TaskData.LoadBuffs[0].Crc = 0;
+    memset(ActiveData, 0x11, sizeof(ActiveData));
+    CFE_TBL_TaskData.Registry[0].Buffers[0].Crc = 0x1111;
+    StdFileHeader.SubType = CFE_FS_TBL_PATCH_SUBTYPE;
+    strncpy(PatchFile.TblHeader.TableName, CFE_TBL_TaskData.Registry[0].Name,
+            sizeof(PatchFile.TblHeader.TableName));
+    PatchFile.TblHeader.Offset = 0;
+    PatchFile.TblHeader.NumBytes = sizeof(UT_Table1_t);
+    PatchFile.PatchHeader.Offset = 2;
+    PatchFile.PatchHeader.NumBytes = sizeof(PatchFile.PatchData);
+    memset(PatchFile.PatchData, 0x22, sizeof(PatchFile.PatchData));
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&PatchFile.TblHeader.NumBytes);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.Offset);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.NumBytes);
+    }
+
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_SetRtnCode(&OSReadRtn, 0, 4);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_LoadCmd((CFE_SB_MsgPayloadPtr_t) &LoadCmd.Payload) ==
+                CFE_TBL_INC_CMD_CTR &&
+              LoadData[1] == 0x11 && LoadData[2] == 0x22 &&
+              LoadData[5] == 0x22 && LoadData[6] == 0x11 &&
+              CFE_TBL_TaskData.LoadBuffs[0].Crc == 0x1111 &&
+              CFE_TBL_TaskData.FileLoad.InProgress == FALSE &&
+              UT_EventIsInHistory(CFE_TBL_FILE_LOADED_INF_EID) == TRUE,
+              "CFE_TBL_LoadCmd",
+              "Successful load of a table patch file");
+
+    /* Test a table patch file applied on top of a load that has not been
+     * activated, which updates the CRC of the staged image rather than the
+     * CRC of the active one
+     */
+    UT_InitData();
+    CFE_TBL_TaskData.LoadBuffs[0].Crc = 0x2222;
+    PatchFile.TblHeader.NumBytes = sizeof(UT_Table1_t);
+    PatchFile.PatchHeader.Offset = 6;
+    PatchFile.PatchHeader.NumBytes = 1;
+    PatchFile.PatchData[0] = 0x33;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&PatchFile.TblHeader.NumBytes);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.Offset);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.NumBytes);
+    }
+
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_SetRtnCode(&OSReadRtn, 0, 4);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_LoadCmd((CFE_SB_MsgPayloadPtr_t) &LoadCmd.Payload) ==
+                CFE_TBL_INC_CMD_CTR &&
+              CFE_TBL_TaskData.Registry[0].LoadInProgress == 0 &&
+              LoadData[2] == 0x22 && LoadData[5] == 0x22 &&
+              LoadData[6] == 0x33 && LoadData[7] == 0x11 &&
+              CFE_TBL_TaskData.LoadBuffs[0].Crc == 0x2222 &&
+              UT_EventIsInHistory(CFE_TBL_FILE_LOADED_INF_EID) == TRUE,
+              "CFE_TBL_LoadCmd",
+              "Table patch file applied to a staged load");
+    memset(PatchFile.PatchData, 0x22, sizeof(PatchFile.PatchData));
+
+    /* Test a table patch file with a patch outside the span in its table header */
+    UT_InitData();
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.LoadBuffs[0].Taken = FALSE;
+    PatchFile.TblHeader.Offset = 0;
+    PatchFile.TblHeader.NumBytes = 4;
+    PatchFile.PatchHeader.Offset = 2;
+    PatchFile.PatchHeader.NumBytes = sizeof(PatchFile.PatchData);
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&PatchFile.TblHeader.NumBytes);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.Offset);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.NumBytes);
+    }
+
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_LoadCmd((CFE_SB_MsgPayloadPtr_t) &LoadCmd.Payload) ==
+                CFE_TBL_INC_ERR_CTR &&
+              CFE_TBL_TaskData.LoadBuffs[0].Validated == FALSE &&
+              UT_EventIsInHistory(CFE_TBL_PATCH_ERR_EID) == TRUE,
+              "CFE_TBL_LoadCmd",
+              "Table patch file has a patch outside its span");
+
+    /* Test a table patch file that ends in the middle of a patch header */
+    UT_InitData();
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.LoadBuffs[0].Taken = FALSE;
+    PatchFile.TblHeader.NumBytes = sizeof(UT_Table1_t);
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&PatchFile.TblHeader.NumBytes);
+    }
+
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_SetRtnCode(&OSReadRtn, 1, 2);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_LoadCmd((CFE_SB_MsgPayloadPtr_t) &LoadCmd.Payload) ==
+                CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_PATCH_ERR_EID) == TRUE,
+              "CFE_TBL_LoadCmd",
+              "Table patch file is incomplete");
+
+    /* Test a table patch file for a table that has never been loaded */
+    UT_InitData();
+    CFE_TBL_TaskData.Registry[0].LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.Registry[0].TableLoadedOnce = FALSE;
+    CFE_TBL_TaskData.LoadBuffs[0].Taken = FALSE;
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_Report(__FILE__, __LINE__,
+              CFE_TBL_LoadCmd((CFE_SB_MsgPayloadPtr_t) &LoadCmd.Payload) ==
+                CFE_TBL_INC_ERR_CTR &&
+              UT_EventIsInHistory(CFE_TBL_PARTIAL_LOAD_ERR_EID) == TRUE,
+              "CFE_TBL_LoadCmd",
+              "Table patch file for uninitialized table");
+    StdFileHeader.SubType = CFE_FS_TBL_IMG_SUBTYPE;
 }
 
 /*
@@ -2770,6 +3161,9 @@ void Test_CFE_TBL_Load(void)
     CFE_FS_Header_t            StdFileHeader;
     CFE_TBL_File_Hdr_t         TblFileHeader;
     UT_Table1_t                *App2TblPtr;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    UT_Table1_t                *App1TblPtr;
+#endif
     CFE_TBL_RegistryRec_t      *RegRecPtr;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr;
 
@@ -3083,21 +3477,101 @@ void Test_CFE_TBL_Load(void)
     UT_InitData();
     UT_SetAppID(1);
     RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    /* The loaded buffer becomes active while the table's own buffer is held */
+    RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[App1TblHandle1].RegIndex];
+    EventsCorrect =
+        (UT_EventIsInHistory(CFE_TBL_LOAD_SUCCESS_INF_EID) == TRUE &&
+         UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              RegRecPtr->ActiveBufferIndex == 1 &&
+              RegRecPtr->PublishedLoadBuff != CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_Load",
+              "Load shared table while its buffer is in use");
+#else
     EventsCorrect = (UT_GetNumEventsSent() == 0);
     UT_Report(__FILE__, __LINE__,
               RtnCode == CFE_TBL_INFO_TABLE_LOCKED && EventsCorrect,
               "CFE_TBL_Load",
               "Attempt to load locked shared table");
+#endif
 
     /* d. Test cleanup */
     UT_InitData();
     UT_SetAppID(2);
     RtnCode = CFE_TBL_ReleaseAddress(App2TblHandle1);
     EventsCorrect = (UT_GetNumEventsSent() == 0);
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    /* The last reader's release moves the new contents into the table's
+     * buffer and gives the shared buffer back
+     */
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED && EventsCorrect &&
+              RegRecPtr->ActiveBufferIndex == 0 &&
+              RegRecPtr->PublishedLoadBuff == CFE_TBL_NO_LOAD_IN_PROGRESS &&
+              memcmp(RegRecPtr->Buffers[0].BufferPtr, &TestTable1,
+                     sizeof(TestTable1)) == 0,
+              "CFE_TBL_ReleaseAddress",
+              "Finish load of shared table once its buffer is released");
+
+    /* The owner's next manage call has nothing left to finish */
+    UT_InitData();
+    UT_SetAppID(1);
+    RtnCode = CFE_TBL_Manage(App1TblHandle1);
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              RegRecPtr->ActiveBufferIndex == 0 &&
+              RegRecPtr->PublishedLoadBuff == CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_Manage",
+              "Manage shared table after its load was finished");
+
+    /* Test attempt to load a shared table while both its buffer and the
+     * previous load are in use
+     */
+    /* a. Test setup */
+    UT_InitData();
+    UT_SetAppID(2);
+    CFE_TBL_GetAddress((void **) &App2TblPtr, App2TblHandle1);
+    UT_SetAppID(1);
+    CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    CFE_TBL_GetAddress((void **) &App1TblPtr, App1TblHandle1);
+
+    /* b. Perform test */
+    UT_InitData();
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_TABLE_LOCKED && EventsCorrect &&
+              RegRecPtr->Buffers[0].Readers == 1 &&
+              RegRecPtr->Buffers[1].Readers == 1,
+              "CFE_TBL_Load",
+              "Attempt to load shared table while both buffers are in use");
+
+    /* c. Test cleanup */
+    UT_InitData();
+    UT_SetAppID(2);
+    CFE_TBL_ReleaseAddress(App2TblHandle1);
+    UT_SetAppID(1);
+    CFE_TBL_ReleaseAddress(App1TblHandle1);
+    RtnCode = CFE_TBL_Manage(App1TblHandle1);
+    EventsCorrect =
+        (UT_EventIsInHistory(CFE_TBL_UPDATE_SUCCESS_INF_EID) == TRUE &&
+         UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED && EventsCorrect &&
+              RegRecPtr->ActiveBufferIndex == 0 &&
+              RegRecPtr->PublishedLoadBuff == CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_Manage",
+              "Attempt to load shared table while both buffers are in use "
+                "(cleanup)");
+#else
     UT_Report(__FILE__, __LINE__,
               RtnCode == CFE_SUCCESS && EventsCorrect,
               "CFE_TBL_ReleaseAddress",
               "Attempt to load locked shared table (cleanup)");
+#endif
 }
 
 /*
@@ -3348,6 +3822,13 @@ void Test_CFE_TBL_Manage(void)
     UT_Table1_t                *App2TblPtr;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr;
     CFE_TBL_Handle_t           AccessIterator;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    int32                      LoadInProgress;
+#endif
+    int32                      SavedLoadInProgress;
+#if (CFE_TBL_TASK_VALIDATION == TRUE)
+    boolean                    SavedDblBuffered;
+#endif
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Manage\n");
@@ -3534,6 +4015,148 @@ void Test_CFE_TBL_Manage(void)
               "Manage table that has a successful validation pending on "
                 "an active buffer");
 
+#if (CFE_TBL_TASK_VALIDATION == TRUE)
+    /* Test that a validation left to the Table Services task is not
+     * performed by the application
+     */
+    UT_InitData();
+
+    /* Configure table for validation by the Table Services task */
+    RegRecPtr->TaskValidation = TRUE;
+    CFE_TBL_TaskData.TaskValidationPending = TRUE;
+    CFE_TBL_TaskData.ValidationResults[0].State = CFE_TBL_VALIDATION_PENDING;
+    CFE_TBL_TaskData.ValidationResults[0].Result = 1;
+    strncpy(CFE_TBL_TaskData.ValidationResults[0].TableName,
+            "ut_cfe_tbl.UT_Table1", CFE_TBL_MAX_FULL_NAME_LEN);
+    CFE_TBL_TaskData.ValidationResults[0].CrcOfTable = 0;
+    CFE_TBL_TaskData.ValidationResults[0].ActiveBuffer = TRUE;
+    RegRecPtr->ValidateActiveIndex = 0;
+
+    RtnCode = CFE_TBL_Manage(App1TblHandle1);
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              CFE_TBL_TaskData.ValidationResults[0].State ==
+                CFE_TBL_VALIDATION_PENDING,
+              "CFE_TBL_Manage",
+              "Manage table that is validated by the Table Services task");
+
+    /* Test the Table Services task performing the pending validation */
+    UT_InitData();
+    UT_SetRtnCode(&TBL_ValidationFuncRtn, CFE_SUCCESS, 1);
+    CFE_TBL_ContinueValidation();
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_VALIDATION_INF_EID) == TRUE &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              EventsCorrect &&
+              CFE_TBL_TaskData.ValidationResults[0].State ==
+                CFE_TBL_VALIDATION_PERFORMED &&
+              CFE_TBL_TaskData.ValidationResults[0].Result == 0 &&
+              RegRecPtr->ValidateActiveIndex == CFE_TBL_NO_VALIDATION_PENDING &&
+              RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].Readers == 0 &&
+              CFE_TBL_TaskData.TaskValidationPending == TRUE,
+              "CFE_TBL_ContinueValidation",
+              "Validate table in the Table Services task");
+
+    /* Test the Table Services task once no validation is left */
+    UT_InitData();
+    CFE_TBL_ContinueValidation();
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              EventsCorrect && CFE_TBL_TaskData.TaskValidationPending == FALSE,
+              "CFE_TBL_ContinueValidation",
+              "No validation left for the Table Services task");
+
+    /* Test that the Table Services task pends for a while between
+     * validations, and performs the next one when it times out
+     */
+    UT_InitData();
+    CFE_TBL_TaskData.TaskValidationPending = TRUE;
+    CFE_TBL_TaskData.ValidationResults[0].State = CFE_TBL_VALIDATION_PENDING;
+    CFE_TBL_TaskData.ValidationResults[0].Result = 1;
+    RegRecPtr->ValidateActiveIndex = 0;
+    UT_SetRtnCode(&TBL_ValidationFuncRtn, CFE_SUCCESS, 1);
+    CFE_TBL_TaskMain();
+    UT_Report(__FILE__, __LINE__,
+              UT_RcvMsgTimeOut == CFE_TBL_LOAD_YIELD_MSEC &&
+              CFE_TBL_TaskData.ValidationResults[0].State ==
+                CFE_TBL_VALIDATION_PERFORMED &&
+              CFE_TBL_TaskData.TaskValidationPending == TRUE,
+              "CFE_TBL_TaskMain",
+              "Pend between validations in the Table Services task");
+    CFE_TBL_TaskData.TaskValidationPending = FALSE;
+
+    /* Test that the application cannot load the table while the Table
+     * Services task is calling its validation function
+     */
+    UT_InitData();
+    SavedLoadInProgress = RegRecPtr->LoadInProgress;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    RegRecPtr->TaskValidating = TRUE;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_LOAD_ERR_EID) == TRUE &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_LOAD_IN_PROGRESS && EventsCorrect &&
+              RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_Load",
+              "Load table while the Table Services task is validating it");
+    RegRecPtr->TaskValidating = FALSE;
+    RegRecPtr->LoadInProgress = SavedLoadInProgress;
+
+    /* Test the Table Services task validating an inactive buffer that was
+     * activated by the application before the validation was performed
+     */
+    UT_InitData();
+    SavedLoadInProgress = RegRecPtr->LoadInProgress;
+    SavedDblBuffered = RegRecPtr->DblBuffered;
+    RegRecPtr->DblBuffered = FALSE;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.TaskValidationPending = TRUE;
+    CFE_TBL_TaskData.ValidationResults[0].State = CFE_TBL_VALIDATION_PENDING;
+    CFE_TBL_TaskData.ValidationResults[0].Result = 1;
+    CFE_TBL_TaskData.ValidationResults[0].ActiveBuffer = FALSE;
+    RegRecPtr->ValidateInactiveIndex = 0;
+    CFE_TBL_ContinueValidation();
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_VALIDATION_ERR_EID) == TRUE &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              EventsCorrect &&
+              CFE_TBL_TaskData.ValidationResults[0].State ==
+                CFE_TBL_VALIDATION_PERFORMED &&
+              CFE_TBL_TaskData.ValidationResults[0].Result ==
+                CFE_TBL_ERR_NO_BUFFER_AVAIL &&
+              RegRecPtr->ValidateInactiveIndex == CFE_TBL_NO_VALIDATION_PENDING &&
+              RegRecPtr->TaskValidating == FALSE,
+              "CFE_TBL_ContinueValidation",
+              "Validate inactive buffer that is no longer loaded");
+    CFE_TBL_TaskData.TaskValidationPending = FALSE;
+    RegRecPtr->DblBuffered = SavedDblBuffered;
+    RegRecPtr->LoadInProgress = SavedLoadInProgress;
+
+    RegRecPtr->TaskValidation = FALSE;
+#endif
+
+    /* Test that the application cannot load the table while the Table
+     * Services task is reading a table file into it
+     */
+    UT_InitData();
+    SavedLoadInProgress = RegRecPtr->LoadInProgress;
+    RegRecPtr->LoadInProgress = CFE_TBL_NO_LOAD_IN_PROGRESS;
+    CFE_TBL_TaskData.FileLoad.InProgress = TRUE;
+    CFE_TBL_TaskData.FileLoad.RegRecPtr = RegRecPtr;
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    EventsCorrect = (UT_EventIsInHistory(CFE_TBL_LOAD_ERR_EID) == TRUE &&
+                     UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_LOAD_IN_PROGRESS && EventsCorrect &&
+              RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS,
+              "CFE_TBL_Load",
+              "Load table while the Table Services task is loading a file "
+                "into it");
+    CFE_TBL_TaskData.FileLoad.InProgress = FALSE;
+    RegRecPtr->LoadInProgress = SavedLoadInProgress;
+
     /* Test response to processing an update request on a locked table */
     /* a. Test setup - part 1 */
     UT_InitData();
@@ -3560,12 +4183,26 @@ void Test_CFE_TBL_Manage(void)
 
     /* Configure table for update */
     RegRecPtr->LoadPending = TRUE;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    LoadInProgress = RegRecPtr->LoadInProgress;
+    RtnCode = CFE_TBL_Manage(App1TblHandle1);
+    EventsCorrect =
+        (UT_EventIsInHistory(CFE_TBL_UPDATE_SUCCESS_INF_EID) == TRUE &&
+         UT_GetNumEventsSent() == 1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED && EventsCorrect &&
+              RegRecPtr->ActiveBufferIndex == 1 &&
+              RegRecPtr->PublishedLoadBuff == LoadInProgress,
+              "CFE_TBL_Manage",
+              "Process an update request on a table in use");
+#else
     RtnCode = CFE_TBL_Manage(App1TblHandle1);
     EventsCorrect = (UT_GetNumEventsSent() == 0);
     UT_Report(__FILE__, __LINE__,
               RtnCode == CFE_TBL_INFO_TABLE_LOCKED && EventsCorrect,
               "CFE_TBL_Manage",
               "Process an update request on a locked table");
+#endif
 
     /* Save the previous table's information for a subsequent test */
     AccessDescPtr = &CFE_TBL_TaskData.Handles[App1TblHandle1];
@@ -3577,10 +4214,21 @@ void Test_CFE_TBL_Manage(void)
     UT_SetAppID(2);
     RtnCode = CFE_TBL_ReleaseAddress(App2TblHandle1);
     EventsCorrect = (UT_GetNumEventsSent() == 0);
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED && EventsCorrect &&
+              RegRecPtr->Buffers[1].Readers == 0,
+              "CFE_TBL_ReleaseAddress",
+              "Release address to unlock shared table");
+
+    /* Set up the same load again for the single buffered update below */
+    RegRecPtr->LoadInProgress = LoadInProgress;
+#else
     UT_Report(__FILE__, __LINE__,
               RtnCode == CFE_TBL_ERR_NEVER_LOADED && EventsCorrect,
               "CFE_TBL_ReleaseAddress",
               "Release address to unlock shared table");
+#endif
 
     /* Test response to processing an update request on a single
      * buffered table
@@ -3614,6 +4262,9 @@ void Test_CFE_TBL_Manage(void)
     RegRecPtr->HeadOfAccessList = AccessIterator;
     CFE_TBL_TaskData.Handles[AccessIterator].BufferIndex = 1;
     CFE_TBL_TaskData.Handles[AccessIterator].LockFlag = TRUE;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    RegRecPtr->Buffers[1].Readers = 1;
+#endif
 
     /* Attempt to "load" image into inactive buffer for table */
     RegIndex = CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2");
@@ -3627,6 +4278,9 @@ void Test_CFE_TBL_Manage(void)
     /* Reset the table information for subsequent tests */
     CFE_TBL_TaskData.Handles[AccessIterator].BufferIndex = 1;
     CFE_TBL_TaskData.Handles[AccessIterator].LockFlag = FALSE;
+#if (CFE_TBL_LOCKLESS_ACCESS == TRUE)
+    RegRecPtr->Buffers[1].Readers = 0;
+#endif
 
     /* Successfully "load" image into inactive buffer for table */
     RtnCode = CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, FALSE);
@@ -4098,6 +4752,9 @@ void Test_CFE_TBL_Internal(void)
     int32                      OldOSFail;
     int32                      FileDescriptor = 0;
     void                       *TblPtr;
+    CFE_TBL_Handle_t           TblHandle;
+    char                       TblName[CFE_TBL_MAX_FULL_NAME_LEN];
+    UT_PatchFile_t             PatchFile;
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Internal\n");
@@ -4256,6 +4913,52 @@ void Test_CFE_TBL_Internal(void)
               "CFE_TBL_LoadFromFile",
               "File content incomplete");
 
+    /* Test CFE_TBL_LoadFromFile applying a table patch file */
+    UT_InitData();
+    StdFileHeader.SubType = CFE_FS_TBL_PATCH_SUBTYPE;
+    strncpy(PatchFile.TblHeader.TableName, "ut_cfe_tbl.UT_Table2",
+            sizeof(PatchFile.TblHeader.TableName));
+    PatchFile.TblHeader.Offset = 0;
+    PatchFile.TblHeader.NumBytes = sizeof(UT_Table1_t);
+    PatchFile.PatchHeader.Offset = 1;
+    PatchFile.PatchHeader.NumBytes = sizeof(PatchFile.PatchData);
+    memset(PatchFile.PatchData, 0x33, sizeof(PatchFile.PatchData));
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&PatchFile.TblHeader.NumBytes);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.Offset);
+        CFE_TBL_ByteSwapUint32(&PatchFile.PatchHeader.NumBytes);
+    }
+
+    memset(WorkingBufferPtr->BufferPtr, 0, sizeof(UT_Table1_t));
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    UT_SetRtnCode(&OSReadRtn, 0, 4);
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, Filename);
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_WARN_PARTIAL_LOAD && EventsCorrect &&
+              WorkingBufferPtr->BufferPtr[0] == 0 &&
+              WorkingBufferPtr->BufferPtr[1] == 0x33 &&
+              WorkingBufferPtr->BufferPtr[4] == 0x33 &&
+              WorkingBufferPtr->BufferPtr[5] == 0,
+              "CFE_TBL_LoadFromFile",
+              "Table patch file applied");
+
+    /* Test CFE_TBL_LoadFromFile response to a patch that holds no data */
+    UT_InitData();
+    PatchFile.PatchHeader.NumBytes = 0;
+    UT_SetReadBuffer(&PatchFile, sizeof(PatchFile));
+    UT_SetReadHeader(&StdFileHeader, sizeof(CFE_FS_Header_t));
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, Filename);
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_BAD_PATCH && EventsCorrect,
+              "CFE_TBL_LoadFromFile",
+              "Table patch file has an empty patch");
+    StdFileHeader.SubType = CFE_FS_TBL_IMG_SUBTYPE;
+
     /* Test CFE_TBL_LoadFromFile response to the file being for the
      * wrong table
      */
@@ -5158,6 +5861,67 @@ void Test_CFE_TBL_Internal(void)
               "CFE_TBL_ReadHeaders",
               "*Not tested* Invalid processor ID ");
 #endif
+
+    /* Test registering a table under every registry entry, then sharing
+     * each one by name from another application
+     */
+    UT_InitData();
+    UT_ResetTableRegistry();
+    UT_SetAppID(1);
+    RtnCode = CFE_SUCCESS;
+
+    for (i = 0; i < CFE_TBL_MAX_NUM_TABLES && RtnCode == CFE_SUCCESS; i++)
+    {
+        snprintf(TblName, CFE_TBL_MAX_NAME_LENGTH, "UT_Table%d", (int) i + 1);
+        RtnCode = CFE_TBL_Register(&TblHandle, TblName,
+                                   sizeof(UT_Table1_t),
+                                   CFE_TBL_OPT_DEFAULT, NULL);
+    }
+
+    UT_SetAppID(2);
+
+    for (i = 0; i < CFE_TBL_MAX_NUM_HANDLES - CFE_TBL_MAX_NUM_TABLES &&
+                i < CFE_TBL_MAX_NUM_TABLES && RtnCode == CFE_SUCCESS; i++)
+    {
+        snprintf(TblName, CFE_TBL_MAX_FULL_NAME_LEN, "ut_cfe_tbl.UT_Table%d",
+                 (int) i + 1);
+        RtnCode = CFE_TBL_Share(&TblHandle, TblName);
+
+        if (RtnCode == CFE_SUCCESS &&
+            CFE_TBL_TaskData.Handles[TblHandle].RegIndex != i)
+        {
+            RtnCode = CFE_TBL_ERR_INVALID_NAME;
+        }
+    }
+
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect,
+              "CFE_TBL_Share",
+              "Share every table in a full registry");
+
+    /* Test that a table is no longer found by name once it is unregistered
+     * and that its registry entry is reused after its last access is removed
+     */
+    UT_InitData();
+    UT_SetAppID(1);
+    CFE_TBL_Unregister(0);
+    UT_SetAppID(2);
+    RtnCode = CFE_TBL_Share(&TblHandle, "ut_cfe_tbl.UT_Table1");
+    CFE_TBL_Unregister(CFE_TBL_MAX_NUM_TABLES);
+    UT_SetAppID(1);
+    UT_ClearEventHistory();
+    EventsCorrect = (CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table1") ==
+                       CFE_TBL_NOT_FOUND &&
+                     CFE_TBL_FindFreeRegistryEntry() == 0);
+    RtnCode = CFE_TBL_Register(&TblHandle, "UT_Table1",
+                               sizeof(UT_Table1_t),
+                               CFE_TBL_OPT_DEFAULT, NULL);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect && TblHandle == 0 &&
+              CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table1") == 0,
+              "CFE_TBL_Register",
+              "Reuse registry entry of an unregistered table");
 }
 
 /*
@@ -60,6 +60,13 @@ typedef struct
     UT_Table1_t        TblData;
 } UT_TempFile_t;
 
+typedef struct
+{
+    CFE_TBL_File_Hdr_t TblHeader;
+    CFE_TBL_PatchHdr_t PatchHeader;
+    uint8              PatchData[4];
+} UT_PatchFile_t;
+
 
 /* TBL unit test functions */
 
@@ -121,6 +121,7 @@ extern boolean UT_CDS_GoodEnd;
 extern boolean UT_BSPCheckValidity;
 extern boolean UT_CDSReadBlock;
 extern boolean UT_CDS_Rebuild;
+extern boolean UT_PSPMemValRangeFail;
 
 extern OS_time_t BSP_Time;
 
@@ -527,8 +528,10 @@ void CFE_PSP_Restart(uint32 reset_type)
 ** \brief CFE_PSP_Get_Timebase stub function
 **
 ** \par Description
-**        This function is used as a placeholder for the PSP function
-**        CFE_PSP_Get_Timebase.
+**        This function is used to mimic the response of the PSP function
+**        CFE_PSP_Get_Timebase.  The timebase is the user-defined time,
+**        BSP_Time, with the seconds as the upper 32 bits and the
+**        microseconds as the lower 32 bits.
 **
 ** \par Assumptions, External Events, and Notes:
 **        None
@@ -542,6 +545,8 @@ void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32* Tbl)
 #ifdef UT_VERBOSE
     UT_Text("  CFE_PSP_Get_Timebase called");
 #endif
+    *Tbu = BSP_Time.seconds;
+    *Tbl = BSP_Time.microsecs;
 }
 
 /*****************************************************************************/
@@ -728,7 +733,9 @@ int32 CFE_PSP_MemRead8(cpuaddr Address, uint8 *Data)
 **        function being called.  If the value PSPMemValRangeRtn.count is
 **        greater than zero then the counter is decremented; if it then equals
 **        zero the return value is set to the user-defined value
-**        PSPMemValRangeRtn.value.  OS_SUCCESS is returned otherwise.
+**        PSPMemValRangeRtn.value.  Otherwise, CFE_PSP_INVALID_MEM_RANGE is
+**        returned if the user-defined variable UT_PSPMemValRangeFail is TRUE,
+**        and OS_SUCCESS is returned if not.
 **
 ** \par Assumptions, External Events, and Notes:
 **        None
@@ -739,7 +746,8 @@ int32 CFE_PSP_MemRead8(cpuaddr Address, uint8 *Data)
 ******************************************************************************/
 int32 CFE_PSP_MemValidateRange(cpuaddr Address, uint32 Size, uint32 MemoryType)
 {
-    int32 status = OS_SUCCESS;
+    int32   status = OS_SUCCESS;
+    boolean flag = FALSE;
 
     if (PSPMemValRangeRtn.count > 0)
     {
@@ -748,9 +756,15 @@ int32 CFE_PSP_MemValidateRange(cpuaddr Address, uint32 Size, uint32 MemoryType)
         if (PSPMemValRangeRtn.count == 0)
         {
             status = PSPMemValRangeRtn.value;
+            flag = TRUE;
         }
     }
 
+    if (flag == FALSE && UT_PSPMemValRangeFail == TRUE)
+    {
+        status = CFE_PSP_INVALID_MEM_RANGE;
+    }
+
     return status;
 }
 
@@ -440,7 +440,7 @@ int32 CFE_ES_WriteToSysLog(const char *pSpecString, ...)
     {
         WriteSysLogRtn.value = EVS_SYSLOG_OFFSET + 5;
     }
-    else if (UT_strcmp(tmpString, "Event Log restored, n=2, c=2, f=0, m=1, "
+    else if (UT_strcmp(tmpString, "Event Log restored, n=~, c=2, f=0, m=1, "
                     "o=0\n") == 0)
     {
         WriteSysLogRtn.value = EVS_SYSLOG_OFFSET + 6;
@@ -849,6 +849,31 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr,
     return 332424;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_UpdateCRC stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE ES function
+**        CFE_ES_UpdateCRC.  The block CRC only changes when the range CRCs
+**        differ.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns BlockCRC combined with the two range CRCs.
+**
+******************************************************************************/
+uint32 CFE_ES_UpdateCRC(uint32 BlockCRC,
+                        uint32 OldRangeCRC,
+                        uint32 NewRangeCRC,
+                        uint32 TailLength,
+                        uint32 TypeCRC)
+{
+    return BlockCRC ^ OldRangeCRC ^ NewRangeCRC;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_GetTaskInfo stub function
@@ -984,6 +1009,29 @@ int32 CFE_ES_CopyToCDS(CFE_ES_CDSHandle_t Handle, void *DataToCopy)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_CopyToCDSRange stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_CopyToCDSRange.  It copies the data into the unit test CDS
+**        at the requested offset.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_CopyToCDSRange(CFE_ES_CDSHandle_t Handle, uint32 Offset, uint32 Length, const void *DataToCopy)
+{
+    memcpy(&UT_CDS[Handle + Offset], DataToCopy, Length);
+
+    return CFE_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_RestoreFromCDS stub function
@@ -1212,3 +1260,148 @@ void CFE_ES_IncrementTaskCounter(void)
 void CFE_ES_WaitForStartupSync(uint32 Timeout)
 {
 }
+
+/*****************************************************************************/
+/**
+** \brief CFE_ES_DumpInit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_DumpInit.  It records the file descriptor in the writer.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_ES_DumpInit(CFE_ES_DumpWriter_t *Writer, int32 FileDescriptor)
+{
+    Writer->FileDescriptor = FileDescriptor;
+    Writer->Status = CFE_SUCCESS;
+    Writer->WriteSize = 0;
+    Writer->WriteStatus = 0;
+    Writer->FileSize = 0;
+    Writer->ElapsedMsec = 0;
+    Writer->BytesPerSec = 0;
+    Writer->BufferUsed = 0;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_ES_DumpWrite stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_DumpWrite.  The data is written to the file immediately by
+**        calling OS_write, so the user can make the dump fail by setting
+**        the OS_write return value.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either CFE_SUCCESS or CFE_ES_FILE_IO_ERR.
+**
+******************************************************************************/
+int32 CFE_ES_DumpWrite(CFE_ES_DumpWriter_t *Writer, const void *Data,
+                       uint32 Size)
+{
+    int32 status;
+
+    if (Writer->Status == CFE_SUCCESS && Size > 0)
+    {
+        status = OS_write(Writer->FileDescriptor, (void *) Data, Size);
+
+        if (status == (int32) Size)
+        {
+            Writer->FileSize += Size;
+        }
+        else
+        {
+            Writer->Status = CFE_ES_FILE_IO_ERR;
+            Writer->WriteSize = Size;
+            Writer->WriteStatus = status;
+        }
+    }
+
+    return Writer->Status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_ES_DumpWriteRing stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_DumpWriteRing.  The data up to the end of the ring and the
+**        data from the start of the ring are written using the
+**        CFE_ES_DumpWrite stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either CFE_SUCCESS or CFE_ES_FILE_IO_ERR.
+**
+******************************************************************************/
+int32 CFE_ES_DumpWriteRing(CFE_ES_DumpWriter_t *Writer, const void *Ring,
+                           uint32 RingSize, uint32 Offset, uint32 Size)
+{
+    uint32 FirstSize = RingSize - Offset;
+
+    if (FirstSize > Size)
+    {
+        FirstSize = Size;
+    }
+
+    CFE_ES_DumpWrite(Writer, (const uint8 *) Ring + Offset, FirstSize);
+    return CFE_ES_DumpWrite(Writer, Ring, Size - FirstSize);
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_ES_DumpFinish stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_DumpFinish.  It returns the status of the earlier writes.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either CFE_SUCCESS or CFE_ES_FILE_IO_ERR.
+**
+******************************************************************************/
+int32 CFE_ES_DumpFinish(CFE_ES_DumpWriter_t *Writer)
+{
+    return Writer->Status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_ES_ElapsedMsec stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_ElapsedMsec.  It computes the time between the two PSP
+**        times.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns the elapsed milliseconds, 0 if Stop is before Start.
+**
+******************************************************************************/
+uint32 CFE_ES_ElapsedMsec(const OS_time_t *Start, const OS_time_t *Stop)
+{
+    int32 Msec;
+
+    Msec = (int32) (Stop->seconds - Start->seconds) * 1000 +
+           ((int32) Stop->microsecs - (int32) Start->microsecs) / 1000;
+
+    return Msec > 0 ? (uint32) Msec : 0;
+}
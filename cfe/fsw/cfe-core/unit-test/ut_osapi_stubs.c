@@ -130,6 +130,7 @@ typedef struct
 ** External global variables
 */
 extern char   cMsg[];
+extern OS_time_t BSP_Time;
 
 UT_Queue_t UT_Queue[OS_MAX_QUEUES];
 
@@ -147,6 +148,7 @@ uint32  UT_BinSemFail = 0;
 uint32  UT_OS_Fail = OS_NO_FAIL;
 
 UT_SetRtn_t BinSemDelRtn;
+UT_SetRtn_t BinSemTimedWaitRtn;
 UT_SetRtn_t BlocksFreeRtn;
 UT_SetRtn_t CountSemDelRtn;
 UT_SetRtn_t FileWriteRtn;
@@ -173,6 +175,10 @@ UT_SetRtn_t QueueGetRtn;
 UT_SetRtn_t QueuePutRtn;
 UT_SetRtn_t SymbolLookupRtn;
 UT_SetRtn_t UnmountRtn;
+uint32      UT_BinSemTimedWaitMsecs;
+uint32      UT_BinSemTimedWaitUsecs;
+uint8       UT_FileWriteData[UT_FILE_DATA_SIZE];
+uint32      UT_FileWriteSize;
 
 /*
 ** Functions
@@ -195,6 +201,10 @@ int32 OS_API_Init (void)
    /* Reset all the existing-style deferred retcode structs */
    UT_OS_Fail = OS_NO_FAIL;
    UT_SetRtnCode(&QueuePutRtn, 0, 0);
+   UT_SetRtnCode(&BinSemTimedWaitRtn, 0, 0);
+   UT_BinSemTimedWaitMsecs = 0;
+   UT_BinSemTimedWaitUsecs = 0;
+   UT_FileWriteSize = 0;
    UT_SetRtnCode(&MutSemGiveRtn, 0, 0);
    UT_SetRtnCode(&MutSemTakeRtn, 0, 0);
    UT_SetRtnCode(&QueueCreateRtn, 0, 0);
@@ -1338,10 +1348,12 @@ int32 OS_remove(const char *path)
 **        cause the function to return a failure result, OS_FS_ERROR, by
 **        setting the value of UT_OS_Fail to OS_WRITE_FAIL prior to this
 **        function being called.  The input value, nbytes, is returned
-**        otherwise.
+**        otherwise, and the data is appended to UT_FileWriteData.
 **
 ** \par Assumptions, External Events, and Notes:
-**        Only outputs SUCCESS or FAILURE since packet structure isn't known
+**        Only outputs SUCCESS or FAILURE since packet structure isn't known.
+**        Data beyond the first UT_FILE_DATA_SIZE bytes written since the
+**        last OS_API_Init is not kept.
 **
 ** \returns
 **        Returns either a user-defined status flag, OS_FS_ERROR, or the value
@@ -1382,6 +1394,14 @@ int32 OS_write(int32 filedes, const void *buffer, uint32 nbytes)
         else
         {
             status = nbytes;
+
+            if (nbytes > UT_FILE_DATA_SIZE - UT_FileWriteSize)
+            {
+                nbytes = UT_FILE_DATA_SIZE - UT_FileWriteSize;
+            }
+
+            memcpy(&UT_FileWriteData[UT_FileWriteSize], buffer, nbytes);
+            UT_FileWriteSize += nbytes;
 #ifdef UT_VERBOSE
             snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
                      "  OS_write called: %lu (SUCCESS)", filedes);
@@ -2853,20 +2873,45 @@ int32 OS_ModuleInfo(uint32 module_id, OS_module_prop_t *module_info)
 **        to the value passed to the function, reset_type, and the variable
 **        OSBinSemTimedWaitRtn.count is incremented each time this function is
 **        called.  The unit tests compare these values to expected results to
-**        verify proper system response.
+**        verify proper system response.  The timeout is saved in
+**        UT_BinSemTimedWaitMsecs and BSP_Time is advanced by
+**        UT_BinSemTimedWaitUsecs microseconds to mimic the time spent
+**        waiting.  The user can adjust the response by setting the values in
+**        the BinSemTimedWaitRtn structure prior to this function being
+**        called.  If the value BinSemTimedWaitRtn.count is greater than zero
+**        then the counter is decremented; if it then equals zero the return
+**        value is set to the user-defined value BinSemTimedWaitRtn.value.
 **
 ** \par Assumptions, External Events, and Notes:
 **        None
 **
 ** \returns
-**        Returns OS_SUCCESS.
+**        Returns either a user-defined status flag or OS_SUCCESS.
 **
 ******************************************************************************/
 int32 OS_BinSemTimedWait(uint32 sem_id, uint32 msecs)
 {
+    int32 status = OS_SUCCESS;
+
     OSBinSemTimedWaitRtn.value = sem_id;
     OSBinSemTimedWaitRtn.count++;
-    return OS_SUCCESS;
+    UT_BinSemTimedWaitMsecs = msecs;
+
+    BSP_Time.microsecs += UT_BinSemTimedWaitUsecs;
+    BSP_Time.seconds += BSP_Time.microsecs / 1000000;
+    BSP_Time.microsecs %= 1000000;
+
+    if (BinSemTimedWaitRtn.count > 0)
+    {
+        BinSemTimedWaitRtn.count--;
+
+        if (BinSemTimedWaitRtn.count == 0)
+        {
+            status = BinSemTimedWaitRtn.value;
+        }
+    }
+
+    return status;
 }
 
 /*****************************************************************************/
@@ -64,6 +64,7 @@
 ** External global variables
 */
 extern uint16 UT_RcvMsgCode;
+extern int32  UT_RcvMsgTimeOut;
 extern int    UT_SB_TotalMsgLen;
 extern char   cMsg[];
 
@@ -237,6 +238,31 @@ CFE_SB_MsgId_t CFE_SB_GetMsgId(CFE_SB_MsgPtr_t MsgPtr)
     return CCSDS_RD_SID(MsgPtr->Hdr);
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_GetMsgTime stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE SB function
+**        CFE_SB_GetMsgTime.  It always returns a time of zero.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns a time of zero.
+**
+******************************************************************************/
+CFE_TIME_SysTime_t CFE_SB_GetMsgTime(CFE_SB_MsgPtr_t MsgPtr)
+{
+    CFE_TIME_SysTime_t Time = {0, 0};
+
+#ifdef UT_VERBOSE
+    UT_Text("  CFE_SB_GetMsgTime called");
+#endif
+    return Time;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_InitMsg stub function
@@ -272,7 +298,8 @@ void CFE_SB_InitMsg(void *MsgPtr,
 ** \par Description
 **        This function is used to mimic the response of the cFE SB function
 **        CFE_SB_RcvMsg.  It returns one successful command, then fails on a
-**        subsequent call.
+**        subsequent call.  The time out of the latest call is kept in
+**        UT_RcvMsgTimeOut.
 **
 ** \par Assumptions, External Events, and Notes:
 **        None
@@ -288,6 +315,8 @@ int32 CFE_SB_RcvMsg(CFE_SB_MsgPtr_t *BufPtr,
     int32      status = CFE_SUCCESS;
     static int NumRuns = 0;
 
+    UT_RcvMsgTimeOut = TimeOut;
+
     if (NumRuns == 0)
     {
         CFE_SB_SetMsgId(&UT_message, UT_RcvMsgId);
@@ -783,6 +812,44 @@ int32 CFE_SB_CleanUpApp(uint32 AppId)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_InvalidateSenderCache stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE SB function
+**        CFE_SB_InvalidateSenderCache.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_SB_InvalidateSenderCache(uint32 TaskId)
+{
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_SB_ReleaseTaskBufCache stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE SB function
+**        CFE_SB_ReleaseTaskBufCache.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_SB_ReleaseTaskBufCache(uint32 TaskId)
+{
+}
+
 /******************************************************************************
 **  Function:  CFE_SB_MessageStringGet()
 **
@@ -108,6 +108,7 @@ char    cMsg[UT_MAX_MESSAGE_LENGTH];
 uint8   UT_CDS[UT_CDS_SIZE];
 uint32  UT_BSP_Fail = 0x0000;
 uint16  UT_RcvMsgCode = 0;
+int32   UT_RcvMsgTimeOut = 0;
 uint32  UT_PutPool_Fail = 0;
 uint32  UT_AppID = 0;
 uint32  UT_StatusCDS = 0;
@@ -118,6 +119,7 @@ boolean UT_CDS_GoodEnd = TRUE;
 boolean UT_BSPCheckValidity = FALSE;
 boolean UT_CDS_Rebuild = FALSE;
 boolean UT_CDSReadBlock = FALSE;
+boolean UT_PSPMemValRangeFail = FALSE;
 uint16  UT_EventHistory[UT_EVENT_HISTORY_SIZE];
 uint32  UT_EventHistoryCtr = 0;
 int32   UT_StatusBSP = OS_SUCCESS;
@@ -234,6 +236,7 @@ void UT_InitData(void)
     UT_ClearEventHistory();
     UT_ResetPoolBufferIndex();
     UT_SetBSPFail(0);
+    UT_SetPSPMemValRangeFail(FALSE);
     UT_SetOSFail(0);
 
     /* Initialize values and counters used for forcing return values
@@ -508,6 +511,14 @@ void UT_SetCDSRebuild(boolean Truth)
     UT_CDS_Rebuild = Truth;
 }
 
+/*
+** Set the PSP memory range validation failure flag
+*/
+void UT_SetPSPMemValRangeFail(boolean Truth)
+{
+    UT_PSPMemValRangeFail = Truth;
+}
+
 /*
 ** Set BSP time
 */
@@ -169,6 +169,7 @@ typedef UT_Compat_SetRtn_t UT_SetRtn_t;
 
 #define UT_EVENT_HISTORY_SIZE 64
 #define UT_CDS_SIZE           20000
+#define UT_FILE_DATA_SIZE     32768
 #define UT_MAX_NUM_CDS        20
 #define UT_MAX_MESSAGE_LENGTH 300
 
@@ -682,6 +683,26 @@ void UT_SetCDSBSPCheckValidity(boolean Truth);
 ******************************************************************************/
 void UT_SetCDSRebuild(boolean Truth);
 
+/*****************************************************************************/
+/**
+** \brief Set the PSP memory range validation failure flag
+**
+** \par Description
+**        Set the flag used in CFE_PSP_MemValidateRange.  If TRUE, every
+**        range is reported as invalid, so CFE_ES_CalculateCRC reads the
+**        data itself instead of through CFE_PSP_MemRead8.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in] Truth  Set to TRUE to report every memory range as invalid
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void UT_SetPSPMemValRangeFail(boolean Truth);
+
 /*****************************************************************************/
 /**
 ** \brief Set BSP time
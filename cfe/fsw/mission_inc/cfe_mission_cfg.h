@@ -339,7 +339,7 @@
 /** \{ */
 #define CFE_ES_CRC_8   1  /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
 #define CFE_ES_CRC_16  2  /**< \brief CRC (16 bit additive - returns 32 bit total) */
-#define CFE_ES_CRC_32  3  /**< \brief CRC (32 bit additive - returns 32 bit total) (Currently not implemented) */
+#define CFE_ES_CRC_32  3  /**< \brief CRC (32 bit additive - returns 32 bit total) */
 /** \} */
 
 /**
@@ -351,7 +351,7 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_ES_CRC_16 is supported (see #CFE_ES_CRC_16)
+**      Currently CFE_ES_CRC_16 and CFE_ES_CRC_32 are supported (see #CFE_ES_CRC_16)
 */
 #define CFE_ES_DEFAULT_CRC  CFE_ES_CRC_16
 
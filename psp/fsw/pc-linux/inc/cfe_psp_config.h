@@ -53,5 +53,40 @@ typedef struct
 */
 #define CFE_PSP_NUM_EEPROM_BANKS 1
 
+/*
+** Preserved memory backing store
+**
+** When TRUE, the CDS, Reset Area and User Reserved Area are kept in files
+** mapped with MAP_SHARED instead of SysV shared memory segments.  The
+** files survive a reboot of the host, a processor reset re-attaches to
+** them without copying, and other tools can map or copy them while the
+** cFE is running.  When FALSE, the shared memory segments are used.
+*/
+#define CFE_PSP_MEMORY_MAPPED_FILES   FALSE
+
+/*
+** Backing files used when CFE_PSP_MEMORY_MAPPED_FILES is TRUE
+*/
+#define CFE_PSP_CDS_MAP_FILE          "./cfe_cds.img"
+#define CFE_PSP_RESET_MAP_FILE        "./cfe_reset.img"
+#define CFE_PSP_RESERVED_MAP_FILE     "./cfe_reserved.img"
+
+/*
+** Minimum time between flushes of CDS writes to the backing file
+** ( in milliseconds ).  Writes made in between are flushed together
+** with the next one that is due.  A value of 0 flushes every write
+** before CFE_PSP_WriteToCDS returns.
+*/
+#define CFE_PSP_CDS_SYNC_MSEC         1000
+
+/*
+** When TRUE, the backing files are mapped with huge pages.  This needs
+** the files to be on a hugetlbfs mount; otherwise the mapping falls back
+** to normal pages and asks for transparent huge pages instead.  The
+** files are rounded up to a multiple of CFE_PSP_HUGE_PAGE_SIZE.
+*/
+#define CFE_PSP_MAP_HUGE_PAGES        FALSE
+#define CFE_PSP_HUGE_PAGE_SIZE        (2 * 1024 * 1024)
+
 #endif
 
@@ -33,7 +33,11 @@
 #include <sys/types.h>
 #include <sys/ipc.h>
 #include <sys/shm.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
 
 /*
 ** cFE includes 
@@ -102,6 +106,217 @@ uint8 *CFE_PSP_UserReservedAreaPtr = 0;
 int    ResetAreaShmId;
 int    CDSShmId;
 int    UserShmId;
+
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+
+/*
+** A preserved memory area kept in a mapped file
+*/
+typedef struct
+{
+   int      Fd;
+   uint8   *Ptr;
+   size_t   MapSize;
+   uint32   DirtyStart;      /* First CDS byte written since the last flush */
+   uint32   DirtyEnd;        /* One past the last byte, 0 if nothing is dirty */
+   uint32   LastSyncMsec;
+} CFE_PSP_MappedFile_t;
+
+CFE_PSP_MappedFile_t CFE_PSP_CDSMap;
+CFE_PSP_MappedFile_t CFE_PSP_ResetAreaMap;
+CFE_PSP_MappedFile_t CFE_PSP_UserReservedMap;
+
+pthread_mutex_t      CFE_PSP_CDSSyncMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/******************************************************************************
+**  Function: CFE_PSP_MapFile
+**
+**  Purpose:
+**    Opens (creating it if needed) the backing file of a preserved memory
+**    area and maps it shared.  An existing file keeps its contents, which
+**    is what lets a processor reset re-attach to the area.
+**
+**  Arguments:
+**    Map      - area to map
+**    FileName - backing file
+**    Size     - size of the area in bytes
+**    AreaName - name used in messages
+**
+**  Return:
+**    Pointer to the area.  Any failure exits, as the shared memory code does.
+*/
+static uint8 *CFE_PSP_MapFile(CFE_PSP_MappedFile_t *Map, const char *FileName,
+                              uint32 Size, const char *AreaName)
+{
+   struct stat FileStat;
+   void       *Addr;
+
+   Map->MapSize = Size;
+#if (CFE_PSP_MAP_HUGE_PAGES == TRUE)
+   Map->MapSize = (Map->MapSize + CFE_PSP_HUGE_PAGE_SIZE - 1) &
+                  ~((size_t)CFE_PSP_HUGE_PAGE_SIZE - 1);
+#endif
+
+   Map->Fd = open(FileName, O_RDWR | O_CREAT, 0644);
+   if ( Map->Fd < 0 )
+   {
+        OS_printf("CFE_PSP: Cannot open %s file %s!\n", AreaName, FileName);
+        exit(-1);
+   }
+
+   /*
+   ** Grow a new or short file to the area size.  The added bytes read
+   ** back as zero.
+   */
+   if ( fstat(Map->Fd, &FileStat) != 0 ||
+        ( (size_t)FileStat.st_size < Map->MapSize &&
+          ftruncate(Map->Fd, (off_t)Map->MapSize) != 0 ) )
+   {
+        OS_printf("CFE_PSP: Cannot size %s file %s!\n", AreaName, FileName);
+        exit(-1);
+   }
+
+   Addr = MAP_FAILED;
+#if (CFE_PSP_MAP_HUGE_PAGES == TRUE) && defined(MAP_HUGETLB)
+   /*
+   ** MAP_HUGETLB only works for files on hugetlbfs
+   */
+   Addr = mmap(NULL, Map->MapSize, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_HUGETLB, Map->Fd, 0);
+#endif
+   if ( Addr == MAP_FAILED )
+   {
+      Addr = mmap(NULL, Map->MapSize, PROT_READ | PROT_WRITE, MAP_SHARED, Map->Fd, 0);
+#if (CFE_PSP_MAP_HUGE_PAGES == TRUE) && defined(MADV_HUGEPAGE)
+      if ( Addr != MAP_FAILED )
+      {
+         (void)madvise(Addr, Map->MapSize, MADV_HUGEPAGE);
+      }
+#endif
+   }
+
+   if ( Addr == MAP_FAILED )
+   {
+        OS_printf("CFE_PSP: Cannot map %s file %s!\n", AreaName, FileName);
+        exit(-1);
+   }
+
+   Map->Ptr          = (uint8 *)Addr;
+   Map->DirtyStart   = 0;
+   Map->DirtyEnd     = 0;
+   Map->LastSyncMsec = 0;
+
+   return(Map->Ptr);
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_UnmapFile
+**
+**  Purpose:
+**    Flushes and unmaps a preserved memory area.  The backing file is kept
+**    so the next processor reset can re-attach to it.
+**
+**  Arguments:
+**    Map      - area to unmap
+**    FileName - backing file
+**    AreaName - name used in messages
+**
+**  Return:
+**    (none)
+*/
+static void CFE_PSP_UnmapFile(CFE_PSP_MappedFile_t *Map, const char *FileName,
+                              const char *AreaName)
+{
+   if ( Map->Ptr == NULL )
+   {
+      return;
+   }
+
+   if ( msync(Map->Ptr, Map->MapSize, MS_SYNC) == 0 &&
+        munmap(Map->Ptr, Map->MapSize) == 0 )
+   {
+      printf("CFE_PSP: %s flushed to %s\n", AreaName, FileName);
+   }
+   else
+   {
+      printf("CFE_PSP: Error flushing %s to %s.\n", AreaName, FileName);
+   }
+
+   close(Map->Fd);
+   Map->Ptr = NULL;
+   Map->Fd  = -1;
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_SyncCDS
+**
+**  Purpose:
+**    Records a write to the CDS and flushes all writes recorded so far once
+**    CFE_PSP_CDS_SYNC_MSEC has passed since the last flush.  Writes in
+**    between are left to the next flush, or to the kernel's own writeback
+**    if no other write follows.
+**
+**  Arguments:
+**    CDSOffset - offset of the write
+**    NumBytes  - size of the write
+**
+**  Return:
+**    (none)
+*/
+static void CFE_PSP_SyncCDS(uint32 CDSOffset, uint32 NumBytes)
+{
+   struct timespec Now;
+   uint32          NowMsec;
+   uint32          SyncStart = 0;
+   uint32          SyncEnd = 0;
+   uint32          PageSize;
+
+   clock_gettime(CLOCK_MONOTONIC, &Now);
+   NowMsec = (uint32)Now.tv_sec * 1000 + (uint32)(Now.tv_nsec / 1000000);
+
+   pthread_mutex_lock(&CFE_PSP_CDSSyncMutex);
+
+   if ( CFE_PSP_CDSMap.DirtyEnd == 0 )
+   {
+      CFE_PSP_CDSMap.DirtyStart = CDSOffset;
+      CFE_PSP_CDSMap.DirtyEnd   = CDSOffset + NumBytes;
+   }
+   else
+   {
+      if ( CDSOffset < CFE_PSP_CDSMap.DirtyStart )
+      {
+         CFE_PSP_CDSMap.DirtyStart = CDSOffset;
+      }
+      if ( CDSOffset + NumBytes > CFE_PSP_CDSMap.DirtyEnd )
+      {
+         CFE_PSP_CDSMap.DirtyEnd = CDSOffset + NumBytes;
+      }
+   }
+
+   if ( (uint32)(NowMsec - CFE_PSP_CDSMap.LastSyncMsec) >= CFE_PSP_CDS_SYNC_MSEC )
+   {
+      SyncStart = CFE_PSP_CDSMap.DirtyStart;
+      SyncEnd   = CFE_PSP_CDSMap.DirtyEnd;
+      CFE_PSP_CDSMap.DirtyStart   = 0;
+      CFE_PSP_CDSMap.DirtyEnd     = 0;
+      CFE_PSP_CDSMap.LastSyncMsec = NowMsec;
+   }
+
+   pthread_mutex_unlock(&CFE_PSP_CDSSyncMutex);
+
+   /*
+   ** Flush outside the lock so other writers are not held up by the disk.
+   ** msync needs a page aligned start address.
+   */
+   if ( SyncEnd > SyncStart )
+   {
+      PageSize  = (uint32)sysconf(_SC_PAGESIZE);
+      SyncStart = SyncStart - (SyncStart % PageSize);
+      (void)msync(&CFE_PSP_CDSMap.Ptr[SyncStart], SyncEnd - SyncStart, MS_SYNC);
+   }
+}
+
+#endif /* CFE_PSP_MEMORY_MAPPED_FILES */
                                                                               
                                                                               
                                                                               
@@ -130,6 +345,11 @@ int    UserShmId;
 int32 CFE_PSP_InitCDS(uint32 RestartType )
 {
    int32 return_code;
+
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+   CFE_PSP_CDSPtr = CFE_PSP_MapFile(&CFE_PSP_CDSMap, CFE_PSP_CDS_MAP_FILE,
+                                    CFE_PSP_CDS_SIZE, "CDS");
+#else
    key_t key;
 
    /* 
@@ -159,6 +379,7 @@ int32 CFE_PSP_InitCDS(uint32 RestartType )
         OS_printf("CFE_PSP: Cannot shmat to CDS Shared memory Segment!\n");
         exit(-1);
    }
+#endif
 
    if ( RestartType == CFE_PSP_RST_TYPE_POWERON )
    {
@@ -187,6 +408,9 @@ int32 CFE_PSP_InitCDS(uint32 RestartType )
 void CFE_PSP_DeleteCDS(void)
 {
 
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+   CFE_PSP_UnmapFile(&CFE_PSP_CDSMap, CFE_PSP_CDS_MAP_FILE, "Critical Data Store");
+#else
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
    
@@ -201,8 +425,7 @@ void CFE_PSP_DeleteCDS(void)
       printf("CFE_PSP: Error Removing Critical Data Store Shared memory Segment.\n");
       printf("CFE_PSP: It can be manually checked and removed using the ipcs and ipcrm commands.\n");
    }
-
-
+#endif
 }
 
 /******************************************************************************
@@ -263,6 +486,10 @@ int32 CFE_PSP_WriteToCDS(void *PtrToDataToWrite, uint32 CDSOffset, uint32 NumByt
        {
           CopyPtr = &(CFE_PSP_CDSPtr[CDSOffset]);
           memcpy(CopyPtr, (char *)PtrToDataToWrite,NumBytes);
+
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+          CFE_PSP_SyncCDS(CDSOffset, NumBytes);
+#endif
           
           return_code = CFE_PSP_SUCCESS;
        }
@@ -343,6 +570,11 @@ int32 CFE_PSP_InitResetArea(uint32 RestartType)
 {
 
    int32 return_code;
+
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+   CFE_PSP_ResetAreaPtr = CFE_PSP_MapFile(&CFE_PSP_ResetAreaMap, CFE_PSP_RESET_MAP_FILE,
+                                          CFE_PSP_RESET_AREA_SIZE, "Reset Area");
+#else
    key_t key;
 
    /* 
@@ -372,6 +604,7 @@ int32 CFE_PSP_InitResetArea(uint32 RestartType)
         OS_printf("CFE_PSP: Cannot shmat to Reset Area Shared memory Segment!\n");
         exit(-1);
    }
+#endif
 
    if ( RestartType == CFE_PSP_RST_TYPE_POWERON )
    {
@@ -398,6 +631,9 @@ int32 CFE_PSP_InitResetArea(uint32 RestartType)
 */
 void CFE_PSP_DeleteResetArea(void)
 {
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+   CFE_PSP_UnmapFile(&CFE_PSP_ResetAreaMap, CFE_PSP_RESET_MAP_FILE, "Reset Area");
+#else
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
    
@@ -412,8 +648,7 @@ void CFE_PSP_DeleteResetArea(void)
       printf("Error Removing Reset Area Shared memory Segment.\n");
       printf("It can be manually checked and removed using the ipcs and ipcrm commands.\n");
    }
-
-
+#endif
 }
 
 
@@ -473,6 +708,11 @@ int32 CFE_PSP_GetResetArea (cpuaddr *PtrToResetArea, uint32 *SizeOfResetArea)
 int32 CFE_PSP_InitUserReservedArea(uint32 RestartType )
 {
    int32 return_code;
+
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+   CFE_PSP_UserReservedAreaPtr = CFE_PSP_MapFile(&CFE_PSP_UserReservedMap, CFE_PSP_RESERVED_MAP_FILE,
+                                                 CFE_PSP_USER_RESERVED_SIZE, "User Reserved Area");
+#else
    key_t key;
 
    /* 
@@ -502,6 +742,7 @@ int32 CFE_PSP_InitUserReservedArea(uint32 RestartType )
         OS_printf("CFE_PSP: Cannot shmat to User Reserved Area Shared memory Segment!\n");
         exit(-1);
    }
+#endif
 
    if ( RestartType == CFE_PSP_RST_TYPE_POWERON )
    {
@@ -528,6 +769,9 @@ int32 CFE_PSP_InitUserReservedArea(uint32 RestartType )
 */
 void CFE_PSP_DeleteUserReservedArea(void)
 {
+#if (CFE_PSP_MEMORY_MAPPED_FILES == TRUE)
+   CFE_PSP_UnmapFile(&CFE_PSP_UserReservedMap, CFE_PSP_RESERVED_MAP_FILE, "User Reserved Area");
+#else
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
    
@@ -542,6 +786,7 @@ void CFE_PSP_DeleteUserReservedArea(void)
       printf("Error Removing User Reserved Area Shared memory Segment.\n");
       printf("It can be manually checked and removed using the ipcs and ipcrm commands.\n");
    }
+#endif
 }
 
 
@@ -663,6 +908,8 @@ int32 CFE_PSP_GetVolatileDiskMem(cpuaddr *PtrToVolDisk, uint32 *SizeOfVolDisk )
 int32 CFE_PSP_InitProcessorReservedMemory( uint32 RestartType )
 {
    int32 return_code;
+
+#if (CFE_PSP_MEMORY_MAPPED_FILES != TRUE)
    int   tempFd;
    
    /*
@@ -675,6 +922,7 @@ int32 CFE_PSP_InitProcessorReservedMemory( uint32 RestartType )
    close(tempFd);
    tempFd = open(CFE_PSP_RESERVED_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU );
    close(tempFd);
+#endif
       
    if ( RestartType == CFE_PSP_RST_TYPE_PROCESSOR )
    {
@@ -699,7 +947,8 @@ int32 CFE_PSP_InitProcessorReservedMemory( uint32 RestartType )
 **
 **  Purpose:
 **    This function cleans up all of the shared memory segments in the 
-**     Linux/OSX ports.
+**     Linux/OSX ports.  When the areas are kept in mapped files, the files
+**     are flushed and left in place.
 **
 **  Arguments:
 **    (none)
@@ -101,12 +101,17 @@ int32 OutputDataToTargetFile(void);
 void  OutputVersionInfo(void);
 void  OutputHelpInfo(void);
 int32 LocateAndReadUserObject(void);
+int32 ReadBaseImage(void);
+int32 ReadUserObjectData(void);
+uint32 FindNextPatch(uint32 Start, uint32 *EndPtr);
+void  OutputPatchesToTargetFile(void);
 
 /**
 *    Global Variables
 */
 char SrcFilename[OS_MAX_FILE_NAME+3]={""};
 char DstFilename[OS_MAX_FILE_NAME+3]={""};
+char BaseFilename[OS_MAX_FILE_NAME+3]={""};
 char TableName[38]={""};
 char Description[32]={""};
 char LineOfText[300]={""};
@@ -128,6 +133,7 @@ boolean ByteAlignFileHeaders=TRUE;
 boolean EnableTimeTagInHeader=FALSE;
 
 boolean TableDataIsAllZeros=FALSE;
+boolean PatchOutput=FALSE;
 
 FILE *SrcFileDesc;
 FILE *DstFileDesc;
@@ -135,6 +141,9 @@ FILE *DstFileDesc;
 CFE_FS_Header_t     FileHeader;
 CFE_TBL_File_Hdr_t  TableHeader;
 
+uint8 *BaseImage = NULL;
+uint8 *NewImage = NULL;
+
 Elf32_Ehdr ElfHeader;
 Elf32_Shdr **SectionHeaderPtrs = NULL;
 Elf32_Shdr SectionHeaderStringTable = {0, 0, 0, NULL, 0, 0, 0, 0, 0, 0 };
@@ -344,6 +353,17 @@ int main(int argc, char *argv[])
         return Status;
     }
     
+    if (PatchOutput)
+    {
+        Status = ReadBaseImage();
+        if (Status == SUCCESS) Status = ReadUserObjectData();
+        if (Status != SUCCESS)
+        {
+            FreeMemoryAllocations();
+            return Status;
+        }
+    }
+    
     Status = OutputDataToTargetFile();
 
     FreeMemoryAllocations();
@@ -534,6 +554,8 @@ void FreeMemoryAllocations(void)
     DeallocateSectionHeaders();
     fclose(SrcFileDesc);
     fclose(DstFileDesc);
+    free(BaseImage);
+    free(NewImage);
 }
 
 /**
@@ -655,6 +677,11 @@ int32 ProcessCmdLineOptions(int ArgumentCount, char *Arguments[])
         {
             EnableTimeTagInHeader = TRUE;
         }
+        else if ((Arguments[i][0] == '-') && (Arguments[i][1] == 'b'))
+        {
+            strncpy(BaseFilename, &Arguments[i][2], OS_MAX_FILE_NAME);
+            PatchOutput = TRUE;
+        }
         else if ((Arguments[i][0] == '-') && (Arguments[i][1] == 'e'))
         {
             ScEpoch.Year = strtoul(&Arguments[i][2], &EndPtr, 0);
@@ -890,7 +917,7 @@ void OutputVersionInfo(void)
 void OutputHelpInfo(void)
 {
     printf("elf2cfetbl [-tTblName] [-d\"Description\"] [-h] [-v] [-V] [-s#] [-p#] [-n] \n");
-    printf("           [-T] [-eYYYY:MM:DD:hh:mm:ss] [-fYYYY:MM:DD:hh:mm:ss] SrcFilename [DestDirectory]\n");
+    printf("           [-T] [-eYYYY:MM:DD:hh:mm:ss] [-fYYYY:MM:DD:hh:mm:ss] [-bBaseImage] SrcFilename [DestDirectory]\n");
     printf("   where:\n");
     printf("   -tTblName             replaces the table name specified in the object file with 'TblName'\n");
     printf("   -d\"Description\"       replaces the description specified in the object file with 'Description'\n");
@@ -929,6 +956,9 @@ void OutputHelpInfo(void)
     printf("                                  hh=hour (00-23), mm=minute (00-59), ss=seconds (00-59)\n");
     printf("                         If no epoch is specified, the default epoch is 1970:01:01:00:00:00\n");
     printf("                         This option requires the '-T' option, defined above, to be specified to have any effect\n");
+    printf("   -bBaseImage           specifies a cFE Table Image file holding the table image currently loaded onboard.  Rather than\n");
+    printf("                         a whole table image, a cFE Table Patch file holding only the bytes that differ from BaseImage\n");
+    printf("                         is created.  Its name is the name of the table image file followed by '.patch'.\n");
     printf("   SrcFilename           specifies the object file to be converted\n");
     printf("   DestDirectory         specifies the directory in which the cFE Table Image file is to be created.\n");
     printf("                         If a directory is not specified './' is assumed.\n");
@@ -936,6 +966,7 @@ void OutputHelpInfo(void)
     printf("EXAMPLES:\n");
     printf("   elf2cfetbl MyObjectFile ../../TblDefaultImgDir/\n");
     printf("   elf2cfetbl -s12 -p0x0D -a016 -e2000:01:01:00:00:00 MyObjectFile ../../TblDefaultImgDir/\n");
+    printf("   elf2cfetbl -b../../TblDefaultImgDir/MyTblDefault.bin MyObjectFile ../../TblPatchDir/\n");
     printf("\n");
     printf("NOTE: The name of the target file is specified within the source file as part of the CFE_TBL_FILEDEF macro.\n");
     printf("      If the macro has not been included in the source file, the utility will fail to convert the object file.\n");
@@ -962,6 +993,194 @@ int32 GetSrcFilename(void)
 *
 */
 
+int32 ReadBaseImage(void)
+{
+    FILE   *BaseFileDesc;
+    uint32  HeaderSize;
+    uint32  Offset = 0;
+    uint32  NumBytes = 0;
+    char    BaseTableName[CFE_TBL_MAX_FULL_NAME_LEN];
+    char   *ExpectedTableName = TblFileDef.TableName;
+    uint32  ObjectSize = SymbolPtrs[UserObjSymbolIndex]->st_size;
+    int32   Status = SUCCESS;
+
+    if (TableNameOverride == TRUE) ExpectedTableName = TableName;
+    
+    BaseFileDesc = fopen(BaseFilename, "r");
+
+    if (BaseFileDesc == NULL)
+    {
+        printf("'%s' was not opened\n", BaseFilename);
+        return FAILED;
+    }
+    
+    /* The standard cFE header is assumed to be laid out just as this utility writes it */
+    HeaderSize = 8*sizeof(uint32) + CFE_FS_HDR_DESC_MAX_LEN;
+    if ((ByteAlignFileHeaders) && (CFE_FS_HDR_DESC_MAX_LEN%4 != 0))
+    {
+        HeaderSize += 4-(CFE_FS_HDR_DESC_MAX_LEN%4);
+    }
+    
+    /* Skip over the standard cFE header and the Reserved word of the table header */
+    fseek(BaseFileDesc, HeaderSize + sizeof(uint32), SEEK_SET);
+    
+    if ((fread(&Offset, sizeof(uint32), 1, BaseFileDesc) != 1) ||
+        (fread(&NumBytes, sizeof(uint32), 1, BaseFileDesc) != 1) ||
+        (fread(BaseTableName, CFE_TBL_MAX_FULL_NAME_LEN, 1, BaseFileDesc) != 1))
+    {
+        printf("Error! Unable to read the table header of '%s'\n", BaseFilename);
+        fclose(BaseFileDesc);
+        return FAILED;
+    }
+    
+    BaseTableName[CFE_TBL_MAX_FULL_NAME_LEN-1] = '\0';
+    
+    if (ThisMachineIsLittleEndian == TRUE)
+    {
+        SwapUInt32(&Offset);
+        SwapUInt32(&NumBytes);
+    }
+    
+    if (Verbose) printf("Base Image '%s': Table '%s', Offset = %d, NumBytes = %d\n", BaseFilename, BaseTableName, Offset, NumBytes);
+    
+    if (strcmp(BaseTableName, ExpectedTableName) != 0)
+    {
+        printf("Error! '%s' holds table '%s' rather than '%s'\n", BaseFilename, BaseTableName, ExpectedTableName);
+        Status = FAILED;
+    }
+    else if ((Offset != 0) || (NumBytes != ObjectSize))
+    {
+        printf("Error! '%s' does not hold a complete image of the %d byte table\n", BaseFilename, ObjectSize);
+        Status = FAILED;
+    }
+    else
+    {
+        if ((ByteAlignFileHeaders) && (CFE_TBL_MAX_FULL_NAME_LEN%4 != 0))
+        {
+            fseek(BaseFileDesc, 4-(CFE_TBL_MAX_FULL_NAME_LEN%4), SEEK_CUR);
+        }
+        
+        BaseImage = malloc(ObjectSize);
+        if (BaseImage == NULL)
+        {
+            printf("Error! Insufficient memory for the image in '%s'\n", BaseFilename);
+            Status = FAILED;
+        }
+        else if (fread(BaseImage, 1, ObjectSize, BaseFileDesc) != ObjectSize)
+        {
+            printf("Error! '%s' holds less data than its table header indicates\n", BaseFilename);
+            Status = FAILED;
+        }
+    }
+    
+    fclose(BaseFileDesc);
+    
+    return Status;
+}
+
+/**
+*
+*/
+
+int32 ReadUserObjectData(void)
+{
+    uint32  ObjectSize = SymbolPtrs[UserObjSymbolIndex]->st_size;
+
+    NewImage = malloc(ObjectSize);
+    if (NewImage == NULL)
+    {
+        printf("Error! Insufficient memory for the '%s' object\n", TblFileDef.ObjectName);
+        return FAILED;
+    }
+    
+    if (TableDataIsAllZeros)
+    {
+        memset(NewImage, 0, ObjectSize);
+    }
+    else if (fread(NewImage, 1, ObjectSize, SrcFileDesc) != ObjectSize)
+    {
+        printf("Error! Unable to read the '%s' object from '%s'\n", TblFileDef.ObjectName, SrcFilename);
+        return FAILED;
+    }
+    
+    return SUCCESS;
+}
+
+/**
+*    Returns the offset of the first byte at or after Start that differs from the base image,
+*    or the size of the table if there is none, and sets *EndPtr to the end of the patch that
+*    starts there.  A patch runs on over unchanged bytes when the next changed byte is closer
+*    than the size of a patch header, since sending those bytes costs less than a new patch.
+*/
+
+uint32 FindNextPatch(uint32 Start, uint32 *EndPtr)
+{
+    uint32 Size = SymbolPtrs[UserObjSymbolIndex]->st_size;
+    uint32 End;
+    uint32 Gap = 0;
+    
+    while ((Start < Size) && (NewImage[Start] == BaseImage[Start]))
+    {
+        Start++;
+    }
+    
+    End = Start;
+    while (((End + Gap) < Size) && (Gap <= sizeof(CFE_TBL_PatchHdr_t)))
+    {
+        if (NewImage[End + Gap] != BaseImage[End + Gap])
+        {
+            End += Gap + 1;
+            Gap = 0;
+        }
+        else
+        {
+            Gap++;
+        }
+    }
+    
+    *EndPtr = End;
+    
+    return Start;
+}
+
+/**
+*
+*/
+
+void OutputPatchesToTargetFile(void)
+{
+    CFE_TBL_PatchHdr_t PatchHeader;
+    uint32 Size = SymbolPtrs[UserObjSymbolIndex]->st_size;
+    uint32 PatchStart;
+    uint32 PatchEnd;
+    
+    PatchStart = FindNextPatch(0, &PatchEnd);
+    while (PatchStart < Size)
+    {
+        if (Verbose) printf("Patch of %d bytes at offset %d\n", PatchEnd - PatchStart, PatchStart);
+        
+        PatchHeader.Offset = PatchStart;
+        PatchHeader.NumBytes = PatchEnd - PatchStart;
+        
+        /* If this machine is little endian, the patch header must be swapped */
+        if (ThisMachineIsLittleEndian == TRUE)
+        {
+            SwapUInt32(&PatchHeader.Offset);
+            SwapUInt32(&PatchHeader.NumBytes);
+        }
+        
+        fwrite(&PatchHeader.Offset, sizeof(uint32), 1, DstFileDesc);
+        fwrite(&PatchHeader.NumBytes, sizeof(uint32), 1, DstFileDesc);
+        fwrite(&NewImage[PatchStart], PatchEnd - PatchStart, 1, DstFileDesc);
+        
+        PatchStart = FindNextPatch(PatchEnd, &PatchEnd);
+    }
+}
+
+/**
+*
+*/
+
 int32 GetDstFilename(void)
 {
     int32 Status = SUCCESS;
@@ -973,6 +1192,17 @@ int32 GetDstFilename(void)
     
     strcat(DstFilename, TblFileDef.TgtFilename);
     
+    if (PatchOutput)
+    {
+        if ((strlen(DstFilename) + strlen(".patch")) >= sizeof(DstFilename))
+        {
+            printf("Error! Target Filename '%s.patch' is too long\n", DstFilename);
+            return FAILED;
+        }
+        
+        strcat(DstFilename, ".patch");
+    }
+    
     if (Verbose) printf("Target Filename: %s\n", DstFilename);
 
     return Status;
@@ -1751,10 +1981,13 @@ int32 OutputDataToTargetFile()
     int32 Status = SUCCESS;
     uint8 AByte = 0;
     int32 i = 0;
+    uint32 PatchStart;
+    uint32 PatchEnd;
 
     /* Create the standard header */
     FileHeader.ContentType = 0x63464531;
     FileHeader.SubType = CFE_FS_TBL_IMG_SUBTYPE;
+    if (PatchOutput) FileHeader.SubType = CFE_FS_TBL_PATCH_SUBTYPE;
     FileHeader.Length = sizeof(CFE_FS_Header_t);
     
     if (ScIDSpecified == TRUE)
@@ -1824,6 +2057,27 @@ int32 OutputDataToTargetFile()
     memset(&TableHeader, 0, sizeof(TableHeader));
     TableHeader.NumBytes = SymbolPtrs[UserObjSymbolIndex]->st_size;
     
+    if (PatchOutput)
+    {
+        /* The table header of a patch file gives the span of the table covered by the patches */
+        PatchStart = FindNextPatch(0, &PatchEnd);
+        if (PatchStart < SymbolPtrs[UserObjSymbolIndex]->st_size)
+        {
+            TableHeader.Offset = PatchStart;
+            while (PatchStart < SymbolPtrs[UserObjSymbolIndex]->st_size)
+            {
+                TableHeader.NumBytes = PatchEnd - TableHeader.Offset;
+                PatchStart = FindNextPatch(PatchEnd, &PatchEnd);
+            }
+        }
+        else
+        {
+            printf("Table image is identical to '%s', no patches are needed\n", BaseFilename);
+            TableHeader.Offset = 0;
+            TableHeader.NumBytes = SymbolPtrs[UserObjSymbolIndex]->st_size;
+        }
+    }
+    
     if (TableNameOverride == TRUE)
     {
         strcpy(TableHeader.TableName, TableName);
@@ -1876,7 +2130,11 @@ int32 OutputDataToTargetFile()
     }
 
     /* Output the data from the object file */
-    if (TableDataIsAllZeros)
+    if (PatchOutput)
+    {
+        OutputPatchesToTargetFile();
+    }
+    else if (TableDataIsAllZeros)
     {
         AByte = 0;
         for (i=0; i<SymbolPtrs[UserObjSymbolIndex]->st_size; i++)